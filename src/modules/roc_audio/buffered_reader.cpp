@@ -0,0 +1,67 @@
+/*
+ * Copyright (c) 2015 Mikhail Baranov
+ * Copyright (c) 2015 Victor Gaydov
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "roc_core/stddefs.h"
+#include "roc_core/panic.h"
+
+#include "roc_audio/buffered_reader.h"
+
+namespace roc {
+namespace audio {
+
+BufferedReader::BufferedReader(IStreamReader& reader, ISampleBufferComposer& composer)
+    : reader_(reader)
+    , pos_(0) {
+    if (!(buffer_ = composer.compose())) {
+        roc_panic("buffered reader: can't compose buffer in constructor");
+    }
+
+    buffer_->set_size(0);
+}
+
+void BufferedReader::fill(size_t num_samples) {
+    if (num_samples > buffer_->max_size()) {
+        roc_panic("buffered reader: number of samples exceeds buffer size "
+                  "(num_samples=%u, max_size=%u)",
+                  (unsigned)num_samples, (unsigned)buffer_->max_size());
+    }
+
+    buffer_->set_size(num_samples);
+    pos_ = 0;
+
+    if (num_samples != 0) {
+        reader_.read(*buffer_);
+    }
+}
+
+void BufferedReader::read(const ISampleBufferSlice& out) {
+    packet::sample_t* out_data = out.data();
+    const size_t out_sz = out.size();
+
+    if (out_data == NULL) {
+        roc_panic("buffered reader: attempting to pass empty buffer");
+    }
+
+    size_t n_buffered = buffer_->size() - pos_;
+    if (n_buffered > out_sz) {
+        n_buffered = out_sz;
+    }
+
+    if (n_buffered != 0) {
+        memcpy(out_data, buffer_->data() + pos_, n_buffered * sizeof(packet::sample_t));
+        pos_ += n_buffered;
+    }
+
+    if (n_buffered != out_sz) {
+        reader_.read(ISampleBufferSlice(out, n_buffered, out_sz - n_buffered));
+    }
+}
+
+} // namespace audio
+} // namespace roc
@@ -0,0 +1,61 @@
+/*
+ * Copyright (c) 2015 Mikhail Baranov
+ * Copyright (c) 2015 Victor Gaydov
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+//! @file roc_audio/buffered_reader.h
+//! @brief Buffered reader.
+
+#ifndef ROC_AUDIO_BUFFERED_READER_H_
+#define ROC_AUDIO_BUFFERED_READER_H_
+
+#include "roc_core/noncopyable.h"
+
+#include "roc_audio/sample_buffer.h"
+#include "roc_audio/istream_reader.h"
+
+namespace roc {
+namespace audio {
+
+//! Buffered reader.
+//!
+//! Reads samples from input stream in advance when fill() is called and
+//! returns them from subsequent read() calls. If more samples are requested
+//! than were buffered, the rest is read from input stream directly.
+//!
+//! @remarks
+//!  Allows to run input stream pipeline and its consumer at different
+//!  times, e.g. to render input stream in another thread.
+class BufferedReader : public IStreamReader, public core::NonCopyable<> {
+public:
+    //! Initialize.
+    //!
+    //! @b Parameters
+    //!  - @p reader is input stream;
+    //!  - @p composer is used to construct buffer.
+    explicit BufferedReader(IStreamReader& reader,
+                            ISampleBufferComposer& composer = default_buffer_composer());
+
+    //! Read samples from input stream into buffer.
+    //! @remarks
+    //!  Samples that were buffered but not read yet are dropped.
+    void fill(size_t num_samples);
+
+    //! Read buffered samples.
+    virtual void read(const ISampleBufferSlice&);
+
+private:
+    IStreamReader& reader_;
+
+    ISampleBufferPtr buffer_;
+    size_t pos_;
+};
+
+} // namespace audio
+} // namespace roc
+
+#endif // ROC_AUDIO_BUFFERED_READER_H_
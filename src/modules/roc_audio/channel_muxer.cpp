@@ -13,7 +13,8 @@ namespace roc {
 namespace audio {
 
 ChannelMuxer::ChannelMuxer(packet::channel_mask_t channels,
-                           ISampleBufferComposer& composer)
+                           ISampleBufferComposer& composer,
+                           bool clipping)
     : zipper_(composer)
     , channels_(channels) {
     if (channels_ == 0) {
@@ -21,7 +22,7 @@ ChannelMuxer::ChannelMuxer(packet::channel_mask_t channels,
     }
 
     for (size_t ch = 0; ch < mixers_.max_size(); ch++) {
-        new (mixers_.allocate()) Mixer(composer);
+        new (mixers_.allocate()) Mixer(composer, clipping);
 
         if (channels_ & (1 << ch)) {
             zipper_.add(mixers_.back());
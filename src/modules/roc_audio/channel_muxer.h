@@ -34,9 +34,15 @@ namespace audio {
 class ChannelMuxer : public IStreamReader, public ISink, public core::NonCopyable<> {
 public:
     //! Initialize.
+    //!
+    //! @b Parameters
+    //!  - @p channels defines enabled channels
+    //!  - @p composer is used to construct temporary buffers
+    //!  - @p clipping enables clamping of mixed samples to [-1; 1]
     explicit ChannelMuxer(
         packet::channel_mask_t channels = ROC_CONFIG_DEFAULT_CHANNEL_MASK,
-        ISampleBufferComposer& composer = default_buffer_composer());
+        ISampleBufferComposer& composer = default_buffer_composer(),
+        bool clipping = false);
 
     //! Attach reader for channel.
     virtual void attach(packet::channel_t, IStreamReader&);
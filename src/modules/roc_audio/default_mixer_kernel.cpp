@@ -0,0 +1,37 @@
+/*
+ * Copyright (c) 2015 Mikhail Baranov
+ * Copyright (c) 2015 Victor Gaydov
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "roc_core/singleton.h"
+
+#include "roc_audio/default_mixer_kernel.h"
+#include "roc_audio/generic_mixer_kernel.h"
+
+#ifdef ROC_TARGET_SSE
+#include "roc_audio/sse_mixer_kernel.h"
+#endif
+
+#ifdef ROC_TARGET_NEON
+#include "roc_audio/neon_mixer_kernel.h"
+#endif
+
+namespace roc {
+namespace audio {
+
+IMixerKernel& default_mixer_kernel() {
+#if defined(ROC_TARGET_SSE)
+    return core::Singleton<SSE2MixerKernel>::instance();
+#elif defined(ROC_TARGET_NEON)
+    return core::Singleton<NEONMixerKernel>::instance();
+#else
+    return core::Singleton<GenericMixerKernel>::instance();
+#endif
+}
+
+} // namespace audio
+} // namespace roc
@@ -0,0 +1,27 @@
+/*
+ * Copyright (c) 2015 Mikhail Baranov
+ * Copyright (c) 2015 Victor Gaydov
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+//! @file roc_audio/default_mixer_kernel.h
+//! @brief Default mixer kernel.
+
+#ifndef ROC_AUDIO_DEFAULT_MIXER_KERNEL_H_
+#define ROC_AUDIO_DEFAULT_MIXER_KERNEL_H_
+
+#include "roc_audio/imixer_kernel.h"
+
+namespace roc {
+namespace audio {
+
+//! Get fastest mixer kernel enabled at build time.
+IMixerKernel& default_mixer_kernel();
+
+} // namespace audio
+} // namespace roc
+
+#endif // ROC_AUDIO_DEFAULT_MIXER_KERNEL_H_
@@ -0,0 +1,40 @@
+/*
+ * Copyright (c) 2015 Mikhail Baranov
+ * Copyright (c) 2015 Victor Gaydov
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "roc_core/singleton.h"
+
+#include "roc_audio/default_resampler_kernel.h"
+#include "roc_audio/generic_resampler_kernel.h"
+
+#ifdef ROC_TARGET_SSE
+#include "roc_audio/sse_resampler_kernel.h"
+#endif
+
+#ifdef ROC_TARGET_NEON
+#include "roc_audio/neon_resampler_kernel.h"
+#endif
+
+namespace roc {
+namespace audio {
+
+IResamplerKernel& default_resampler_kernel() {
+#if defined(ROC_TARGET_SSE)
+    if (AVX2ResamplerKernel::supported()) {
+        return core::Singleton<AVX2ResamplerKernel>::instance();
+    }
+    return core::Singleton<SSE2ResamplerKernel>::instance();
+#elif defined(ROC_TARGET_NEON)
+    return core::Singleton<NEONResamplerKernel>::instance();
+#else
+    return core::Singleton<GenericResamplerKernel>::instance();
+#endif
+}
+
+} // namespace audio
+} // namespace roc
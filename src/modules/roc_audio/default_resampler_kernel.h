@@ -0,0 +1,30 @@
+/*
+ * Copyright (c) 2015 Mikhail Baranov
+ * Copyright (c) 2015 Victor Gaydov
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+//! @file roc_audio/default_resampler_kernel.h
+//! @brief Default resampler kernel.
+
+#ifndef ROC_AUDIO_DEFAULT_RESAMPLER_KERNEL_H_
+#define ROC_AUDIO_DEFAULT_RESAMPLER_KERNEL_H_
+
+#include "roc_audio/iresampler_kernel.h"
+
+namespace roc {
+namespace audio {
+
+//! Get fastest resampler kernel supported by current CPU.
+//! @remarks
+//!  Vectorized kernels are used when they are enabled at build time and
+//!  supported by CPU we're running on; otherwise, generic kernel is used.
+IResamplerKernel& default_resampler_kernel();
+
+} // namespace audio
+} // namespace roc
+
+#endif // ROC_AUDIO_DEFAULT_RESAMPLER_KERNEL_H_
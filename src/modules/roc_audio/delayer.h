@@ -14,8 +14,12 @@
 #define ROC_AUDIO_DELAYER_H_
 
 #include "roc_core/noncopyable.h"
+#include "roc_core/helpers.h"
+#include "roc_core/panic.h"
+#include "roc_core/log.h"
 
 #include "roc_packet/ipacket_reader.h"
+#include "roc_packet/iaudio_packet.h"
 #include "roc_packet/packet_queue.h"
 
 namespace roc {
@@ -24,7 +28,11 @@ namespace audio {
 //! Audio packet delayer.
 //! @remarks
 //!  Delays audio packet reader for given amount of samples.
-class Delayer : public packet::IPacketReader, public core::NonCopyable<> {
+//!
+//! @tparam Reader defines type of input packet reader; if it's a concrete
+//!  reader class, reading from it is not virtual and may be inlined.
+template <class Reader>
+class BasicDelayer : public packet::IPacketReader, public core::NonCopyable<> {
 public:
     //! Constructor.
     //!
@@ -36,19 +44,68 @@ public:
     //!  read() returns NULL until packets with total length of at least
     //!  @p delay samples are available first time. After that, read()
     //!  will always return packets from @p reader.
-    Delayer(packet::IPacketReader& reader, packet::timestamp_t delay);
+    BasicDelayer(Reader& reader, packet::timestamp_t delay)
+        : reader_(reader)
+        , queue_(0)
+        , delay_(delay) {
+    }
 
     //! Read next packet.
-    virtual packet::IPacketConstPtr read();
+    virtual packet::IPacketConstPtr read() {
+        if (delay_ == 0 && queue_.size() == 0) {
+            return packet::read_packet(reader_);
+        }
+
+        while (packet::IPacketConstPtr packet = packet::read_packet(reader_)) {
+            if (packet->type() != packet::IAudioPacket::Type) {
+                roc_panic("delayer: got packet of wrong type (expected audio packet)");
+            }
+            queue_.write(packet);
+        }
+
+        if (delay_ != 0) {
+            const packet::timestamp_t qs = queue_size_();
+            if (qs <= delay_) {
+                return NULL;
+            }
+
+            roc_log(LOG_DEBUG,
+                    "delayer: received enough packets: delay=%lu samples=%lu packets=%lu",
+                    (unsigned long)delay_, //
+                    (unsigned long)qs,     //
+                    (unsigned long)queue_.size());
+
+            delay_ = 0;
+        }
+
+        return queue_.read();
+    }
 
 private:
-    packet::timestamp_t queue_size_() const;
+    packet::timestamp_t queue_size_() const {
+        if (queue_.size() == 0) {
+            return 0;
+        }
 
-    packet::IPacketReader& reader_;
+        const packet::IAudioPacket* head =
+            static_cast<const packet::IAudioPacket*>(queue_.head().get());
+
+        const packet::IAudioPacket* tail =
+            static_cast<const packet::IAudioPacket*>(queue_.tail().get());
+
+        return (packet::timestamp_t)ROC_SUBTRACT(packet::signed_timestamp_t,
+                                                 tail->timestamp() + tail->num_samples(),
+                                                 head->timestamp());
+    }
+
+    Reader& reader_;
     packet::PacketQueue queue_;
     packet::timestamp_t delay_;
 };
 
+//! Audio packet delayer reading from any packet reader.
+typedef BasicDelayer<packet::IPacketReader> Delayer;
+
 } // namespace audio
 } // namespace roc
 
@@ -7,6 +7,8 @@
  * file, You can obtain one at http://mozilla.org/MPL/2.0/.
  */
 
+#include "roc_core/math.h"
+
 #include "roc_audio/freq_estimator.h"
 #include "roc_audio/freq_estimator_decim10_coeff.h"
 
@@ -29,6 +31,15 @@ const sample_t G_p = 100e-8f;
 // Integral gain of PI-controller.
 const sample_t G_i = 0.5e-8f;
 
+// Maximum deviation of frequency coefficient from 1. Keeps pitch change
+// unnoticeable when queue size is far from aim, e.g. when latency is being
+// grown after fast start.
+const sample_t G_max_coeff_delta = 0.005f;
+
+// Maximum deviation of queue size from aim, relative to aim, which is
+// accumulated by integrator.
+const sample_t G_i_band = 0.25f;
+
 // Calculates dot product of arrays IR of filter (@p coeff) and input array (@p samples).
 //
 // - @p coeff Filter impulse response.
@@ -65,6 +76,10 @@ FreqEstimator::FreqEstimator(packet::timestamp_t aim_queue_size)
     }
 }
 
+void FreqEstimator::set_aim_queue_size(packet::timestamp_t aim_queue_size) {
+    aim_ = (sample_t)aim_queue_size;
+}
+
 float FreqEstimator::freq_coeff() const {
     return coeff_;
 }
@@ -101,8 +116,18 @@ void FreqEstimator::update(packet::timestamp_t queue_size) {
 }
 
 float FreqEstimator::fast_controller_(const sample_t input) {
-    accum_ = accum_ + input - aim_;
-    return 1 + G_p * (input - aim_) + G_i * accum_;
+    const sample_t error = input - aim_;
+
+    // Large deviations occur when stream starts or aim is changed. Accumulating
+    // them would wind up integrator and cause large overshoot afterwards, so
+    // they're compensated by proportional term only.
+    if (ROC_ABS(error) <= aim_ * G_i_band) {
+        accum_ += error;
+    }
+
+    const sample_t delta = G_p * error + G_i * accum_;
+
+    return 1 + ROC_MAX(-G_max_coeff_delta, ROC_MIN(G_max_coeff_delta, delta));
 }
 
 } // namespace audio
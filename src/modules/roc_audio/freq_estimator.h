@@ -31,6 +31,9 @@ public:
     FreqEstimator(
         packet::timestamp_t aim_queue_size = ROC_CONFIG_DEFAULT_SESSION_LATENCY);
 
+    //! Set queue size we want to archive.
+    void set_aim_queue_size(packet::timestamp_t aim_queue_size);
+
     //! Compute new value of frequency coefficient.
     void update(packet::timestamp_t queue_size);
 
@@ -45,7 +48,7 @@ private:
     // `in' is current queue size.
     float fast_controller_(const sample_t in);
 
-    const sample_t aim_; // Aim queue size.
+    sample_t aim_; // Aim queue size.
 
     sample_t dec1_casc_buff_[FREQ_EST_DECIM_10_LEN];
     size_t dec1_ind_;
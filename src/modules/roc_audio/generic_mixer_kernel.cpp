@@ -0,0 +1,51 @@
+/*
+ * Copyright (c) 2015 Mikhail Baranov
+ * Copyright (c) 2015 Victor Gaydov
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "roc_audio/generic_mixer_kernel.h"
+
+namespace roc {
+namespace audio {
+
+using packet::sample_t;
+
+const char* GenericMixerKernel::name() const {
+    return "generic";
+}
+
+void GenericMixerKernel::mix(sample_t* out, const sample_t* in, size_t n) const {
+    for (size_t k = 0; k < n; k++) {
+        out[k] += in[k];
+    }
+}
+
+void GenericMixerKernel::clip(sample_t* out, size_t n) const {
+    for (size_t k = 0; k < n; k++) {
+        if (out[k] > 1) {
+            out[k] = 1;
+        } else if (out[k] < -1) {
+            out[k] = -1;
+        }
+    }
+}
+
+void GenericMixerKernel::interleave(sample_t* out,
+                                    const sample_t* in,
+                                    size_t num_channels,
+                                    size_t n) const {
+    for (size_t ch = 0; ch < num_channels; ch++) {
+        const sample_t* ch_in = in + ch * n;
+
+        for (size_t k = 0; k < n; k++) {
+            out[k * num_channels + ch] = ch_in[k];
+        }
+    }
+}
+
+} // namespace audio
+} // namespace roc
@@ -0,0 +1,70 @@
+/*
+ * Copyright (c) 2015 Mikhail Baranov
+ * Copyright (c) 2015 Victor Gaydov
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "roc_audio/generic_resampler_kernel.h"
+
+namespace roc {
+namespace audio {
+
+using packet::sample_t;
+
+const char* GenericResamplerKernel::name() const {
+    return "generic";
+}
+
+sample_t GenericResamplerKernel::forward(sample_t accum,
+                                         const sample_t* samples,
+                                         const float* lo,
+                                         const float* hi,
+                                         float fract,
+                                         size_t n) const {
+    for (size_t k = 0; k < n; k++) {
+        accum += samples[k] * (lo[k] + fract * (hi[k] - lo[k]));
+    }
+    return accum;
+}
+
+sample_t GenericResamplerKernel::backward(sample_t accum,
+                                          const sample_t* samples,
+                                          const float* lo,
+                                          const float* hi,
+                                          float fract,
+                                          size_t n) const {
+    for (size_t k = 0, t = n - 1; k < n; k++, t--) {
+        accum += samples[k] * (lo[t] + fract * (hi[t] - lo[t]));
+    }
+    return accum;
+}
+
+void GenericResamplerKernel::interpolate_forward(
+    float* taps, const float* lo, const float* hi, float fract, size_t n) const {
+    for (size_t k = 0; k < n; k++) {
+        taps[k] = lo[k] + fract * (hi[k] - lo[k]);
+    }
+}
+
+void GenericResamplerKernel::interpolate_backward(
+    float* taps, const float* lo, const float* hi, float fract, size_t n) const {
+    for (size_t k = 0, t = n - 1; k < n; k++, t--) {
+        taps[k] = lo[t] + fract * (hi[t] - lo[t]);
+    }
+}
+
+sample_t GenericResamplerKernel::dot(sample_t accum,
+                                     const sample_t* samples,
+                                     const float* taps,
+                                     size_t n) const {
+    for (size_t k = 0; k < n; k++) {
+        accum += samples[k] * taps[k];
+    }
+    return accum;
+}
+
+} // namespace audio
+} // namespace roc
@@ -0,0 +1,72 @@
+/*
+ * Copyright (c) 2015 Mikhail Baranov
+ * Copyright (c) 2015 Victor Gaydov
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+//! @file roc_audio/generic_resampler_kernel.h
+//! @brief Generic resampler kernel.
+
+#ifndef ROC_AUDIO_GENERIC_RESAMPLER_KERNEL_H_
+#define ROC_AUDIO_GENERIC_RESAMPLER_KERNEL_H_
+
+#include "roc_core/noncopyable.h"
+#include "roc_audio/iresampler_kernel.h"
+
+namespace roc {
+namespace audio {
+
+//! Generic resampler kernel.
+//! @remarks
+//!  Plain scalar implementation available on every platform. Taps are
+//!  accumulated one by one in sample order, so the result is exactly the
+//!  same as evaluating sinc() for every tap.
+class GenericResamplerKernel : public IResamplerKernel, public core::NonCopyable<> {
+public:
+    //! Get kernel name.
+    virtual const char* name() const;
+
+    //! Accumulate samples[k] * tap[k] for k in [0; n).
+    virtual packet::sample_t forward(packet::sample_t accum,
+                                     const packet::sample_t* samples,
+                                     const float* lo,
+                                     const float* hi,
+                                     float fract,
+                                     size_t n) const;
+
+    //! Accumulate samples[k] * tap[n - 1 - k] for k in [0; n).
+    virtual packet::sample_t backward(packet::sample_t accum,
+                                      const packet::sample_t* samples,
+                                      const float* lo,
+                                      const float* hi,
+                                      float fract,
+                                      size_t n) const;
+
+    //! Compute taps[k] = tap[k] for k in [0; n).
+    virtual void interpolate_forward(float* taps,
+                                     const float* lo,
+                                     const float* hi,
+                                     float fract,
+                                     size_t n) const;
+
+    //! Compute taps[k] = tap[n - 1 - k] for k in [0; n).
+    virtual void interpolate_backward(float* taps,
+                                      const float* lo,
+                                      const float* hi,
+                                      float fract,
+                                      size_t n) const;
+
+    //! Accumulate samples[k] * taps[k] for k in [0; n).
+    virtual packet::sample_t dot(packet::sample_t accum,
+                                 const packet::sample_t* samples,
+                                 const float* taps,
+                                 size_t n) const;
+};
+
+} // namespace audio
+} // namespace roc
+
+#endif // ROC_AUDIO_GENERIC_RESAMPLER_KERNEL_H_
@@ -0,0 +1,52 @@
+/*
+ * Copyright (c) 2015 Mikhail Baranov
+ * Copyright (c) 2015 Victor Gaydov
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+//! @file roc_audio/imixer_kernel.h
+//! @brief Mixer kernel interface.
+
+#ifndef ROC_AUDIO_IMIXER_KERNEL_H_
+#define ROC_AUDIO_IMIXER_KERNEL_H_
+
+#include "roc_core/stddefs.h"
+#include "roc_packet/units.h"
+
+namespace roc {
+namespace audio {
+
+//! Mixer kernel interface.
+//! @remarks
+//!  Implements sample loops used to mix and interleave streams.
+class IMixerKernel {
+public:
+    virtual ~IMixerKernel();
+
+    //! Get kernel name.
+    virtual const char* name() const = 0;
+
+    //! Compute out[k] += in[k] for k in [0; n).
+    virtual void
+    mix(packet::sample_t* out, const packet::sample_t* in, size_t n) const = 0;
+
+    //! Clamp out[k] to [-1; 1] for k in [0; n).
+    virtual void clip(packet::sample_t* out, size_t n) const = 0;
+
+    //! Interleave channels.
+    //! @remarks
+    //!  @p in contains @p num_channels runs of @p n samples, one per channel.
+    //!  Computes out[k * num_channels + ch] = in[ch * n + k].
+    virtual void interleave(packet::sample_t* out,
+                            const packet::sample_t* in,
+                            size_t num_channels,
+                            size_t n) const = 0;
+};
+
+} // namespace audio
+} // namespace roc
+
+#endif // ROC_AUDIO_IMIXER_KERNEL_H_
@@ -0,0 +1,84 @@
+/*
+ * Copyright (c) 2015 Mikhail Baranov
+ * Copyright (c) 2015 Victor Gaydov
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+//! @file roc_audio/iresampler_kernel.h
+//! @brief Resampler kernel interface.
+
+#ifndef ROC_AUDIO_IRESAMPLER_KERNEL_H_
+#define ROC_AUDIO_IRESAMPLER_KERNEL_H_
+
+#include "roc_core/stddefs.h"
+#include "roc_packet/units.h"
+
+namespace roc {
+namespace audio {
+
+//! Resampler kernel interface.
+//! @remarks
+//!  Computes dot product of a run of input samples and a run of sinc taps.
+//!  All taps in a run share the same fractional position, so every tap is
+//!  interpolated between @p lo[k] and @p hi[k] table values using the same
+//!  @p fract coefficient:
+//!  @code
+//!   tap[k] = lo[k] + fract * (hi[k] - lo[k])
+//!  @endcode
+class IResamplerKernel {
+public:
+    virtual ~IResamplerKernel();
+
+    //! Get kernel name.
+    virtual const char* name() const = 0;
+
+    //! Accumulate samples[k] * tap[k] for k in [0; n).
+    //! @returns
+    //!  @p accum plus computed dot product.
+    virtual packet::sample_t forward(packet::sample_t accum,
+                                     const packet::sample_t* samples,
+                                     const float* lo,
+                                     const float* hi,
+                                     float fract,
+                                     size_t n) const = 0;
+
+    //! Accumulate samples[k] * tap[n - 1 - k] for k in [0; n).
+    //! @returns
+    //!  @p accum plus computed dot product.
+    virtual packet::sample_t backward(packet::sample_t accum,
+                                      const packet::sample_t* samples,
+                                      const float* lo,
+                                      const float* hi,
+                                      float fract,
+                                      size_t n) const = 0;
+
+    //! Compute taps[k] = tap[k] for k in [0; n).
+    virtual void interpolate_forward(float* taps,
+                                     const float* lo,
+                                     const float* hi,
+                                     float fract,
+                                     size_t n) const = 0;
+
+    //! Compute taps[k] = tap[n - 1 - k] for k in [0; n).
+    virtual void interpolate_backward(float* taps,
+                                      const float* lo,
+                                      const float* hi,
+                                      float fract,
+                                      size_t n) const = 0;
+
+    //! Accumulate samples[k] * taps[k] for k in [0; n).
+    //! @returns
+    //!  @p accum plus computed dot product.
+    virtual packet::sample_t dot(packet::sample_t accum,
+                                 const packet::sample_t* samples,
+                                 const float* taps,
+                                 size_t n) const = 0;
+};
+
+} // namespace audio
+} // namespace roc
+
+#endif // ROC_AUDIO_IRESAMPLER_KERNEL_H_
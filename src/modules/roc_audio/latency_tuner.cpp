@@ -0,0 +1,116 @@
+/*
+ * Copyright (c) 2015 Mikhail Baranov
+ * Copyright (c) 2015 Victor Gaydov
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "roc_core/panic.h"
+#include "roc_core/log.h"
+
+#include "roc_audio/latency_tuner.h"
+
+namespace roc {
+namespace audio {
+
+namespace {
+
+enum { ReportInterval = 5000 /* ms */ };
+
+// Ratio between target latency and interarrival jitter. Jitter estimator
+// gain is 1/16, so single packet delayed by D samples increases jitter at
+// least by D/16 - jitter/16, and 16 * jitter covers that delay.
+const float G_jitter_factor = 16;
+
+} // namespace
+
+LatencyTuner::LatencyTuner(const packet::JitterMeter& meter,
+                           Scaler& scaler,
+                           packet::timestamp_t min_latency,
+                           packet::timestamp_t max_latency,
+                           size_t fec_block_packets,
+                           size_t decay_ticks)
+    : meter_(meter)
+    , scaler_(scaler)
+    , min_latency_(min_latency)
+    , max_latency_(max_latency)
+    , fec_block_packets_(fec_block_packets)
+    , decay_ticks_(decay_ticks)
+    , num_lost_(0)
+    , loss_countdown_(0)
+    , target_((float)scaler.aim_queue_size())
+    , timer_(ReportInterval) {
+    if (min_latency_ > max_latency_) {
+        roc_panic("latency tuner: min latency is greater than max latency "
+                  "(min_latency=%lu, max_latency=%lu)",
+                  (unsigned long)min_latency_, (unsigned long)max_latency_);
+    }
+
+    if (decay_ticks_ == 0) {
+        roc_panic("latency tuner: decay ticks is zero");
+    }
+}
+
+bool LatencyTuner::update() {
+    if (meter_.num_received() == 0) {
+        return true;
+    }
+
+    const float jitter = meter_.jitter();
+
+    if (meter_.num_lost() != num_lost_) {
+        num_lost_ = meter_.num_lost();
+        loss_countdown_ = decay_ticks_;
+    } else if (loss_countdown_ != 0) {
+        loss_countdown_--;
+    }
+
+    // Packet being played is always partially consumed, so we need at least
+    // one packet in addition to jitter.
+    const packet::timestamp_t packet_samples = meter_.packet_samples();
+
+    float target = G_jitter_factor * jitter + (float)packet_samples;
+
+    if (loss_countdown_ != 0 && fec_block_packets_ != 0) {
+        const float fec_latency = (float)fec_block_packets_ * (float)packet_samples;
+
+        if (target < fec_latency) {
+            target = fec_latency;
+        }
+    }
+
+    if (target < (float)min_latency_) {
+        target = (float)min_latency_;
+    }
+
+    if (target > (float)max_latency_) {
+        target = (float)max_latency_;
+    }
+
+    // Target grows immediately, but decreases slowly. This keeps latency
+    // large enough after jitter spikes, and doesn't ask scaler for large
+    // steps which it would overshoot.
+    if (target > target_) {
+        target_ = target;
+    } else {
+        target_ -= (target_ - target) / (float)decay_ticks_;
+    }
+
+    scaler_.set_aim_queue_size((packet::timestamp_t)target_);
+
+    if (timer_.expired()) {
+        roc_log(LOG_TRACE, "latency tuner: jitter=%.1lf lost=%lu target=%lu",
+                (double)jitter, (unsigned long)num_lost_, (unsigned long)target_);
+    }
+
+    return true;
+}
+
+packet::timestamp_t LatencyTuner::target_latency() const {
+    return (packet::timestamp_t)target_;
+}
+
+} // namespace audio
+} // namespace roc
@@ -0,0 +1,87 @@
+/*
+ * Copyright (c) 2015 Mikhail Baranov
+ * Copyright (c) 2015 Victor Gaydov
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+//! @file roc_audio/latency_tuner.h
+//! @brief Latency tuner.
+
+#ifndef ROC_AUDIO_LATENCY_TUNER_H_
+#define ROC_AUDIO_LATENCY_TUNER_H_
+
+#include "roc_core/noncopyable.h"
+#include "roc_core/timer.h"
+
+#include "roc_packet/imonitor.h"
+#include "roc_packet/jitter_meter.h"
+#include "roc_packet/units.h"
+
+#include "roc_audio/scaler.h"
+
+namespace roc {
+namespace audio {
+
+//! Latency tuner.
+//!
+//! Moves aim queue size of scaler according to network conditions measured
+//! by jitter meter:
+//!  - target latency follows peak interarrival jitter, and decays slowly
+//!    when jitter goes down;
+//!  - if FEC is used and packets are being lost, target latency is kept
+//!    large enough to receive whole FEC block before its first packet
+//!    should be played;
+//!  - target latency is bounded by [min_latency; max_latency].
+class LatencyTuner : public packet::IMonitor, public core::NonCopyable<> {
+public:
+    //! Initialize.
+    //!
+    //! @b Parameters
+    //!  - @p meter is used to obtain jitter and losses;
+    //!  - @p scaler is updated with target latency;
+    //!  - @p min_latency and @p max_latency define target latency bounds
+    //!    as number of samples;
+    //!  - @p fec_block_packets is number of packets in FEC block, or zero
+    //!    if FEC is not used;
+    //!  - @p decay_ticks is time constant, in ticks, with which target
+    //!    latency decreases after jitter goes down or losses stop.
+    LatencyTuner(const packet::JitterMeter& meter,
+                 Scaler& scaler,
+                 packet::timestamp_t min_latency,
+                 packet::timestamp_t max_latency,
+                 size_t fec_block_packets,
+                 size_t decay_ticks);
+
+    //! Recompute target latency and pass it to scaler.
+    //! @returns
+    //!  always true.
+    virtual bool update();
+
+    //! Get current target latency as number of samples.
+    packet::timestamp_t target_latency() const;
+
+private:
+    const packet::JitterMeter& meter_;
+    Scaler& scaler_;
+
+    const packet::timestamp_t min_latency_;
+    const packet::timestamp_t max_latency_;
+
+    const size_t fec_block_packets_;
+    const size_t decay_ticks_;
+
+    size_t num_lost_;
+    size_t loss_countdown_;
+
+    float target_;
+
+    core::Timer timer_;
+};
+
+} // namespace audio
+} // namespace roc
+
+#endif // ROC_AUDIO_LATENCY_TUNER_H_
@@ -15,7 +15,9 @@
 namespace roc {
 namespace audio {
 
-Mixer::Mixer(ISampleBufferComposer& composer) {
+Mixer::Mixer(ISampleBufferComposer& composer, bool clipping, IMixerKernel& kernel)
+    : kernel_(kernel)
+    , clipping_(clipping) {
     if (!(temp_ = composer.compose())) {
         roc_panic("mixer: can't compose buffer in constructor");
     }
@@ -41,21 +43,29 @@ void Mixer::read(const ISampleBufferSlice& out) {
         return;
     }
 
-    memset(out_data, 0, out_sz * sizeof(packet::sample_t));
+    IStreamReader* reader = readers_.front();
+
+    if (!reader) {
+        memset(out_data, 0, out_sz * sizeof(packet::sample_t));
+        return;
+    }
+
+    // First stream is read directly into output, so that mixing a single
+    // stream costs no extra copy.
+    reader->read(out);
 
     temp_->set_size(out_sz);
 
-    for (IStreamReader* reader = readers_.front(); reader;
-         reader = readers_.next(*reader)) {
+    for (reader = readers_.next(*reader); reader; reader = readers_.next(*reader)) {
         reader->read(*temp_);
 
         roc_panic_if(temp_->size() != out_sz);
 
-        packet::sample_t* temp_data = temp_->data();
+        kernel_.mix(out_data, temp_->data(), out_sz);
+    }
 
-        for (size_t n = 0; n < out_sz; n++) {
-            out_data[n] += temp_data[n];
-        }
+    if (clipping_) {
+        kernel_.clip(out_data, out_sz);
     }
 }
 
@@ -20,6 +20,8 @@
 
 #include "roc_audio/sample_buffer.h"
 #include "roc_audio/istream_reader.h"
+#include "roc_audio/imixer_kernel.h"
+#include "roc_audio/default_mixer_kernel.h"
 
 namespace roc {
 namespace audio {
@@ -38,10 +40,20 @@ namespace audio {
 //! @code
 //!  5, 7, 9, ...
 //! @endcode
+//!
+//! If clipping is enabled, output samples are clamped to [-1; 1] after
+//! mixing, so that overflow doesn't wrap when converting to integer PCM.
 class Mixer : public IStreamReader, public core::NonCopyable<> {
 public:
     //! Initialize.
-    explicit Mixer(ISampleBufferComposer& composer = default_buffer_composer());
+    //!
+    //! @b Parameters
+    //!  - @p composer is used to construct temporary buffer
+    //!  - @p clipping enables clamping of mixed samples to [-1; 1]
+    //!  - @p kernel implements sample loops
+    explicit Mixer(ISampleBufferComposer& composer = default_buffer_composer(),
+                   bool clipping = false,
+                   IMixerKernel& kernel = default_mixer_kernel());
 
     //! Read samples from output stream.
     virtual void read(const ISampleBufferSlice&);
@@ -56,6 +68,9 @@ private:
     core::List<IStreamReader, core::NoOwnership> readers_;
 
     ISampleBufferPtr temp_;
+
+    IMixerKernel& kernel_;
+    const bool clipping_;
 };
 
 } // namespace audio
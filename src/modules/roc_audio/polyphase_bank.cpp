@@ -0,0 +1,140 @@
+/*
+ * Copyright (c) 2015 Mikhail Baranov
+ * Copyright (c) 2015 Victor Gaydov
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <new>
+
+#include "roc_core/panic.h"
+#include "roc_core/log.h"
+#include "roc_core/helpers.h"
+#include "roc_core/singleton.h"
+#include "roc_core/mutex.h"
+
+#include "roc_audio/polyphase_bank.h"
+#include "roc_audio/sinc_table.h"
+
+namespace roc {
+namespace audio {
+
+namespace {
+
+// Number of distinct bank sizes (powers of two up to MaxPhases).
+const size_t MaxBanks = 13;
+
+// Computes sinc for distance (in input samples) from output sample.
+// Uses the same linear interpolation between table values as Resampler.
+double sinc(double distance) {
+    const double x = distance * (double)st_Nwindow_interp;
+    const size_t i = (size_t)x;
+
+    if (i + 1 >= ROC_ARRAY_SIZE(sinc_table)) {
+        return 0;
+    }
+
+    const double f = x - (double)i;
+    return (double)sinc_table[i] + f * ((double)sinc_table[i + 1] - (double)sinc_table[i]);
+}
+
+size_t bank_index(size_t num_phases) {
+    size_t n = 0;
+    while ((size_t(1) << n) < num_phases) {
+        n++;
+    }
+    return n;
+}
+
+class PolyphaseBankRegistry : public core::NonCopyable<> {
+public:
+    PolyphaseBankRegistry() {
+        for (size_t n = 0; n < MaxBanks; n++) {
+            banks_[n] = NULL;
+        }
+    }
+
+    const PolyphaseBank& get(size_t num_phases) {
+        core::Mutex::Lock lock(mutex_);
+
+        const size_t n = bank_index(num_phases);
+        roc_panic_if(n >= MaxBanks);
+
+        if (!banks_[n]) {
+            banks_[n] = new (std::nothrow) PolyphaseBank(num_phases);
+            if (!banks_[n]) {
+                roc_panic("polyphase bank: can't allocate bank");
+            }
+        }
+
+        return *banks_[n];
+    }
+
+private:
+    core::Mutex mutex_;
+    PolyphaseBank* banks_[MaxBanks];
+};
+
+} // namespace
+
+PolyphaseBank::PolyphaseBank(size_t num_phases)
+    : num_phases_(num_phases)
+    , taps_(NULL) {
+    roc_panic_if(HalfWindow != st_Nwindow);
+
+    if (!valid_num_phases(num_phases)) {
+        roc_panic("polyphase bank: number of phases should be a power of two"
+                  " in range [%u; %u], got %u",
+                  (unsigned)MinPhases, (unsigned)MaxPhases, (unsigned)num_phases);
+    }
+
+    roc_log(LOG_DEBUG, "polyphase bank: building bank with %u phases",
+            (unsigned)num_phases);
+
+    taps_ = new (std::nothrow) float[num_phases * NumTaps];
+    if (!taps_) {
+        roc_panic("polyphase bank: can't allocate %u taps",
+                  (unsigned)(num_phases * NumTaps));
+    }
+
+    for (size_t p = 0; p < num_phases; p++) {
+        const double fract = (double)p / (double)num_phases;
+
+        float* taps = taps_ + p * NumTaps;
+
+        // Left side of window, distance decreases from (HalfWindow - 1 + fract)
+        // down to fract.
+        for (size_t j = 0; j < HalfWindow; j++) {
+            taps[j] = (float)sinc(double(HalfWindow - 1 - j) + fract);
+        }
+
+        // Right side of window, distance increases from (1 - fract).
+        for (size_t j = 0; j < HalfWindow; j++) {
+            taps[HalfWindow + j] = (float)sinc(double(j + 1) - fract);
+        }
+    }
+}
+
+PolyphaseBank::~PolyphaseBank() {
+    delete[] taps_;
+}
+
+bool PolyphaseBank::valid_num_phases(size_t num_phases) {
+    if (num_phases < MinPhases || num_phases > MaxPhases) {
+        return false;
+    }
+    return (num_phases & (num_phases - 1)) == 0;
+}
+
+const PolyphaseBank& PolyphaseBank::instance(size_t num_phases) {
+    if (!valid_num_phases(num_phases)) {
+        roc_panic("polyphase bank: unsupported number of phases: %u",
+                  (unsigned)num_phases);
+    }
+    return core::Singleton<PolyphaseBankRegistry>::instance().get(num_phases);
+}
+
+} // namespace audio
+} // namespace roc
@@ -0,0 +1,80 @@
+/*
+ * Copyright (c) 2015 Mikhail Baranov
+ * Copyright (c) 2015 Victor Gaydov
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+//! @file roc_audio/polyphase_bank.h
+//! @brief Polyphase filter bank.
+
+#ifndef ROC_AUDIO_POLYPHASE_BANK_H_
+#define ROC_AUDIO_POLYPHASE_BANK_H_
+
+#include "roc_core/noncopyable.h"
+#include "roc_core/stddefs.h"
+
+namespace roc {
+namespace audio {
+
+//! Polyphase filter bank.
+//! @remarks
+//!  Contains sinc taps precomputed for a fixed set of fractional positions
+//!  (phases) of output sample between two input samples. Every phase holds
+//!  taps for the whole window, so an output sample is computed as a single
+//!  dot product without interpolation between table values.
+//!
+//!  For phase @c p, taps(p)[j] is the weight of input sample with index
+//!  @c (i - HalfWindow + 1 + j), where @c i is the nearest input sample on
+//!  the left of output sample, and @c p / num_phases() is the distance
+//!  between them.
+class PolyphaseBank : public core::NonCopyable<> {
+public:
+    //! Number of input samples on each side of output sample.
+    static const size_t HalfWindow = 64;
+
+    //! Number of taps per phase.
+    static const size_t NumTaps = HalfWindow * 2;
+
+    //! Minimum allowed number of phases.
+    static const size_t MinPhases = 16;
+
+    //! Maximum allowed number of phases.
+    static const size_t MaxPhases = 4096;
+
+    //! Build bank.
+    //! @remarks
+    //!  @p num_phases should be a power of two in range [MinPhases; MaxPhases].
+    explicit PolyphaseBank(size_t num_phases);
+
+    ~PolyphaseBank();
+
+    //! Check if number of phases is supported.
+    static bool valid_num_phases(size_t num_phases);
+
+    //! Get shared bank with given number of phases.
+    //! @remarks
+    //!  Bank is built on first request and then reused.
+    static const PolyphaseBank& instance(size_t num_phases);
+
+    //! Get number of phases.
+    size_t num_phases() const {
+        return num_phases_;
+    }
+
+    //! Get taps for given phase.
+    const float* taps(size_t phase) const {
+        return taps_ + phase * NumTaps;
+    }
+
+private:
+    const size_t num_phases_;
+    float* taps_;
+};
+
+} // namespace audio
+} // namespace roc
+
+#endif // ROC_AUDIO_POLYPHASE_BANK_H_
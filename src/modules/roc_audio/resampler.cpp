@@ -9,9 +9,12 @@
 
 #include "roc_core/panic.h"
 #include "roc_core/log.h"
+#include "roc_core/stddefs.h"
 
 #include "roc_audio/resampler.h"
 #include "roc_audio/sinc_table.h"
+#include "roc_audio/sinc_phase_table.h"
+#include "roc_audio/polyphase_bank.h"
 
 namespace roc {
 namespace audio {
@@ -65,22 +68,18 @@ inline float fractional(const fixedpoint_t x) {
     return (float)(x & FRACT_PART_MASK) * ((float)1. / (float)G_qt_one);
 }
 
-// Computes sinc value in x position using linear interpolation between
-// table values from sinc_table.h
+// Returns phase of sinc_table corresponding to x.
 //
 // During going through input signal window only integer part of argument changes,
-// that's why there are two arguments in this function: integer part and fractional
-// part of time coordinate.
-inline sample_t sinc(const fixedpoint_t x, const float fract_x) {
-    roc_panic_if(x > (st_Nwindow << FRACT_BIT_COUNT));
-
-    // Tables index smaller than to x
-    const sample_t hl = sinc_table[(x >> (FRACT_BIT_COUNT - FRACT_BIT_TO_INDEX))];
-
-    // Tables index next to x
-    const sample_t hh = sinc_table[(x >> (FRACT_BIT_COUNT - FRACT_BIT_TO_INDEX)) + 1];
+// so the phase and the fractional part used for linear interpolation between
+// table values are the same for all taps on one side of the window.
+inline size_t sinc_phase(const fixedpoint_t x) {
+    return (x >> (FRACT_BIT_COUNT - FRACT_BIT_TO_INDEX)) & (st_Nwindow_interp - 1);
+}
 
-    return hl + fract_x * (hh - hl);
+// Returns fractional part of sinc_table index corresponding to x.
+inline float sinc_fract(const fixedpoint_t x) {
+    return fractional(x << FRACT_BIT_TO_INDEX);
 }
 
 //! How many input samples fits into length of half window.
@@ -97,9 +96,16 @@ const fixedpoint_t G_default_sample = float_to_fixedpoint(0);
 
 Resampler::Resampler(IStreamReader& reader,
                      ISampleBufferComposer& composer,
-                     size_t frame_size)
+                     size_t frame_size,
+                     IResamplerKernel& kernel,
+                     const PolyphaseBank* bank,
+                     size_t num_channels)
     : reader_(reader)
-    , window_(3)
+    , table_(SincPhaseTable::instance())
+    , kernel_(kernel)
+    , bank_(bank)
+    , bank_phase_shift_(FRACT_BIT_COUNT)
+    , num_channels_(num_channels)
     , frame_size_(frame_size)
     , qt_frame_size_(fixedpoint_t(frame_size_ << FRACT_BIT_COUNT))
     , qt_sample_(G_default_sample)
@@ -112,6 +118,22 @@ Resampler::Resampler(IStreamReader& reader,
         >= (INTEGER_PART_MASK + FRACT_PART_MASK))
         roc_panic("frame_size_ doesn't fit to integral part of fixedpoint type.");
 
+    if (num_channels_ == 0 || num_channels_ > MaxChannels) {
+        roc_panic("resampler: number of channels should be in range [1; %u], got %u",
+                  (unsigned)MaxChannels, (unsigned)num_channels_);
+    }
+
+    if (bank_) {
+        roc_panic_if_not(PolyphaseBank::valid_num_phases(bank_->num_phases()));
+        roc_panic_if(PolyphaseBank::HalfWindow != st_Nwindow);
+        roc_panic_if(PolyphaseBank::NumTaps > MaxTaps);
+
+        while ((size_t(1) << (FRACT_BIT_COUNT - bank_phase_shift_))
+               < bank_->num_phases()) {
+            bank_phase_shift_--;
+        }
+    }
+
     init_window_(composer);
 
     roc_panic_if_not(set_scaling(1.0f));
@@ -131,37 +153,71 @@ void Resampler::read(const ISampleBufferSlice& buff) {
     sample_t* buff_data = buff.data();
     roc_panic_if(buff_data == NULL);
 
-    size_t buff_size = buff.size();
+    if (buff.size() % num_channels_ != 0) {
+        roc_panic("resampler: attempting to read number of samples which is "
+                  "not multiple of number of channels "
+                  "(num_samples=%u, num_channels=%u)",
+                  (unsigned)buff.size(), (unsigned)num_channels_);
+    }
+
+    const size_t buff_size = buff.size() / num_channels_;
 
     if (curr_frame_ == NULL) {
         qt_sample_ = G_default_sample;
         renew_window_();
     }
 
-    for (size_t n = 0; n < buff_size; n++) {
+    size_t n = 0;
+
+    while (n < buff_size) {
         if (qt_sample_ >= qt_frame_size_) {
             qt_sample_ -= qt_frame_size_;
             renew_window_();
         }
 
-        buff_data[n] = resample_();
-        qt_sample_ += qt_dt_;
+        const size_t n_run = run_length_(buff_size - n);
+
+        if (bank_) {
+            for (const size_t end = n + n_run; n < end; n++) {
+                resample_polyphase_(buff_data + n * num_channels_);
+                qt_sample_ += qt_dt_;
+            }
+        } else if (num_channels_ == 1) {
+            for (const size_t end = n + n_run; n < end; n++) {
+                buff_data[n] = resample_();
+                qt_sample_ += qt_dt_;
+            }
+        } else {
+            for (const size_t end = n + n_run; n < end; n++) {
+                resample_multichannel_(buff_data + n * num_channels_);
+                qt_sample_ += qt_dt_;
+            }
+        }
     }
 }
 
 void Resampler::init_window_(ISampleBufferComposer& composer) {
     roc_log(LOG_TRACE, "resampler: initializing window");
 
-    for (size_t n = 0; n < window_.size(); n++) {
-        if (!(window_[n] = composer.compose())) {
-            roc_panic("resampler: can't compose buffer in constructor");
-        }
-        window_[n]->set_size(frame_size_);
+    if (frame_size_ > MaxFrameSize) {
+        roc_panic("resampler: frame size should be <= %u, got %u",
+                  (unsigned)MaxFrameSize, (unsigned)frame_size_);
+    }
+
+    if (!(frame_ = composer.compose())) {
+        roc_panic("resampler: can't compose buffer in constructor");
+    }
+
+    if (frame_->max_size() < frame_size_ * num_channels_) {
+        roc_panic("resampler: frame doesn't fit into buffer: "
+                  "(frame_size=%u, num_channels=%u, max_buffer_size=%u)",
+                  (unsigned)frame_size_, (unsigned)num_channels_,
+                  (unsigned)frame_->max_size());
     }
 
-    prev_frame_ = NULL;
+    frame_->set_size(frame_size_ * num_channels_);
+
     curr_frame_ = NULL;
-    next_frame_ = NULL;
 }
 
 void Resampler::renew_window_() {
@@ -171,33 +227,61 @@ void Resampler::renew_window_() {
     qt_dt_ = float_to_fixedpoint(scaling_);
 
     if (curr_frame_ == NULL) {
-        reader_.read(*window_[0]);
-        reader_.read(*window_[1]);
-        reader_.read(*window_[2]);
+        for (size_t n = 0; n < NumFrames; n++) {
+            read_frame_(frame_size_ * n);
+        }
     } else {
-        window_.rotate(1);
-        reader_.read(*window_.back());
-        roc_panic_if(window_.back()->size() != frame_size_);
+        for (size_t ch = 0; ch < num_channels_; ch++) {
+            sample_t* data = window_ + window_size_() * ch;
+
+            memmove(data, data + frame_size_,
+                    frame_size_ * (NumFrames - 1) * sizeof(sample_t));
+        }
+
+        read_frame_(frame_size_ * (NumFrames - 1));
     }
 
-    prev_frame_ = window_[0]->data();
-    curr_frame_ = window_[1]->data();
-    next_frame_ = window_[2]->data();
+    curr_frame_ = window_ + frame_size_;
 }
 
-sample_t Resampler::resample_() {
-    // Index of first input sample in window.
-    size_t ind_begin_prev;
+void Resampler::read_frame_(size_t offset) {
+    reader_.read(*frame_);
+    roc_panic_if(frame_->size() != frame_size_ * num_channels_);
+
+    const sample_t* frame_data = frame_->data();
+
+    if (num_channels_ == 1) {
+        memcpy(window_ + offset, frame_data, frame_size_ * sizeof(sample_t));
+        return;
+    }
 
-    // Window lasts till that index.
-    const size_t ind_end_prev = frame_size_;
+    // Window stores every channel contiguously, so deinterleave input frame.
+    for (size_t ch = 0; ch < num_channels_; ch++) {
+        sample_t* data = window_ + window_size_() * ch + offset;
 
-    size_t ind_begin_cur;
-    size_t ind_end_cur;
+        for (size_t n = 0; n < frame_size_; n++) {
+            data[n] = frame_data[n * num_channels_ + ch];
+        }
+    }
+}
+
+size_t Resampler::window_size_() const {
+    return frame_size_ * NumFrames;
+}
 
-    const size_t ind_begin_next = 0;
-    size_t ind_end_next;
+size_t Resampler::run_length_(size_t max_samples) const {
+    if (qt_dt_ == 0) {
+        return max_samples;
+    }
+
+    // Number of output samples before qt_sample_ leaves current frame.
+    const uint64_t n_samples =
+        ((uint64_t)(qt_frame_size_ - qt_sample_) + qt_dt_ - 1) / qt_dt_;
+
+    return n_samples < max_samples ? (size_t)n_samples : max_samples;
+}
 
+Resampler::fixedpoint_t Resampler::sinc_position_() {
     if ((qt_sample_ & FRACT_PART_MASK) < G_qt_epsilon) {
         qt_sample_ &= INTEGER_PART_MASK;
     } else if ((G_qt_one - (qt_sample_ & FRACT_PART_MASK)) < G_qt_epsilon) {
@@ -205,86 +289,108 @@ sample_t Resampler::resample_() {
         qt_sample_ += G_qt_one;
     }
 
-    ind_begin_prev = (qt_sample_ >= G_qt_half_window_len)
-        ? frame_size_
-        : fixedpoint_to_size(qceil(qt_sample_ + (qt_frame_size_ - G_qt_half_window_len)));
-    roc_panic_if(ind_begin_prev > frame_size_);
-
-    ind_begin_cur = (qt_sample_ >= G_qt_half_window_len)
-        ? fixedpoint_to_size(qceil(qt_sample_ - G_qt_half_window_len))
-        : 0;
-    roc_panic_if(ind_begin_cur > frame_size_);
-
-    ind_end_cur = ((qt_sample_ + G_qt_half_window_len) > qt_frame_size_)
-        ? frame_size_
-        : fixedpoint_to_size(qfloor(qt_sample_ + G_qt_half_window_len));
-    roc_panic_if(ind_end_cur > frame_size_);
-
-    ind_end_next = ((qt_sample_ + G_qt_half_window_len) > qt_frame_size_)
-        ? fixedpoint_to_size(qfloor(qt_sample_ + G_qt_half_window_len - qt_frame_size_))
-        : 0;
-    roc_panic_if(ind_end_next > frame_size_);
-
     // Counter inside window.
     // t_sinc = t_sample - ceil( t_sample - st_Nwindow + 1/st_Nwindow_interp )
-    fixedpoint_t qt_sinc_cur = qt_frame_size_ + qt_sample_
+    const fixedpoint_t qt_sinc_cur = qt_frame_size_ + qt_sample_
         - qceil(qt_frame_size_ + qt_sample_ - G_qt_half_window_len);
 
-    // sinc_table defined in positive half-plane, so at the begining of the window
-    // qt_sinc_cur starts decreasing and after we cross 0 it will be increasing
-    // till the end of the window.
-    signed_fixedpoint_t qt_sinc_inc = -((signed_fixedpoint_t)G_qt_one);
+    roc_panic_if(qt_sinc_cur > (st_Nwindow << FRACT_BIT_COUNT));
 
-    // Compute fractional part of time position at the begining. It wont change during
-    // the run.
-    float f_sinc_cur_fract = fractional(qt_sinc_cur << FRACT_BIT_TO_INDEX);
-    sample_t accumulator = 0;
-
-    size_t i;
+    return qt_sinc_cur;
+}
 
-    // Run through previous frame.
-    for (i = ind_begin_prev; i < ind_end_prev; ++i) {
-        accumulator += prev_frame_[i] * sinc(qt_sinc_cur, f_sinc_cur_fract);
-        qt_sinc_cur += (fixedpoint_t)qt_sinc_inc;
-    }
+sample_t Resampler::resample_() {
+    fixedpoint_t qt_sinc_cur = sinc_position_();
 
-    // Run through current frame through the left windows side. qt_sinc_cur is decreasing.
-    i = ind_begin_cur;
+    // sinc_table defined in positive half-plane, so at the begining of the window
+    // qt_sinc_cur starts decreasing and after we cross 0 it will be increasing
+    // till the end of the window.
+    //
+    // Only integer part of qt_sinc_cur changes during the run, so all taps on one
+    // side of the window share the same phase of sinc table and are passed to
+    // kernel at once.
 
-    accumulator += curr_frame_[i] * sinc(qt_sinc_cur, f_sinc_cur_fract);
-    while (qt_sinc_cur >= G_qt_one) {
-        ++i;
-        qt_sinc_cur += (fixedpoint_t)qt_sinc_inc;
-        accumulator += curr_frame_[i] * sinc(qt_sinc_cur, f_sinc_cur_fract);
-    }
+    // Input sample nearest to the output sample from the left. Frames are stored
+    // contiguously, so the window may freely cross frame boundaries.
+    const sample_t* center = curr_frame_ + fixedpoint_to_size(qt_sample_);
 
-    ++i;
+    // Run through left side of the window. Taps go from (n_left - 1) down to 0.
+    const size_t n_left = fixedpoint_to_size(qt_sinc_cur) + 1;
 
-    roc_panic_if(i > frame_size_);
-    // Run through right side of the window, increasing qt_sinc_cur.
-    qt_sinc_inc = -qt_sinc_inc;
+    sample_t accumulator = kernel_.backward(
+        0, center - (n_left - 1), table_.lo(sinc_phase(qt_sinc_cur)),
+        table_.hi(sinc_phase(qt_sinc_cur)), sinc_fract(qt_sinc_cur), n_left);
 
     // Crossing zero -- we just need to switch qt_sinc_cur.
     // -1 ------------ 0 ------------- +1
     //      ^                  ^
     //      |                  |
     //   -qt_sinc_cur  ->  +qt_sinc_cur     <=> qt_sinc_cur = 1 - qt_sinc_cur
-    qt_sinc_cur = G_qt_one - qt_sinc_cur; // qt_sinc_cur = -qt_sinc_cur + 1;
-    f_sinc_cur_fract = fractional(qt_sinc_cur << FRACT_BIT_TO_INDEX);
+    qt_sinc_cur = G_qt_one - (qt_sinc_cur & FRACT_PART_MASK);
 
-    for (; i < ind_end_cur; ++i) {
-        accumulator += curr_frame_[i] * sinc(qt_sinc_cur, f_sinc_cur_fract);
-        qt_sinc_cur += (fixedpoint_t)qt_sinc_inc;
-    }
+    // Run through right side of the window. Taps go from floor(qt_sinc_cur) up.
+    const size_t n_right = st_Nwindow - 1;
+    const size_t tap_right = fixedpoint_to_size(qt_sinc_cur);
 
-    // Next frames run.
-    for (i = ind_begin_next; i < ind_end_next; ++i) {
-        accumulator += next_frame_[i] * sinc(qt_sinc_cur, f_sinc_cur_fract);
-        qt_sinc_cur += (fixedpoint_t)qt_sinc_inc;
-    }
+    accumulator = kernel_.forward(
+        accumulator, center + 1, table_.lo(sinc_phase(qt_sinc_cur)) + tap_right,
+        table_.hi(sinc_phase(qt_sinc_cur)) + tap_right, sinc_fract(qt_sinc_cur),
+        n_right);
 
     return accumulator;
 }
 
+void Resampler::resample_multichannel_(sample_t* out) {
+    fixedpoint_t qt_sinc_cur = sinc_position_();
+
+    // Same window as in resample_(), but taps are interpolated only once and
+    // then applied to every channel.
+    const size_t n_left = fixedpoint_to_size(qt_sinc_cur) + 1;
+    const size_t n_right = st_Nwindow - 1;
+
+    roc_panic_if(n_left + n_right > MaxTaps);
+
+    kernel_.interpolate_backward(taps_, table_.lo(sinc_phase(qt_sinc_cur)),
+                                 table_.hi(sinc_phase(qt_sinc_cur)),
+                                 sinc_fract(qt_sinc_cur), n_left);
+
+    qt_sinc_cur = G_qt_one - (qt_sinc_cur & FRACT_PART_MASK);
+
+    const size_t tap_right = fixedpoint_to_size(qt_sinc_cur);
+
+    kernel_.interpolate_forward(taps_ + n_left,
+                                table_.lo(sinc_phase(qt_sinc_cur)) + tap_right,
+                                table_.hi(sinc_phase(qt_sinc_cur)) + tap_right,
+                                sinc_fract(qt_sinc_cur), n_right);
+
+    const size_t begin = frame_size_ + fixedpoint_to_size(qt_sample_) - (n_left - 1);
+
+    for (size_t ch = 0; ch < num_channels_; ch++) {
+        out[ch] =
+            kernel_.dot(0, window_ + window_size_() * ch + begin, taps_, n_left + n_right);
+    }
+}
+
+void Resampler::resample_polyphase_(sample_t* out) {
+    // Round position of output sample to the nearest bank phase.
+    const fixedpoint_t qt_sample =
+        qt_sample_ + (fixedpoint_t(1) << (bank_phase_shift_ - 1));
+
+    const size_t phase = (qt_sample & FRACT_PART_MASK) >> bank_phase_shift_;
+    roc_panic_if(phase >= bank_->num_phases());
+
+    const float* taps = bank_->taps(phase);
+
+    // Window covers NumTaps input samples, and ends with HalfWindow samples on
+    // the right of the nearest input sample.
+    const size_t begin =
+        frame_size_ + fixedpoint_to_size(qt_sample) - (PolyphaseBank::HalfWindow - 1);
+
+    for (size_t ch = 0; ch < num_channels_; ch++) {
+        out[ch] = kernel_.dot(0, window_ + window_size_() * ch + begin, taps,
+                              PolyphaseBank::NumTaps);
+    }
+}
+
 } // namespace audio
 } // namespace roc
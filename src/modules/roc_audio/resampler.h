@@ -13,30 +13,53 @@
 #ifndef ROC_AUDIO_RESAMPLER_H_
 #define ROC_AUDIO_RESAMPLER_H_
 
+#include "roc_config/config.h"
+
 #include "roc_core/noncopyable.h"
 #include "roc_core/stddefs.h"
-#include "roc_core/circular_buffer.h"
 
 #include "roc_audio/sample_buffer.h"
 #include "roc_audio/istream_reader.h"
+#include "roc_audio/iresampler_kernel.h"
+#include "roc_audio/default_resampler_kernel.h"
 
 namespace roc {
 namespace audio {
 
+class SincPhaseTable;
+class PolyphaseBank;
+
 //! Resamples audio stream with non-integer dynamically changing factor.
 //! @remarks
 //!  Typicaly being used with factor close to 1 ( 0.9 < factor < 1.1 ).
+//!
+//!  By default, sinc taps are interpolated from sinc table for exact position
+//!  of every output sample. If polyphase filter bank is provided, position of
+//!  output sample is rounded to the nearest bank phase and precomputed taps
+//!  are used instead, which is cheaper but introduces small phase error
+//!  depending on number of phases.
+//!
+//!  Multiple channels may be resampled at once from interleaved stream. In this
+//!  case taps are computed once per output sample and applied to all channels.
 class Resampler : public IStreamReader, public core::NonCopyable<> {
 public:
     //! Initialize.
     //!
     //! @b Parameters
     //!  - @p reader specifies input audio stream used in read();
-    //!  - @p composer is used to construct temporary buffers;
-    //!  - @p frame_size is number of samples per resampler frame.
+    //!  - @p composer is used to construct temporary buffer;
+    //!  - @p frame_size is number of samples per channel per resampler frame;
+    //!  - @p kernel is used to compute dot products of samples and sinc taps;
+    //!  - @p bank is polyphase filter bank; if NULL, taps are interpolated
+    //!    from sinc table;
+    //!  - @p num_channels is number of channels in interleaved input and
+    //!    output streams.
     explicit Resampler(IStreamReader& reader,
                        ISampleBufferComposer& composer = default_buffer_composer(),
-                       size_t frame_size = ROC_CONFIG_DEFAULT_RESAMPLER_FRAME_SAMPLES);
+                       size_t frame_size = ROC_CONFIG_DEFAULT_RESAMPLER_FRAME_SAMPLES,
+                       IResamplerKernel& kernel = default_resampler_kernel(),
+                       const PolyphaseBank* bank = NULL,
+                       size_t num_channels = 1);
 
     //! Fills buffer of samples with new sampling frequency.
     //! @remarks
@@ -57,21 +80,62 @@ private:
 
     typedef packet::sample_t sample_t;
 
+    enum {
+        // Number of frames in window.
+        NumFrames = 3,
+
+        // Frame and half of window should fit into integer part of Q8.24.
+        MaxFrameSize = 191,
+
+        // Maximum number of channels.
+        MaxChannels = ROC_CONFIG_MAX_CHANNELS,
+
+        // Maximum number of taps per output sample.
+        MaxTaps = 128
+    };
+
+    size_t window_size_() const;
+    size_t run_length_(size_t max_samples) const;
+
+    fixedpoint_t sinc_position_();
+
     sample_t resample_();
+    void resample_multichannel_(sample_t* out);
+    void resample_polyphase_(sample_t* out);
 
     void init_window_(ISampleBufferComposer&);
     void renew_window_();
+    void read_frame_(size_t offset);
 
     // Input stream.
     IStreamReader& reader_;
 
-    // Input stream window (3 frames).
-    core::CircularBuffer<ISampleBufferPtr, 3> window_;
+    // Sinc table split into phases.
+    const SincPhaseTable& table_;
 
-    // Pointers to 3 frames of stream window.
-    sample_t* prev_frame_;
+    // Computes dot products of samples and sinc taps.
+    IResamplerKernel& kernel_;
+
+    // Polyphase filter bank or NULL.
+    const PolyphaseBank* bank_;
+
+    // Shift to get bank phase from fractional part of Q8.24.
+    size_t bank_phase_shift_;
+
+    // Number of channels in interleaved stream.
+    const size_t num_channels_;
+
+    // Buffer for reading next frame from input stream.
+    ISampleBufferPtr frame_;
+
+    // Input stream window (3 frames stored contiguously for every channel).
+    sample_t window_[MaxChannels * NumFrames * MaxFrameSize];
+
+    // Pointer to current (middle) frame of stream window of first channel.
     sample_t* curr_frame_;
-    sample_t* next_frame_;
+
+    // Taps computed for current output sample.
+    float taps_[MaxTaps];
 
     // Frame size.
     // (frame_size_ / st_Nwindow) is maximum allowed scaling ratio.
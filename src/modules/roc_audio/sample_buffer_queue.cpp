@@ -16,42 +16,73 @@ namespace audio {
 
 SampleBufferQueue::SampleBufferQueue()
     : rd_sem_(0)
-    , wr_sem_(MaxBuffers) {
+    , wr_sem_(0) {
     roc_log(LOG_TRACE, "sample buffer queue: max_size=%u", (unsigned)MaxBuffers);
 }
 
 ISampleBufferConstSlice SampleBufferQueue::read() {
-    rd_sem_.pend();
+    const long head = head_.load_acquire();
+
+    // Before sleeping, reader sets rd_waiting_ and then rechecks tail_,
+    // while writer updates tail_ and then checks rd_waiting_. Both use
+    // sequentially consistent operations, so either reader sees new
+    // buffer or writer sees that reader is sleeping and wakes it up.
+    while (tail_ == head) {
+        rd_waiting_.exchange(1);
+
+        if (tail_ != head) {
+            // If writer already cleared the flag, semaphore will be
+            // posted anyway, and next pend() returns immediately.
+            rd_waiting_.exchange(0);
+            break;
+        }
+
+        rd_sem_.pend();
+    }
 
-    ISampleBufferConstSlice buffer;
+    ISampleBufferConstSlice& slot = buffers_[(unsigned long)head % MaxBuffers];
 
-    {
-        core::SpinMutex::Lock lock(mutex_);
+    ISampleBufferConstSlice buffer = slot;
+    slot = ISampleBufferConstSlice();
 
-        buffer = cb_.shift();
-    }
+    head_.exchange(head + 1);
 
-    wr_sem_.post();
+    if (wr_waiting_.exchange(0)) {
+        wr_sem_.post();
+    }
 
     return buffer;
 }
 
 void SampleBufferQueue::write(const ISampleBufferConstSlice& buffer) {
-    wr_sem_.pend();
+    const long tail = tail_.load_acquire();
+
+    // See comment in read().
+    while (tail - head_ == MaxBuffers) {
+        wr_waiting_.exchange(1);
 
-    {
-        core::SpinMutex::Lock lock(mutex_);
+        if (tail - head_ != MaxBuffers) {
+            wr_waiting_.exchange(0);
+            break;
+        }
 
-        cb_.push(buffer);
+        wr_sem_.pend();
     }
 
-    rd_sem_.post();
+    buffers_[(unsigned long)tail % MaxBuffers] = buffer;
+
+    tail_.exchange(tail + 1);
+
+    if (rd_waiting_.exchange(0)) {
+        rd_sem_.post();
+    }
 }
 
 size_t SampleBufferQueue::size() const {
-    core::SpinMutex::Lock lock(mutex_);
+    const long head = head_;
+    const long tail = tail_;
 
-    return cb_.size();
+    return (size_t)(tail - head);
 }
 
 } // namespace audio
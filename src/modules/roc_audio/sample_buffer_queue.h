@@ -17,8 +17,7 @@
 
 #include "roc_core/noncopyable.h"
 #include "roc_core/semaphore.h"
-#include "roc_core/spin_mutex.h"
-#include "roc_core/circular_buffer.h"
+#include "roc_core/atomic.h"
 
 #include "roc_audio/isample_buffer_reader.h"
 #include "roc_audio/isample_buffer_writer.h"
@@ -27,6 +26,14 @@ namespace roc {
 namespace audio {
 
 //! Sample buffer queue.
+//!
+//! Bounded single-producer single-consumer queue. write() may be called
+//! from one thread and read() from another thread concurrently.
+//!
+//! @remarks
+//!  Buffers are passed through a lock-free ring. A semaphore is used only
+//!  when reader finds the queue empty or writer finds it full and has to
+//!  sleep, so while both sides keep up, no system calls are made.
 class SampleBufferQueue : public ISampleBufferReader,
                           public ISampleBufferWriter,
                           public core::NonCopyable<> {
@@ -50,11 +57,19 @@ public:
 private:
     enum { MaxBuffers = ROC_CONFIG_MAX_SAMPLE_BUFFERS };
 
+    // Number of buffers read and written, modified only by reader
+    // and writer respectively.
+    core::Atomic head_;
+    core::Atomic tail_;
+
+    // Non-zero if reader or writer is going to sleep on semaphore.
+    core::Atomic rd_waiting_;
+    core::Atomic wr_waiting_;
+
     core::Semaphore rd_sem_;
     core::Semaphore wr_sem_;
 
-    core::CircularBuffer<ISampleBufferConstSlice, MaxBuffers> cb_;
-    core::SpinMutex mutex_;
+    ISampleBufferConstSlice buffers_[MaxBuffers];
 };
 
 } // namespace audio
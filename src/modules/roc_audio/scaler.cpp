@@ -25,36 +25,35 @@ enum { ReportInterval = 5000 /* ms */ };
 
 } // namespace
 
-Scaler::Scaler(packet::IPacketReader& reader,
-               packet::PacketQueue const& queue,
-               packet::timestamp_t aim_queue_size)
-    : reader_(reader)
-    , queue_(queue)
+Scaler::Scaler(packet::PacketQueue const& queue,
+               packet::timestamp_t aim_queue_size,
+               packet::timestamp_t start_queue_size)
+    : queue_(queue)
     , aim_queue_size_(aim_queue_size)
+    , start_queue_size_(start_queue_size)
     , freq_estimator_(aim_queue_size)
     , timer_(ReportInterval)
     , started_(false) {
 }
 
-packet::IPacketConstPtr Scaler::read() {
-    packet::IPacketConstPtr pp = reader_.read();
-    update_packet_(head_, pp);
-    return pp;
+void Scaler::track(const packet::IPacketConstPtr& packet) {
+    update_packet_(head_, packet);
 }
 
 bool Scaler::update() {
     update_packet_(tail_, queue_.tail());
 
-    const packet::timestamp_t qs = queue_size_();
+    const packet::timestamp_t qs = queue_size();
 
     if (!started_) {
-        if (qs < aim_queue_size_) {
+        if (qs < start_queue_size_) {
             return true;
         } else {
             started_ = true;
             roc_log(LOG_DEBUG, "scaler: received enough samples:"
-                               " queue_size=%lu aim_queue_size=%lu",
-                    (unsigned long)qs, (unsigned long)aim_queue_size_);
+                               " queue_size=%lu start_queue_size=%lu aim_queue_size=%lu",
+                    (unsigned long)qs, (unsigned long)start_queue_size_,
+                    (unsigned long)aim_queue_size_);
         }
     }
 
@@ -85,7 +84,16 @@ void Scaler::add_resampler(Resampler& resampler) {
     resamplers_.append(&resampler);
 }
 
-packet::timestamp_t Scaler::queue_size_() const {
+packet::timestamp_t Scaler::aim_queue_size() const {
+    return aim_queue_size_;
+}
+
+void Scaler::set_aim_queue_size(packet::timestamp_t aim_queue_size) {
+    aim_queue_size_ = aim_queue_size;
+    freq_estimator_.set_aim_queue_size(aim_queue_size);
+}
+
+packet::timestamp_t Scaler::queue_size() const {
     if (!head_ || !tail_) {
         return 0;
     }
@@ -19,7 +19,6 @@
 #include "roc_core/array.h"
 #include "roc_core/timer.h"
 
-#include "roc_packet/ipacket_reader.h"
 #include "roc_packet/iaudio_packet.h"
 #include "roc_packet/packet_queue.h"
 #include "roc_packet/imonitor.h"
@@ -34,21 +33,22 @@ namespace audio {
 //! @remarks
 //!  Monitors queue size, passes it to FreqEstimator to recompute scaling,
 //!  and passes updated scaling to connected resamplers.
-class Scaler : public packet::IMonitor,
-               public packet::IPacketReader,
-               public core::NonCopyable<> {
+//!
+//!  Packets read from session are passed to Scaler via ScalerReader.
+class Scaler : public packet::IMonitor, public core::NonCopyable<> {
 public:
     //! Initialize.
     //!
     //! @b Parameters
-    //!  - @p reader is input packet reader; packets from @p reader
-    //!    are returned from read();
     //!  - @p queue is received packet queue used to calculate number
-    //!    of pending samples in stream; it may be or may not be the same
-    //!    object as @p reader.
-    Scaler(packet::IPacketReader& reader,
-           packet::PacketQueue const& queue,
-           packet::timestamp_t aim_queue_size = ROC_CONFIG_DEFAULT_SESSION_LATENCY);
+    //!    of pending samples in stream;
+    //!  - @p aim_queue_size is number of pending samples we want to achieve;
+    //!  - @p start_queue_size is number of pending samples after which
+    //!    scaling starts; if it's less than @p aim_queue_size, stream is
+    //!    played slower until aim is reached.
+    Scaler(packet::PacketQueue const& queue,
+           packet::timestamp_t aim_queue_size = ROC_CONFIG_DEFAULT_SESSION_LATENCY,
+           packet::timestamp_t start_queue_size = ROC_CONFIG_DEFAULT_SESSION_LATENCY);
 
     //! Update stream.
     //! @remarks
@@ -58,24 +58,33 @@ public:
     //!  can't be continued.
     virtual bool update();
 
-    //! Read next packet.
-    //! @remarks
-    //!  updates queue size and returns next packet from input reader.
-    virtual packet::IPacketConstPtr read();
+    //! Update queue size using packet read from stream.
+    void track(const packet::IPacketConstPtr&);
 
     //! Add resampler.
     void add_resampler(Resampler&);
 
+    //! Get number of samples pending in stream.
+    packet::timestamp_t queue_size() const;
+
+    //! Get queue size we want to archive.
+    packet::timestamp_t aim_queue_size() const;
+
+    //! Set queue size we want to archive.
+    //! @remarks
+    //!  May be changed while rendering; scaling is then gradually adjusted
+    //!  to move queue size towards new value.
+    void set_aim_queue_size(packet::timestamp_t aim_queue_size);
+
 private:
     enum { MaxChannels = ROC_CONFIG_MAX_CHANNELS };
 
-    packet::timestamp_t queue_size_() const;
     void update_packet_(packet::IAudioPacketConstPtr& prev,
                         const packet::IPacketConstPtr& next);
 
-    packet::IPacketReader& reader_;
     packet::PacketQueue const& queue_;
     packet::timestamp_t aim_queue_size_;
+    const packet::timestamp_t start_queue_size_;
 
     packet::IAudioPacketConstPtr head_;
     packet::IAudioPacketConstPtr tail_;
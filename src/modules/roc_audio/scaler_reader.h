@@ -0,0 +1,66 @@
+/*
+ * Copyright (c) 2015 Mikhail Baranov
+ * Copyright (c) 2015 Victor Gaydov
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+//! @file roc_audio/scaler_reader.h
+//! @brief Scaler reader.
+
+#ifndef ROC_AUDIO_SCALER_READER_H_
+#define ROC_AUDIO_SCALER_READER_H_
+
+#include "roc_core/noncopyable.h"
+
+#include "roc_packet/ipacket_reader.h"
+
+#include "roc_audio/scaler.h"
+
+namespace roc {
+namespace audio {
+
+//! Scaler reader.
+//! @remarks
+//!  Passes every packet returned from input reader to Scaler, so that
+//!  it can calculate number of pending samples in stream.
+//!
+//! @tparam Reader defines type of input packet reader; if it's a concrete
+//!  reader class, reading from it is not virtual and may be inlined.
+template <class Reader>
+class BasicScalerReader : public packet::IPacketReader, public core::NonCopyable<> {
+public:
+    //! Initialize.
+    //!
+    //! @b Parameters
+    //!  - @p reader is input packet reader; packets from @p reader
+    //!    are returned from read();
+    //!  - @p scaler is notified about every returned packet.
+    BasicScalerReader(Reader& reader, Scaler& scaler)
+        : reader_(reader)
+        , scaler_(scaler) {
+    }
+
+    //! Read next packet.
+    virtual packet::IPacketConstPtr read() {
+        packet::IPacketConstPtr packet = packet::read_packet(reader_);
+        if (packet) {
+            scaler_.track(packet);
+        }
+        return packet;
+    }
+
+private:
+    Reader& reader_;
+    Scaler& scaler_;
+};
+
+//! Scaler reader reading from any packet reader.
+typedef BasicScalerReader<packet::IPacketReader> ScalerReader;
+
+} // namespace audio
+} // namespace roc
+
+#endif // ROC_AUDIO_SCALER_READER_H_
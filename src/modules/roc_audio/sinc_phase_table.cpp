@@ -0,0 +1,36 @@
+/*
+ * Copyright (c) 2015 Mikhail Baranov
+ * Copyright (c) 2015 Victor Gaydov
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "roc_core/singleton.h"
+#include "roc_core/helpers.h"
+
+#include "roc_audio/sinc_phase_table.h"
+
+namespace roc {
+namespace audio {
+
+SincPhaseTable::SincPhaseTable() {
+    for (size_t p = 0; p < NumPhases; p++) {
+        for (size_t t = 0; t < NumTaps; t++) {
+            const size_t n = t * st_Nwindow_interp + p;
+
+            // Last tap is valid only for zero phase; sinc is zero beyond
+            // the end of the table anyway.
+            lo_[p][t] = n < ROC_ARRAY_SIZE(sinc_table) ? sinc_table[n] : 0;
+            hi_[p][t] = n + 1 < ROC_ARRAY_SIZE(sinc_table) ? sinc_table[n + 1] : 0;
+        }
+    }
+}
+
+const SincPhaseTable& SincPhaseTable::instance() {
+    return core::Singleton<SincPhaseTable>::instance();
+}
+
+} // namespace audio
+} // namespace roc
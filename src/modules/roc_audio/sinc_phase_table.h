@@ -0,0 +1,68 @@
+/*
+ * Copyright (c) 2015 Mikhail Baranov
+ * Copyright (c) 2015 Victor Gaydov
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+//! @file roc_audio/sinc_phase_table.h
+//! @brief Sinc table split into phases.
+
+#ifndef ROC_AUDIO_SINC_PHASE_TABLE_H_
+#define ROC_AUDIO_SINC_PHASE_TABLE_H_
+
+#include "roc_core/noncopyable.h"
+#include "roc_core/stddefs.h"
+
+#include "roc_audio/sinc_table.h"
+
+namespace roc {
+namespace audio {
+
+//! Sinc table split into phases.
+//! @remarks
+//!  Resampler walks sinc_table with a step of st_Nwindow_interp values, so all
+//!  taps used for one output sample have the same offset (phase) inside that
+//!  step. This table stores values of every phase contiguously, to let kernels
+//!  load taps for one output sample with sequential loads.
+//!
+//!  For phase @c p and tap @c t:
+//!  @code
+//!   lo(p)[t] == sinc_table[t * st_Nwindow_interp + p]
+//!   hi(p)[t] == sinc_table[t * st_Nwindow_interp + p + 1]
+//!  @endcode
+class SincPhaseTable : public core::NonCopyable<> {
+public:
+    //! Number of taps per phase.
+    static const size_t NumTaps = st_Nwindow + 1;
+
+    //! Number of phases.
+    static const size_t NumPhases = st_Nwindow_interp;
+
+    //! Build table.
+    SincPhaseTable();
+
+    //! Get table values at tap positions for given phase.
+    const float* lo(size_t phase) const {
+        return lo_[phase];
+    }
+
+    //! Get table values next to tap positions for given phase.
+    const float* hi(size_t phase) const {
+        return hi_[phase];
+    }
+
+    //! Get shared instance.
+    static const SincPhaseTable& instance();
+
+private:
+    float lo_[NumPhases][NumTaps];
+    float hi_[NumPhases][NumTaps];
+};
+
+} // namespace audio
+} // namespace roc
+
+#endif // ROC_AUDIO_SINC_PHASE_TABLE_H_
@@ -21,13 +21,15 @@ Splitter::Splitter(packet::IPacketWriter& output,
                    packet::IPacketComposer& composer,
                    size_t samples,
                    packet::channel_mask_t channels,
-                   size_t rate)
+                   size_t rate,
+                   packet::SampleFormat format)
     : output_(output)
     , composer_(composer)
     , channels_(channels)
     , n_channels_(packet::num_channels(channels))
     , n_packet_samples_(samples)
     , rate_(rate)
+    , format_(format)
     , source_((packet::source_t)core::random(packet::source_t(-1)))
     , seqnum_((packet::seqnum_t)core::random(packet::seqnum_t(-1)))
     , timestamp_((packet::timestamp_t)core::random(packet::timestamp_t(-1)))
@@ -102,7 +104,7 @@ bool Splitter::create_packet_() {
     packet_->set_source(source_);
     packet_->set_seqnum(seqnum_);
     packet_->set_timestamp(timestamp_);
-    packet_->set_size(channels_, n_packet_samples_, rate_);
+    packet_->set_size(channels_, n_packet_samples_, rate_, format_);
 
     return true;
 }
@@ -39,12 +39,15 @@ public:
     //!  - @p output is used to write constructed packets;
     //!  - @p composer is used to construct audio packets;
     //!  - @p samples specifies number of samples per channel in packet;
-    //!  - @p channels specifies bitmask of enabled audio channels.
+    //!  - @p channels specifies bitmask of enabled audio channels;
+    //!  - @p rate specifies sample rate;
+    //!  - @p format specifies sample format of packet payload.
     Splitter(packet::IPacketWriter& output,
              packet::IPacketComposer& composer,
              size_t samples = ROC_CONFIG_DEFAULT_PACKET_SAMPLES,
              packet::channel_mask_t channels = ROC_CONFIG_DEFAULT_CHANNEL_MASK,
-             size_t rate = ROC_CONFIG_DEFAULT_SAMPLE_RATE);
+             size_t rate = ROC_CONFIG_DEFAULT_SAMPLE_RATE,
+             packet::SampleFormat format = packet::Sample_L16);
 
     //! Write samples.
     //! @remarks
@@ -67,6 +70,7 @@ private:
     const size_t n_channels_;
     const size_t n_packet_samples_;
     const size_t rate_;
+    const packet::SampleFormat format_;
 
     packet::IAudioPacketPtr packet_;
     const packet::source_t source_;
@@ -34,17 +34,18 @@ inline void write_zeros(sample_t* buf, size_t bufsz) {
     memset(buf, 0, bufsz * sizeof(sample_t));
 }
 
-inline void write_beep(sample_t* buf, size_t bufsz) {
+inline void write_beep(sample_t* buf, size_t bufsz, size_t num_ch) {
     for (size_t n = 0; n < bufsz; n++) {
-        buf[n] = (sample_t)sin(2 * M_PI / ROC_CONFIG_DEFAULT_SAMPLE_RATE * 880 * n);
+        buf[n] = (sample_t)sin(2 * M_PI / ROC_CONFIG_DEFAULT_SAMPLE_RATE * 880
+                               * (n / num_ch));
     }
 }
 
 } // namespace
 
-Streamer::Streamer(packet::IPacketReader& reader, packet::channel_t channel, bool beep)
-    : reader_(reader)
-    , channel_(channel)
+StreamerBase::StreamerBase(packet::channel_mask_t channels, bool beep)
+    : channels_(channels)
+    , num_channels_(packet::num_channels(channels))
     , packet_pos_(0)
     , timestamp_(0)
     , zero_samples_(0)
@@ -53,30 +54,82 @@ Streamer::Streamer(packet::IPacketReader& reader, packet::channel_t channel, boo
     , timer_(ReportInterval)
     , first_packet_(true)
     , beep_(beep) {
+    if (channels_ == 0) {
+        roc_panic("streamer: channel mask is zero");
+    }
 }
 
-void Streamer::read(const ISampleBufferSlice& buffer) {
-    roc_panic_if(buffer.data() == NULL);
+size_t StreamerBase::num_missing_samples() const {
+    return (size_t)missing_samples_;
+}
 
-    sample_t* buff_ptr = buffer.data();
-    sample_t* buff_end = buffer.data() + buffer.size();
+void StreamerBase::check_buffer_(const ISampleBufferSlice& buffer) const {
+    roc_panic_if(buffer.data() == NULL);
 
-    while (buff_ptr < buff_end) {
-        buff_ptr = read_samples_(buff_ptr, buff_end);
+    if (buffer.size() % num_channels_ != 0) {
+        roc_panic("streamer: attempting to read number of samples which is "
+                  "not multiple of number of channels "
+                  "(num_samples=%u, num_channels=%u)",
+                  (unsigned)buffer.size(), (unsigned)num_channels_);
     }
+}
 
-    roc_panic_if(buff_ptr != buff_end);
-
+void StreamerBase::report_() {
     if (timer_.expired()) {
-        roc_log(LOG_TRACE, "streamer: ch=%d ts=%lu loss_ratio=%.5lf", (int)channel_,
-                (unsigned long)timestamp_,
+        roc_log(LOG_TRACE, "streamer: ch=0x%x ts=%lu loss_ratio=%.5lf",
+                (unsigned)channels_, (unsigned long)timestamp_,
                 double(missing_samples_) / (missing_samples_ + packet_samples_));
     }
 }
 
-sample_t* Streamer::read_samples_(sample_t* buff_ptr, sample_t* buff_end) {
-    update_packet_();
+bool StreamerBase::has_packet_() const {
+    return packet_;
+}
+
+bool StreamerBase::set_packet_(const packet::IPacketConstPtr& pp) {
+    if (pp->type() != packet::IAudioPacket::Type) {
+        roc_panic("streamer: got unexpected non-audio packet from reader");
+    }
+
+    const packet::IAudioPacket* packet =
+        static_cast<const packet::IAudioPacket*>(pp.get());
+
+    const timestamp_t pkt_timestamp = packet->timestamp();
+
+    if (!first_packet_
+        && !TS_IS_BEFORE(timestamp_, pkt_timestamp + packet->num_samples())) {
+        roc_log(LOG_TRACE, "streamer: dropping late packet:"
+                           " ch=0x%x ts=%lu pkt_ts=%lu pkt_ns=%lu",
+                (unsigned)channels_, (unsigned long)timestamp_,
+                (unsigned long)pkt_timestamp, (unsigned long)packet->num_samples());
+        return false;
+    }
+
+    packet_ = packet;
+
+    if (first_packet_) {
+        roc_log(LOG_TRACE, "streamer: got first packet: ch=0x%x zero_samples=%lu",
+                (unsigned)channels_, (unsigned long)zero_samples_);
+
+        timestamp_ = pkt_timestamp;
+        first_packet_ = false;
+    }
+
+    if (TS_IS_BEFORE(pkt_timestamp, timestamp_)) {
+        packet_pos_ = (timestamp_t)TS_SUBTRACT(timestamp_, pkt_timestamp);
+    } else {
+        packet_pos_ = 0;
+    }
+
+    return true;
+}
+
+void StreamerBase::report_dropped_(unsigned n_dropped) const {
+    roc_log(LOG_DEBUG, "streamer: ch=0x%x fetched=%d dropped=%u", (unsigned)channels_,
+            (int)!!packet_, n_dropped);
+}
 
+sample_t* StreamerBase::write_samples_(sample_t* buff_ptr, sample_t* buff_end) {
     if (packet_) {
         timestamp_t next_timestamp = (packet_->timestamp() + packet_pos_);
 
@@ -84,30 +137,30 @@ sample_t* Streamer::read_samples_(sample_t* buff_ptr, sample_t* buff_end) {
             roc_panic_if_not(TS_IS_BEFORE(timestamp_, next_timestamp));
 
             size_t mis_samples = (size_t)TS_SUBTRACT(next_timestamp, timestamp_);
-            size_t max_samples = (size_t)(buff_end - buff_ptr);
+            size_t max_samples = (size_t)(buff_end - buff_ptr) / num_channels_;
 
-            buff_ptr = read_missing_samples_(buff_ptr, buff_ptr
-                                                 + ROC_MIN(mis_samples, max_samples));
+            buff_ptr = write_missing_samples_(
+                buff_ptr, buff_ptr + ROC_MIN(mis_samples, max_samples) * num_channels_);
         }
 
         if (buff_ptr < buff_end) {
-            buff_ptr = read_packet_samples_(buff_ptr, buff_end);
+            buff_ptr = write_packet_samples_(buff_ptr, buff_end);
         }
 
         return buff_ptr;
     } else {
-        return read_missing_samples_(buff_ptr, buff_end);
+        return write_missing_samples_(buff_ptr, buff_end);
     }
 }
 
-sample_t* Streamer::read_packet_samples_(sample_t* buff_ptr, sample_t* buff_end) {
+sample_t* StreamerBase::write_packet_samples_(sample_t* buff_ptr, sample_t* buff_end) {
     const size_t pkt_samples = (size_t)(packet_->num_samples() - packet_pos_);
-    const size_t max_samples = (size_t)(buff_end - buff_ptr);
+    const size_t max_samples = (size_t)(buff_end - buff_ptr) / num_channels_;
 
     const size_t num_samples = ROC_MIN(pkt_samples, max_samples);
 
     const size_t ret =
-        packet_->read_samples((1 << channel_), packet_pos_, buff_ptr, num_samples);
+        packet_->read_samples(channels_, packet_pos_, buff_ptr, num_samples);
 
     if (ret != num_samples) {
         packet_->print(true);
@@ -126,16 +179,16 @@ sample_t* Streamer::read_packet_samples_(sample_t* buff_ptr, sample_t* buff_end)
         packet_.reset();
     }
 
-    return (buff_ptr + num_samples);
+    return (buff_ptr + num_samples * num_channels_);
 }
 
-sample_t* Streamer::read_missing_samples_(sample_t* buff_ptr, sample_t* buff_end) {
-    size_t num_samples = (size_t)(buff_end - buff_ptr);
+sample_t* StreamerBase::write_missing_samples_(sample_t* buff_ptr, sample_t* buff_end) {
+    size_t num_samples = (size_t)(buff_end - buff_ptr) / num_channels_;
 
     if (beep_) {
-        write_beep(buff_ptr, num_samples);
+        write_beep(buff_ptr, num_samples * num_channels_, num_channels_);
     } else {
-        write_zeros(buff_ptr, num_samples);
+        write_zeros(buff_ptr, num_samples * num_channels_);
     }
 
     timestamp_ += timestamp_t(num_samples);
@@ -146,71 +199,7 @@ sample_t* Streamer::read_missing_samples_(sample_t* buff_ptr, sample_t* buff_end
         missing_samples_ += num_samples;
     }
 
-    return (buff_ptr + num_samples);
-}
-
-void Streamer::update_packet_() {
-    if (packet_) {
-        return;
-    }
-
-    timestamp_t pkt_timestamp = 0;
-    unsigned n_dropped = 0;
-
-    while ((packet_ = read_packet_())) {
-        pkt_timestamp = packet_->timestamp();
-
-        if (first_packet_) {
-            break;
-        }
-
-        if (TS_IS_BEFORE(timestamp_, pkt_timestamp + packet_->num_samples())) {
-            break;
-        }
-
-        roc_log(LOG_TRACE, "streamer: dropping late packet:"
-                           " ch=%d ts=%lu pkt_ts=%lu pkt_ns=%lu",
-                (int)channel_, (unsigned long)timestamp_, (unsigned long)pkt_timestamp,
-                (unsigned long)packet_->num_samples());
-
-        n_dropped++;
-    }
-
-    if (n_dropped != 0) {
-        roc_log(LOG_DEBUG, "streamer: ch=%d fetched=%d dropped=%u", (int)channel_,
-                (int)!!packet_, n_dropped);
-    }
-
-    if (!packet_) {
-        return;
-    }
-
-    if (first_packet_) {
-        roc_log(LOG_TRACE, "streamer: got first packet: ch=%d zero_samples=%lu",
-                (int)channel_, (unsigned long)zero_samples_);
-
-        timestamp_ = pkt_timestamp;
-        first_packet_ = false;
-    }
-
-    if (TS_IS_BEFORE(pkt_timestamp, timestamp_)) {
-        packet_pos_ = (timestamp_t)TS_SUBTRACT(timestamp_, pkt_timestamp);
-    } else {
-        packet_pos_ = 0;
-    }
-}
-
-packet::IAudioPacketConstPtr Streamer::read_packet_() {
-    packet::IPacketConstPtr pp = reader_.read();
-    if (!pp) {
-        return NULL;
-    }
-
-    if (pp->type() != packet::IAudioPacket::Type) {
-        roc_panic("streamer: got unexpected non-audio packet from reader");
-    }
-
-    return static_cast<const packet::IAudioPacket*>(pp.get());
+    return (buff_ptr + num_samples * num_channels_);
 }
 
 } // namespace audio
@@ -13,8 +13,11 @@
 #ifndef ROC_AUDIO_STREAMER_H_
 #define ROC_AUDIO_STREAMER_H_
 
+#include "roc_config/config.h"
+
 #include "roc_core/noncopyable.h"
 #include "roc_core/timer.h"
+#include "roc_core/panic.h"
 
 #include "roc_packet/ipacket_reader.h"
 #include "roc_packet/iaudio_packet.h"
@@ -25,41 +28,53 @@
 namespace roc {
 namespace audio {
 
-//! Streamer.
+//! Streamer base.
 //!
-//! Reads audio packets from input queue for a channel and produces continous
-//! stream of audio samples:
-//!  - copies samples from audio packets to output stream using timestamp
-//!    field as positional number of first sample in packet;
-//!  - fills stream gaps (missing packets) with zeros;
-//!  - drops late packets;
-//!  - handles overlapping packets.
-class Streamer : public IStreamReader, public core::NonCopyable<> {
+//! Holds stream state and implements everything except fetching packets
+//! from reader, which is done by BasicStreamer.
+class StreamerBase : public IStreamReader, public core::NonCopyable<> {
 public:
-    //! Initializer.
-    //!
-    //! @b Parameters
-    //!  - @p reader is input queue of audio packets;
-    //!  - @p channel is channel number for which packets should be read;
-    //!  - @p beep defines whether missing samples should be replaces with a beep.
-    Streamer(packet::IPacketReader& reader, packet::channel_t channel, bool beep = false);
+    //! Get number of samples per channel replaced with zeros or beep
+    //! because packets were lost or late.
+    //! @remarks
+    //!  Samples before first packet are not counted.
+    size_t num_missing_samples() const;
+
+protected:
+    //! Sample type.
+    typedef packet::sample_t sample_t;
 
-    //! Read samples.
-    virtual void read(const ISampleBufferSlice&);
+    //! Initialize.
+    StreamerBase(packet::channel_mask_t channels, bool beep);
 
-private:
-    typedef packet::sample_t sample_t;
+    //! Check that buffer may be filled.
+    void check_buffer_(const ISampleBufferSlice&) const;
+
+    //! Report stream state periodically.
+    void report_();
 
-    void update_packet_();
-    packet::IAudioPacketConstPtr read_packet_();
+    //! Check if there is a packet to read samples from.
+    bool has_packet_() const;
 
-    sample_t* read_samples_(sample_t* begin, sample_t* end);
+    //! Set next packet read from reader.
+    //! @returns
+    //!  false if packet is late and was dropped.
+    bool set_packet_(const packet::IPacketConstPtr&);
 
-    sample_t* read_packet_samples_(sample_t* begin, sample_t* end);
-    sample_t* read_missing_samples_(sample_t* begin, sample_t* end);
+    //! Report dropped late packets.
+    void report_dropped_(unsigned n_dropped) const;
 
-    packet::IPacketReader& reader_;
-    packet::channel_t channel_;
+    //! Write samples from current packet or zeros if there is no packet.
+    //! @returns
+    //!  pointer past last written sample.
+    sample_t* write_samples_(sample_t* begin, sample_t* end);
+
+private:
+    sample_t* write_packet_samples_(sample_t* begin, sample_t* end);
+    sample_t* write_missing_samples_(sample_t* begin, sample_t* end);
+
+    const packet::channel_mask_t channels_;
+    const size_t num_channels_;
 
     packet::IAudioPacketConstPtr packet_;
     packet::timestamp_t packet_pos_;
@@ -76,6 +91,79 @@ private:
     bool beep_;
 };
 
+//! Streamer.
+//!
+//! Reads audio packets from input queue and produces continous stream of
+//! audio samples in interleaved format:
+//!  - copies samples from audio packets to output stream using timestamp
+//!    field as positional number of first sample in packet;
+//!  - fills stream gaps (missing packets) with zeros;
+//!  - drops late packets;
+//!  - handles overlapping packets.
+//!
+//! Every packet is read once for all channels, so its payload is decoded
+//! in a single pass.
+//!
+//! @tparam Reader defines type of input packet reader; if it's a concrete
+//!  reader class, reading from it is not virtual and may be inlined.
+template <class Reader> class BasicStreamer : public StreamerBase {
+public:
+    //! Initializer.
+    //!
+    //! @b Parameters
+    //!  - @p reader is input queue of audio packets;
+    //!  - @p channels is bitmask of channels to be read from packets;
+    //!  - @p beep defines whether missing samples should be replaces with a beep.
+    BasicStreamer(Reader& reader,
+                  packet::channel_mask_t channels = ROC_CONFIG_DEFAULT_CHANNEL_MASK,
+                  bool beep = false)
+        : StreamerBase(channels, beep)
+        , reader_(reader) {
+    }
+
+    //! Read samples.
+    //! @remarks
+    //!  Buffer size should be multiple of number of channels.
+    virtual void read(const ISampleBufferSlice& buffer) {
+        check_buffer_(buffer);
+
+        sample_t* buff_ptr = buffer.data();
+        sample_t* buff_end = buffer.data() + buffer.size();
+
+        while (buff_ptr < buff_end) {
+            if (!has_packet_()) {
+                fetch_packet_();
+            }
+            buff_ptr = write_samples_(buff_ptr, buff_end);
+        }
+
+        roc_panic_if(buff_ptr != buff_end);
+
+        report_();
+    }
+
+private:
+    void fetch_packet_() {
+        unsigned n_dropped = 0;
+
+        while (packet::IPacketConstPtr packet = packet::read_packet(reader_)) {
+            if (set_packet_(packet)) {
+                break;
+            }
+            n_dropped++;
+        }
+
+        if (n_dropped != 0) {
+            report_dropped_(n_dropped);
+        }
+    }
+
+    Reader& reader_;
+};
+
+//! Streamer reading from any packet reader.
+typedef BasicStreamer<packet::IPacketReader> Streamer;
+
 } // namespace audio
 } // namespace roc
 
@@ -0,0 +1,82 @@
+/*
+ * Copyright (c) 2015 Mikhail Baranov
+ * Copyright (c) 2015 Victor Gaydov
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <arm_neon.h>
+
+#include "roc_audio/neon_mixer_kernel.h"
+
+namespace roc {
+namespace audio {
+
+using packet::sample_t;
+
+const char* NEONMixerKernel::name() const {
+    return "neon";
+}
+
+void NEONMixerKernel::mix(sample_t* out, const sample_t* in, size_t n) const {
+    size_t k = 0;
+
+    for (; k + 4 <= n; k += 4) {
+        vst1q_f32(out + k, vaddq_f32(vld1q_f32(out + k), vld1q_f32(in + k)));
+    }
+
+    for (; k < n; k++) {
+        out[k] += in[k];
+    }
+}
+
+void NEONMixerKernel::clip(sample_t* out, size_t n) const {
+    const float32x4_t vmax = vdupq_n_f32(1);
+    const float32x4_t vmin = vdupq_n_f32(-1);
+
+    size_t k = 0;
+
+    for (; k + 4 <= n; k += 4) {
+        vst1q_f32(out + k, vmaxq_f32(vminq_f32(vld1q_f32(out + k), vmax), vmin));
+    }
+
+    for (; k < n; k++) {
+        if (out[k] > 1) {
+            out[k] = 1;
+        } else if (out[k] < -1) {
+            out[k] = -1;
+        }
+    }
+}
+
+void NEONMixerKernel::interleave(sample_t* out,
+                                 const sample_t* in,
+                                 size_t num_channels,
+                                 size_t n) const {
+    size_t k = 0;
+
+    if (num_channels == 2) {
+        const sample_t* left = in;
+        const sample_t* right = in + n;
+
+        for (; k + 4 <= n; k += 4) {
+            float32x4x2_t v;
+            v.val[0] = vld1q_f32(left + k);
+            v.val[1] = vld1q_f32(right + k);
+            vst2q_f32(out + k * 2, v);
+        }
+    }
+
+    for (size_t ch = 0; ch < num_channels; ch++) {
+        const sample_t* ch_in = in + ch * n;
+
+        for (size_t i = k; i < n; i++) {
+            out[i * num_channels + ch] = ch_in[i];
+        }
+    }
+}
+
+} // namespace audio
+} // namespace roc
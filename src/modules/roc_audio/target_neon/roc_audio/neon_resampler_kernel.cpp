@@ -0,0 +1,149 @@
+/*
+ * Copyright (c) 2015 Mikhail Baranov
+ * Copyright (c) 2015 Victor Gaydov
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <arm_neon.h>
+
+#include "roc_audio/neon_resampler_kernel.h"
+
+namespace roc {
+namespace audio {
+
+using packet::sample_t;
+
+namespace {
+
+inline float neon_sum(float32x4_t v) {
+    const float32x2_t s = vadd_f32(vget_low_f32(v), vget_high_f32(v));
+    return vget_lane_f32(vpadd_f32(s, s), 0);
+}
+
+inline float32x4_t neon_taps(const float* lo, const float* hi, float32x4_t fract) {
+    const float32x4_t l = vld1q_f32(lo);
+    const float32x4_t h = vld1q_f32(hi);
+    return vmlaq_f32(l, fract, vsubq_f32(h, l));
+}
+
+inline float32x4_t neon_reverse(float32x4_t v) {
+    v = vrev64q_f32(v);
+    return vcombine_f32(vget_high_f32(v), vget_low_f32(v));
+}
+
+} // namespace
+
+const char* NEONResamplerKernel::name() const {
+    return "neon";
+}
+
+sample_t NEONResamplerKernel::forward(sample_t accum,
+                                      const sample_t* samples,
+                                      const float* lo,
+                                      const float* hi,
+                                      float fract,
+                                      size_t n) const {
+    const float32x4_t vfract = vdupq_n_f32(fract);
+    float32x4_t vaccum = vdupq_n_f32(0);
+
+    size_t k = 0;
+
+    for (; k + 4 <= n; k += 4) {
+        const float32x4_t taps = neon_taps(lo + k, hi + k, vfract);
+        vaccum = vmlaq_f32(vaccum, vld1q_f32(samples + k), taps);
+    }
+
+    accum += neon_sum(vaccum);
+
+    for (; k < n; k++) {
+        accum += samples[k] * (lo[k] + fract * (hi[k] - lo[k]));
+    }
+
+    return accum;
+}
+
+sample_t NEONResamplerKernel::backward(sample_t accum,
+                                       const sample_t* samples,
+                                       const float* lo,
+                                       const float* hi,
+                                       float fract,
+                                       size_t n) const {
+    const float32x4_t vfract = vdupq_n_f32(fract);
+    float32x4_t vaccum = vdupq_n_f32(0);
+
+    size_t k = 0;
+
+    for (; k + 4 <= n; k += 4) {
+        const size_t t = n - k - 4;
+        const float32x4_t taps = neon_reverse(neon_taps(lo + t, hi + t, vfract));
+        vaccum = vmlaq_f32(vaccum, vld1q_f32(samples + k), taps);
+    }
+
+    accum += neon_sum(vaccum);
+
+    for (; k < n; k++) {
+        const size_t t = n - 1 - k;
+        accum += samples[k] * (lo[t] + fract * (hi[t] - lo[t]));
+    }
+
+    return accum;
+}
+
+void NEONResamplerKernel::interpolate_forward(
+    float* taps, const float* lo, const float* hi, float fract, size_t n) const {
+    const float32x4_t vfract = vdupq_n_f32(fract);
+
+    size_t k = 0;
+
+    for (; k + 4 <= n; k += 4) {
+        vst1q_f32(taps + k, neon_taps(lo + k, hi + k, vfract));
+    }
+
+    for (; k < n; k++) {
+        taps[k] = lo[k] + fract * (hi[k] - lo[k]);
+    }
+}
+
+void NEONResamplerKernel::interpolate_backward(
+    float* taps, const float* lo, const float* hi, float fract, size_t n) const {
+    const float32x4_t vfract = vdupq_n_f32(fract);
+
+    size_t k = 0;
+
+    for (; k + 4 <= n; k += 4) {
+        const size_t t = n - k - 4;
+        vst1q_f32(taps + k, neon_reverse(neon_taps(lo + t, hi + t, vfract)));
+    }
+
+    for (; k < n; k++) {
+        const size_t t = n - 1 - k;
+        taps[k] = lo[t] + fract * (hi[t] - lo[t]);
+    }
+}
+
+sample_t NEONResamplerKernel::dot(sample_t accum,
+                                  const sample_t* samples,
+                                  const float* taps,
+                                  size_t n) const {
+    float32x4_t vaccum = vdupq_n_f32(0);
+
+    size_t k = 0;
+
+    for (; k + 4 <= n; k += 4) {
+        vaccum = vmlaq_f32(vaccum, vld1q_f32(samples + k), vld1q_f32(taps + k));
+    }
+
+    accum += neon_sum(vaccum);
+
+    for (; k < n; k++) {
+        accum += samples[k] * taps[k];
+    }
+
+    return accum;
+}
+
+} // namespace audio
+} // namespace roc
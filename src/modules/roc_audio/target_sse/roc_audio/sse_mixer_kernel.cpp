@@ -0,0 +1,86 @@
+/*
+ * Copyright (c) 2015 Mikhail Baranov
+ * Copyright (c) 2015 Victor Gaydov
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <emmintrin.h>
+
+#include "roc_audio/sse_mixer_kernel.h"
+
+namespace roc {
+namespace audio {
+
+using packet::sample_t;
+
+const char* SSE2MixerKernel::name() const {
+    return "sse2";
+}
+
+void SSE2MixerKernel::mix(sample_t* out, const sample_t* in, size_t n) const {
+    size_t k = 0;
+
+    for (; k + 8 <= n; k += 8) {
+        const __m128 a0 = _mm_add_ps(_mm_loadu_ps(out + k), _mm_loadu_ps(in + k));
+        const __m128 a1 =
+            _mm_add_ps(_mm_loadu_ps(out + k + 4), _mm_loadu_ps(in + k + 4));
+        _mm_storeu_ps(out + k, a0);
+        _mm_storeu_ps(out + k + 4, a1);
+    }
+
+    for (; k < n; k++) {
+        out[k] += in[k];
+    }
+}
+
+void SSE2MixerKernel::clip(sample_t* out, size_t n) const {
+    const __m128 vmax = _mm_set1_ps(1);
+    const __m128 vmin = _mm_set1_ps(-1);
+
+    size_t k = 0;
+
+    for (; k + 4 <= n; k += 4) {
+        _mm_storeu_ps(out + k, _mm_max_ps(_mm_min_ps(_mm_loadu_ps(out + k), vmax), vmin));
+    }
+
+    for (; k < n; k++) {
+        if (out[k] > 1) {
+            out[k] = 1;
+        } else if (out[k] < -1) {
+            out[k] = -1;
+        }
+    }
+}
+
+void SSE2MixerKernel::interleave(sample_t* out,
+                                 const sample_t* in,
+                                 size_t num_channels,
+                                 size_t n) const {
+    size_t k = 0;
+
+    if (num_channels == 2) {
+        const sample_t* left = in;
+        const sample_t* right = in + n;
+
+        for (; k + 4 <= n; k += 4) {
+            const __m128 l = _mm_loadu_ps(left + k);
+            const __m128 r = _mm_loadu_ps(right + k);
+            _mm_storeu_ps(out + k * 2, _mm_unpacklo_ps(l, r));
+            _mm_storeu_ps(out + k * 2 + 4, _mm_unpackhi_ps(l, r));
+        }
+    }
+
+    for (size_t ch = 0; ch < num_channels; ch++) {
+        const sample_t* ch_in = in + ch * n;
+
+        for (size_t i = k; i < n; i++) {
+            out[i * num_channels + ch] = ch_in[i];
+        }
+    }
+}
+
+} // namespace audio
+} // namespace roc
@@ -0,0 +1,47 @@
+/*
+ * Copyright (c) 2015 Mikhail Baranov
+ * Copyright (c) 2015 Victor Gaydov
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+//! @file roc_audio/target_sse/roc_audio/sse_mixer_kernel.h
+//! @brief SSE2 mixer kernel.
+
+#ifndef ROC_AUDIO_SSE_MIXER_KERNEL_H_
+#define ROC_AUDIO_SSE_MIXER_KERNEL_H_
+
+#include "roc_core/noncopyable.h"
+#include "roc_audio/imixer_kernel.h"
+
+namespace roc {
+namespace audio {
+
+//! SSE2 mixer kernel.
+//! @remarks
+//!  Processes four samples at once. Stereo interleaving is vectorized,
+//!  other channel counts are handled by scalar code.
+class SSE2MixerKernel : public IMixerKernel, public core::NonCopyable<> {
+public:
+    //! Get kernel name.
+    virtual const char* name() const;
+
+    //! Compute out[k] += in[k] for k in [0; n).
+    virtual void mix(packet::sample_t* out, const packet::sample_t* in, size_t n) const;
+
+    //! Clamp out[k] to [-1; 1] for k in [0; n).
+    virtual void clip(packet::sample_t* out, size_t n) const;
+
+    //! Interleave channels.
+    virtual void interleave(packet::sample_t* out,
+                            const packet::sample_t* in,
+                            size_t num_channels,
+                            size_t n) const;
+};
+
+} // namespace audio
+} // namespace roc
+
+#endif // ROC_AUDIO_SSE_MIXER_KERNEL_H_
@@ -0,0 +1,321 @@
+/*
+ * Copyright (c) 2015 Mikhail Baranov
+ * Copyright (c) 2015 Victor Gaydov
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <immintrin.h>
+
+#include "roc_audio/sse_resampler_kernel.h"
+
+namespace roc {
+namespace audio {
+
+using packet::sample_t;
+
+namespace {
+
+inline float sse_sum(__m128 v) {
+    v = _mm_add_ps(v, _mm_movehl_ps(v, v));
+    v = _mm_add_ss(v, _mm_shuffle_ps(v, v, _MM_SHUFFLE(1, 1, 1, 1)));
+    return _mm_cvtss_f32(v);
+}
+
+inline __m128 sse_taps(const float* lo, const float* hi, __m128 fract) {
+    const __m128 l = _mm_loadu_ps(lo);
+    const __m128 h = _mm_loadu_ps(hi);
+    return _mm_add_ps(l, _mm_mul_ps(fract, _mm_sub_ps(h, l)));
+}
+
+__attribute__((target("avx2,fma"))) float
+avx2_sum(__m256 v) {
+    const __m128 s = _mm_add_ps(_mm256_castps256_ps128(v), _mm256_extractf128_ps(v, 1));
+    return sse_sum(s);
+}
+
+__attribute__((target("avx2,fma"))) __m256
+avx2_taps(const float* lo, const float* hi, __m256 fract) {
+    const __m256 l = _mm256_loadu_ps(lo);
+    const __m256 h = _mm256_loadu_ps(hi);
+    return _mm256_fmadd_ps(fract, _mm256_sub_ps(h, l), l);
+}
+
+__attribute__((target("avx2,fma"))) sample_t avx2_forward(sample_t accum,
+                                                          const sample_t* samples,
+                                                          const float* lo,
+                                                          const float* hi,
+                                                          float fract,
+                                                          size_t n) {
+    const __m256 vfract = _mm256_set1_ps(fract);
+    __m256 vaccum = _mm256_setzero_ps();
+
+    size_t k = 0;
+
+    for (; k + 8 <= n; k += 8) {
+        const __m256 taps = avx2_taps(lo + k, hi + k, vfract);
+        vaccum = _mm256_fmadd_ps(_mm256_loadu_ps(samples + k), taps, vaccum);
+    }
+
+    accum += avx2_sum(vaccum);
+
+    for (; k < n; k++) {
+        accum += samples[k] * (lo[k] + fract * (hi[k] - lo[k]));
+    }
+
+    return accum;
+}
+
+__attribute__((target("avx2,fma"))) sample_t avx2_backward(sample_t accum,
+                                                           const sample_t* samples,
+                                                           const float* lo,
+                                                           const float* hi,
+                                                           float fract,
+                                                           size_t n) {
+    const __m256i reverse = _mm256_setr_epi32(7, 6, 5, 4, 3, 2, 1, 0);
+    const __m256 vfract = _mm256_set1_ps(fract);
+    __m256 vaccum = _mm256_setzero_ps();
+
+    size_t k = 0;
+
+    for (; k + 8 <= n; k += 8) {
+        const size_t t = n - k - 8;
+        const __m256 taps =
+            _mm256_permutevar8x32_ps(avx2_taps(lo + t, hi + t, vfract), reverse);
+        vaccum = _mm256_fmadd_ps(_mm256_loadu_ps(samples + k), taps, vaccum);
+    }
+
+    accum += avx2_sum(vaccum);
+
+    for (; k < n; k++) {
+        const size_t t = n - 1 - k;
+        accum += samples[k] * (lo[t] + fract * (hi[t] - lo[t]));
+    }
+
+    return accum;
+}
+
+__attribute__((target("avx2,fma"))) void avx2_interpolate_forward(
+    float* taps, const float* lo, const float* hi, float fract, size_t n) {
+    const __m256 vfract = _mm256_set1_ps(fract);
+
+    size_t k = 0;
+
+    for (; k + 8 <= n; k += 8) {
+        _mm256_storeu_ps(taps + k, avx2_taps(lo + k, hi + k, vfract));
+    }
+
+    for (; k < n; k++) {
+        taps[k] = lo[k] + fract * (hi[k] - lo[k]);
+    }
+}
+
+__attribute__((target("avx2,fma"))) void avx2_interpolate_backward(
+    float* taps, const float* lo, const float* hi, float fract, size_t n) {
+    const __m256i reverse = _mm256_setr_epi32(7, 6, 5, 4, 3, 2, 1, 0);
+    const __m256 vfract = _mm256_set1_ps(fract);
+
+    size_t k = 0;
+
+    for (; k + 8 <= n; k += 8) {
+        const size_t t = n - k - 8;
+        _mm256_storeu_ps(taps + k, _mm256_permutevar8x32_ps(
+                                       avx2_taps(lo + t, hi + t, vfract), reverse));
+    }
+
+    for (; k < n; k++) {
+        const size_t t = n - 1 - k;
+        taps[k] = lo[t] + fract * (hi[t] - lo[t]);
+    }
+}
+
+__attribute__((target("avx2,fma"))) sample_t
+avx2_dot(sample_t accum, const sample_t* samples, const float* taps, size_t n) {
+    __m256 vaccum0 = _mm256_setzero_ps();
+    __m256 vaccum1 = _mm256_setzero_ps();
+
+    size_t k = 0;
+
+    for (; k + 16 <= n; k += 16) {
+        vaccum0 = _mm256_fmadd_ps(_mm256_loadu_ps(samples + k),
+                                  _mm256_loadu_ps(taps + k), vaccum0);
+        vaccum1 = _mm256_fmadd_ps(_mm256_loadu_ps(samples + k + 8),
+                                  _mm256_loadu_ps(taps + k + 8), vaccum1);
+    }
+
+    for (; k + 8 <= n; k += 8) {
+        vaccum0 = _mm256_fmadd_ps(_mm256_loadu_ps(samples + k),
+                                  _mm256_loadu_ps(taps + k), vaccum0);
+    }
+
+    accum += avx2_sum(_mm256_add_ps(vaccum0, vaccum1));
+
+    for (; k < n; k++) {
+        accum += samples[k] * taps[k];
+    }
+
+    return accum;
+}
+
+} // namespace
+
+const char* SSE2ResamplerKernel::name() const {
+    return "sse2";
+}
+
+sample_t SSE2ResamplerKernel::forward(sample_t accum,
+                                      const sample_t* samples,
+                                      const float* lo,
+                                      const float* hi,
+                                      float fract,
+                                      size_t n) const {
+    const __m128 vfract = _mm_set1_ps(fract);
+    __m128 vaccum = _mm_setzero_ps();
+
+    size_t k = 0;
+
+    for (; k + 4 <= n; k += 4) {
+        const __m128 taps = sse_taps(lo + k, hi + k, vfract);
+        vaccum = _mm_add_ps(vaccum, _mm_mul_ps(_mm_loadu_ps(samples + k), taps));
+    }
+
+    accum += sse_sum(vaccum);
+
+    for (; k < n; k++) {
+        accum += samples[k] * (lo[k] + fract * (hi[k] - lo[k]));
+    }
+
+    return accum;
+}
+
+sample_t SSE2ResamplerKernel::backward(sample_t accum,
+                                       const sample_t* samples,
+                                       const float* lo,
+                                       const float* hi,
+                                       float fract,
+                                       size_t n) const {
+    const __m128 vfract = _mm_set1_ps(fract);
+    __m128 vaccum = _mm_setzero_ps();
+
+    size_t k = 0;
+
+    for (; k + 4 <= n; k += 4) {
+        const size_t t = n - k - 4;
+        __m128 taps = sse_taps(lo + t, hi + t, vfract);
+        taps = _mm_shuffle_ps(taps, taps, _MM_SHUFFLE(0, 1, 2, 3));
+        vaccum = _mm_add_ps(vaccum, _mm_mul_ps(_mm_loadu_ps(samples + k), taps));
+    }
+
+    accum += sse_sum(vaccum);
+
+    for (; k < n; k++) {
+        const size_t t = n - 1 - k;
+        accum += samples[k] * (lo[t] + fract * (hi[t] - lo[t]));
+    }
+
+    return accum;
+}
+
+void SSE2ResamplerKernel::interpolate_forward(
+    float* taps, const float* lo, const float* hi, float fract, size_t n) const {
+    const __m128 vfract = _mm_set1_ps(fract);
+
+    size_t k = 0;
+
+    for (; k + 4 <= n; k += 4) {
+        _mm_storeu_ps(taps + k, sse_taps(lo + k, hi + k, vfract));
+    }
+
+    for (; k < n; k++) {
+        taps[k] = lo[k] + fract * (hi[k] - lo[k]);
+    }
+}
+
+void SSE2ResamplerKernel::interpolate_backward(
+    float* taps, const float* lo, const float* hi, float fract, size_t n) const {
+    const __m128 vfract = _mm_set1_ps(fract);
+
+    size_t k = 0;
+
+    for (; k + 4 <= n; k += 4) {
+        const size_t t = n - k - 4;
+        const __m128 v = sse_taps(lo + t, hi + t, vfract);
+        _mm_storeu_ps(taps + k, _mm_shuffle_ps(v, v, _MM_SHUFFLE(0, 1, 2, 3)));
+    }
+
+    for (; k < n; k++) {
+        const size_t t = n - 1 - k;
+        taps[k] = lo[t] + fract * (hi[t] - lo[t]);
+    }
+}
+
+sample_t SSE2ResamplerKernel::dot(sample_t accum,
+                                  const sample_t* samples,
+                                  const float* taps,
+                                  size_t n) const {
+    __m128 vaccum = _mm_setzero_ps();
+
+    size_t k = 0;
+
+    for (; k + 4 <= n; k += 4) {
+        vaccum = _mm_add_ps(vaccum,
+                            _mm_mul_ps(_mm_loadu_ps(samples + k), _mm_loadu_ps(taps + k)));
+    }
+
+    accum += sse_sum(vaccum);
+
+    for (; k < n; k++) {
+        accum += samples[k] * taps[k];
+    }
+
+    return accum;
+}
+
+bool AVX2ResamplerKernel::supported() {
+    __builtin_cpu_init();
+    return __builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma");
+}
+
+const char* AVX2ResamplerKernel::name() const {
+    return "avx2";
+}
+
+sample_t AVX2ResamplerKernel::forward(sample_t accum,
+                                      const sample_t* samples,
+                                      const float* lo,
+                                      const float* hi,
+                                      float fract,
+                                      size_t n) const {
+    return avx2_forward(accum, samples, lo, hi, fract, n);
+}
+
+sample_t AVX2ResamplerKernel::backward(sample_t accum,
+                                       const sample_t* samples,
+                                       const float* lo,
+                                       const float* hi,
+                                       float fract,
+                                       size_t n) const {
+    return avx2_backward(accum, samples, lo, hi, fract, n);
+}
+
+void AVX2ResamplerKernel::interpolate_forward(
+    float* taps, const float* lo, const float* hi, float fract, size_t n) const {
+    avx2_interpolate_forward(taps, lo, hi, fract, n);
+}
+
+void AVX2ResamplerKernel::interpolate_backward(
+    float* taps, const float* lo, const float* hi, float fract, size_t n) const {
+    avx2_interpolate_backward(taps, lo, hi, fract, n);
+}
+
+sample_t AVX2ResamplerKernel::dot(sample_t accum,
+                                  const sample_t* samples,
+                                  const float* taps,
+                                  size_t n) const {
+    return avx2_dot(accum, samples, taps, n);
+}
+
+} // namespace audio
+} // namespace roc
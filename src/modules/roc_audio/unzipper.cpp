@@ -0,0 +1,119 @@
+/*
+ * Copyright (c) 2015 Mikhail Baranov
+ * Copyright (c) 2015 Victor Gaydov
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "roc_core/stddefs.h"
+#include "roc_core/panic.h"
+
+#include "roc_audio/unzipper.h"
+
+namespace roc {
+namespace audio {
+
+Unzipper::Unzipper(IStreamReader& reader,
+                   packet::channel_mask_t channels,
+                   ISampleBufferComposer& composer)
+    : reader_(reader)
+    , channels_(channels)
+    , num_channels_(packet::num_channels(channels))
+    , index_(MaxChannels)
+    , pos_(MaxChannels) {
+    if (channels_ == 0) {
+        roc_panic("unzipper: channel mask is zero");
+    }
+
+    if (!(buffer_ = composer.compose())) {
+        roc_panic("unzipper: can't compose buffer in constructor");
+    }
+
+    if (buffer_->max_size() < num_channels_) {
+        roc_panic("unzipper: buffer is too small");
+    }
+
+    buffer_->set_size(0);
+
+    size_t index = 0;
+
+    for (packet::channel_t ch = 0; ch < MaxChannels; ch++) {
+        new (readers_.allocate()) Reader(this, ch);
+
+        if (channels_ & (1 << ch)) {
+            index_[ch] = index++;
+        }
+    }
+}
+
+IStreamReader& Unzipper::reader(packet::channel_t ch) {
+    if ((channels_ & (1 << ch)) == 0) {
+        roc_panic("unzipper: can't get reader for channel not in channel mask "
+                  "(channel = %u, channel_mask = 0x%x)",
+                  (unsigned)ch, (unsigned)channels_);
+    }
+
+    return readers_[ch];
+}
+
+void Unzipper::Reader::read(const ISampleBufferSlice& out) {
+    roc_panic_if(!unzipper_);
+    unzipper_->read_(ch_, out);
+}
+
+void Unzipper::read_(packet::channel_t ch, const ISampleBufferSlice& out) {
+    roc_panic_if((channels_ & (1 << ch)) == 0);
+
+    packet::sample_t* out_data = out.data();
+    const size_t out_sz = out.size();
+
+    if (out_data == NULL) {
+        roc_panic("unzipper: attempting to pass empty buffer");
+    }
+
+    for (size_t n = 0; n < out_sz;) {
+        if (pos_[ch] == buffer_->size() / num_channels_) {
+            fill_(ch, out_sz - n);
+        }
+
+        const packet::sample_t* data = buffer_->data() + index_[ch];
+
+        const size_t end = buffer_->size() / num_channels_;
+        size_t pos = pos_[ch];
+
+        for (; n < out_sz && pos < end; n++, pos++) {
+            out_data[n] = data[pos * num_channels_];
+        }
+
+        pos_[ch] = pos;
+    }
+}
+
+void Unzipper::fill_(packet::channel_t ch, size_t num_samples) {
+    const size_t num_buffered = buffer_->size() / num_channels_;
+
+    for (packet::channel_t c = 0; c < MaxChannels; c++) {
+        if ((channels_ & (1 << c)) && pos_[c] != num_buffered) {
+            roc_panic("unzipper: channels are read out of lockstep "
+                      "(channel = %u, lagging channel = %u)",
+                      (unsigned)ch, (unsigned)c);
+        }
+    }
+
+    const size_t max_samples = buffer_->max_size() / num_channels_;
+    if (num_samples > max_samples) {
+        num_samples = max_samples;
+    }
+
+    buffer_->set_size(num_samples * num_channels_);
+    reader_.read(*buffer_);
+
+    for (packet::channel_t c = 0; c < MaxChannels; c++) {
+        pos_[c] = 0;
+    }
+}
+
+} // namespace audio
+} // namespace roc
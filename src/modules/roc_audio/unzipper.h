@@ -0,0 +1,101 @@
+/*
+ * Copyright (c) 2015 Mikhail Baranov
+ * Copyright (c) 2015 Victor Gaydov
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+//! @file roc_audio/unzipper.h
+//! @brief Unzipper.
+
+#ifndef ROC_AUDIO_UNZIPPER_H_
+#define ROC_AUDIO_UNZIPPER_H_
+
+#include "roc_config/config.h"
+
+#include "roc_core/noncopyable.h"
+#include "roc_core/array.h"
+
+#include "roc_packet/units.h"
+
+#include "roc_audio/sample_buffer.h"
+#include "roc_audio/istream_reader.h"
+
+namespace roc {
+namespace audio {
+
+//! Unzipper.
+//!
+//! Splits one input stream in interleaved format into multiple output
+//! streams, one per channel. This is the inverse of Zipper.
+//!
+//! For example, this input stream:
+//! @code
+//!  1, 2, 3, 4, 5, 6, ...
+//! @endcode
+//!
+//! is transformed into these two output streams:
+//! @code
+//!  1, 3, 5, ...
+//!  2, 4, 6, ...
+//! @endcode
+//!
+//! @remarks
+//!  Channel streams should be read in lockstep, i.e. every channel should
+//!  read its samples before any channel proceeds to samples following them.
+//!  This is what ChannelMuxer does.
+class Unzipper : public core::NonCopyable<> {
+public:
+    //! Initialize.
+    //!
+    //! @b Parameters
+    //!  - @p reader is input stream in interleaved format;
+    //!  - @p channels is bitmask of channels in input stream;
+    //!  - @p composer is used to construct temporary buffer.
+    Unzipper(IStreamReader& reader,
+             packet::channel_mask_t channels = ROC_CONFIG_DEFAULT_CHANNEL_MASK,
+             ISampleBufferComposer& composer = default_buffer_composer());
+
+    //! Get stream reader for given channel.
+    IStreamReader& reader(packet::channel_t ch);
+
+private:
+    static const size_t MaxChannels = ROC_CONFIG_MAX_CHANNELS;
+
+    friend class Reader;
+
+    class Reader : public IStreamReader, public core::NonCopyable<> {
+    public:
+        virtual void read(const ISampleBufferSlice&);
+
+        Reader(Unzipper* unzipper = NULL, packet::channel_t ch = 0)
+            : unzipper_(unzipper)
+            , ch_(ch) {
+        }
+
+    private:
+        Unzipper* unzipper_;
+        packet::channel_t ch_;
+    };
+
+    void read_(packet::channel_t ch, const ISampleBufferSlice&);
+    void fill_(packet::channel_t ch, size_t num_samples);
+
+    IStreamReader& reader_;
+
+    const packet::channel_mask_t channels_;
+    const size_t num_channels_;
+
+    ISampleBufferPtr buffer_;
+
+    core::Array<size_t, MaxChannels> index_;
+    core::Array<size_t, MaxChannels> pos_;
+    core::Array<Reader, MaxChannels> readers_;
+};
+
+} // namespace audio
+} // namespace roc
+
+#endif // ROC_AUDIO_UNZIPPER_H_
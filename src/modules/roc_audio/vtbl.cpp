@@ -11,6 +11,8 @@
 #include "roc_audio/isample_buffer_reader.h"
 #include "roc_audio/isample_buffer_writer.h"
 #include "roc_audio/isink.h"
+#include "roc_audio/iresampler_kernel.h"
+#include "roc_audio/imixer_kernel.h"
 
 namespace roc {
 namespace audio {
@@ -27,5 +29,11 @@ ISampleBufferWriter::~ISampleBufferWriter() {
 ISink::~ISink() {
 }
 
+IResamplerKernel::~IResamplerKernel() {
+}
+
+IMixerKernel::~IMixerKernel() {
+}
+
 } // namespace audio
 } // namespace roc
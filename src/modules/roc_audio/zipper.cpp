@@ -15,7 +15,8 @@
 namespace roc {
 namespace audio {
 
-Zipper::Zipper(ISampleBufferComposer& composer) {
+Zipper::Zipper(ISampleBufferComposer& composer, IMixerKernel& kernel)
+    : kernel_(kernel) {
     if (!(temp_ = composer.compose())) {
         roc_panic("zipper: can't compose buffer in constructor");
     }
@@ -53,25 +54,38 @@ void Zipper::read(const ISampleBufferSlice& out) {
                   (unsigned)out_sz, (unsigned)num_readers);
     }
 
-    size_t temp_sz = (out_sz / num_readers);
+    // Input streams are read into consecutive parts of temporary buffer
+    // and then interleaved at once. If output is larger than temporary
+    // buffer, it's processed in several chunks.
+    const size_t max_chunk_sz = temp_->max_size() / num_readers;
 
-    temp_->set_size(temp_sz);
+    if (max_chunk_sz == 0) {
+        roc_panic("zipper: too many readers for temporary buffer "
+                  "(num_readers=%u, max_size=%u)",
+                  (unsigned)num_readers, (unsigned)temp_->max_size());
+    }
 
-    size_t cur_reader = 0;
+    size_t out_off = 0;
 
-    for (IStreamReader* reader = readers_.front(); reader;
-         reader = readers_.next(*reader)) {
-        reader->read(*temp_);
+    while (out_off < out_sz) {
+        size_t chunk_sz = (out_sz - out_off) / num_readers;
+        if (chunk_sz > max_chunk_sz) {
+            chunk_sz = max_chunk_sz;
+        }
 
-        roc_panic_if(temp_->size() != temp_sz);
+        temp_->set_size(chunk_sz * num_readers);
 
-        packet::sample_t* temp_data = temp_->data();
+        size_t temp_off = 0;
 
-        for (size_t n = 0; n < temp_sz; n++) {
-            out_data[n * num_readers + cur_reader] = temp_data[n];
+        for (IStreamReader* reader = readers_.front(); reader;
+             reader = readers_.next(*reader)) {
+            reader->read(ISampleBufferSlice(*temp_, temp_off, chunk_sz));
+            temp_off += chunk_sz;
         }
 
-        cur_reader++;
+        kernel_.interleave(out_data + out_off, temp_->data(), num_readers, chunk_sz);
+
+        out_off += chunk_sz * num_readers;
     }
 }
 
@@ -20,6 +20,8 @@
 
 #include "roc_audio/sample_buffer.h"
 #include "roc_audio/istream_reader.h"
+#include "roc_audio/imixer_kernel.h"
+#include "roc_audio/default_mixer_kernel.h"
 
 namespace roc {
 namespace audio {
@@ -42,7 +44,12 @@ namespace audio {
 class Zipper : public IStreamReader, public core::NonCopyable<> {
 public:
     //! Initialize.
-    explicit Zipper(ISampleBufferComposer& composer = default_buffer_composer());
+    //!
+    //! @b Parameters
+    //!  - @p composer is used to construct temporary buffer
+    //!  - @p kernel implements interleaving loop
+    explicit Zipper(ISampleBufferComposer& composer = default_buffer_composer(),
+                    IMixerKernel& kernel = default_mixer_kernel());
 
     //! Read samples from output stream.
     virtual void read(const ISampleBufferSlice&);
@@ -57,6 +64,8 @@ private:
     core::List<IStreamReader, core::NoOwnership> readers_;
 
     ISampleBufferPtr temp_;
+
+    IMixerKernel& kernel_;
 };
 
 } // namespace audio
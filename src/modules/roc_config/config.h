@@ -19,8 +19,14 @@
 //! Maximum number of sending/receiving ports.
 #define ROC_CONFIG_MAX_PORTS 32
 
+//! Maximum number of datagrams received or sent by one system call.
+#define ROC_CONFIG_MAX_UDP_BATCH 64
+
 //! Maximum number of connected sessions.
-#define ROC_CONFIG_MAX_SESSIONS 10
+#define ROC_CONFIG_MAX_SESSIONS 4096
+
+//! Maximum number of server worker threads.
+#define ROC_CONFIG_MAX_SERVER_WORKERS 16
 
 //! Maximum number of different queues per session.
 #define ROC_CONFIG_MAX_SESSION_QUEUES 5
@@ -28,10 +34,14 @@
 //! Maximum number of packets per queue of one session.
 #define ROC_CONFIG_MAX_SESSION_PACKETS 1000
 
-//! Maximum number of datagrams.
-#define ROC_CONFIG_MAX_DATAGRAMS                                                         \
-    (ROC_CONFIG_MAX_SESSIONS * ROC_CONFIG_MAX_SESSION_QUEUES                             \
-     * ROC_CONFIG_MAX_SESSION_PACKETS)
+//! Maximum number of datagrams in default datagram queue.
+//! @remarks
+//!  Independent of ROC_CONFIG_MAX_SESSIONS, which is only a hard upper
+//!  limit for ServerConfig::max_sessions.
+#define ROC_CONFIG_MAX_DATAGRAMS 50000
+
+//! Default capacity of lock-free datagram ring.
+#define ROC_CONFIG_DEFAULT_DATAGRAM_RING_SIZE 16384
 
 //! Maximum number of sample buffers.
 #define ROC_CONFIG_MAX_SAMPLE_BUFFERS 100
@@ -49,6 +59,15 @@
 //! Bitmask of enabled audio channels.
 #define ROC_CONFIG_DEFAULT_CHANNEL_MASK 0x3
 
+//! Default limit for number of connected sessions.
+//! @remarks
+//!  Server preallocates memory for this number of sessions. Should not
+//!  exceed ROC_CONFIG_MAX_SESSIONS.
+#define ROC_CONFIG_DEFAULT_MAX_SESSIONS 64
+
+//! Default number of datagrams received by one system call.
+#define ROC_CONFIG_DEFAULT_UDP_BATCH 32
+
 //! Number of audio samples per second.
 #define ROC_CONFIG_DEFAULT_SAMPLE_RATE 44100
 
@@ -65,12 +84,30 @@
 //!  doesn't affect allowed packet size or tick size.
 #define ROC_CONFIG_DEFAULT_RESAMPLER_FRAME_SAMPLES 96
 
+//! Number of phases in polyphase resampler filter bank.
+//! @remarks
+//!  Should be a power of two. More phases mean lower phase error and larger
+//!  bank (every phase occupies 512 bytes).
+#define ROC_CONFIG_DEFAULT_RESAMPLER_PHASES 1024
+
 //! Session timeout (number of samples per channel).
 #define ROC_CONFIG_DEFAULT_SESSION_TIMEOUT (ROC_CONFIG_DEFAULT_SERVER_TICK_SAMPLES * 100)
 
 //! Latency audio renderer (samples per channel).
 #define ROC_CONFIG_DEFAULT_SESSION_LATENCY (ROC_CONFIG_DEFAULT_PACKET_SAMPLES * 27)
 
+//! Minimum latency of audio renderer when latency tuning is enabled
+//! (samples per channel).
+#define ROC_CONFIG_DEFAULT_MIN_SESSION_LATENCY (ROC_CONFIG_DEFAULT_PACKET_SAMPLES * 4)
+
+//! Maximum latency of audio renderer when latency tuning is enabled
+//! (samples per channel).
+#define ROC_CONFIG_DEFAULT_MAX_SESSION_LATENCY (ROC_CONFIG_DEFAULT_PACKET_SAMPLES * 100)
+
+//! Initial latency of audio renderer when fast start is enabled
+//! (samples per channel).
+#define ROC_CONFIG_DEFAULT_FAST_START_LATENCY (ROC_CONFIG_DEFAULT_PACKET_SAMPLES * 3)
+
 //! Latency for audio output (samples per channel).
 #define ROC_CONFIG_DEFAULT_OUTPUT_LATENCY (ROC_CONFIG_DEFAULT_PACKET_SAMPLES * 20)
 
@@ -83,4 +120,10 @@
 //! Number of FEC packets in block.
 #define ROC_CONFIG_DEFAULT_FEC_BLOCK_REDUNDANT_PACKETS 10
 
+//! Maximum number of data packets in block.
+#define ROC_CONFIG_MAX_FEC_BLOCK_DATA_PACKETS 128
+
+//! Maximum number of FEC packets in block.
+#define ROC_CONFIG_MAX_FEC_BLOCK_REDUNDANT_PACKETS 128
+
 #endif // ROC_CONFIG_CONFIG_H_
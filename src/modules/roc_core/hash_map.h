@@ -0,0 +1,166 @@
+/*
+ * Copyright (c) 2015 Mikhail Baranov
+ * Copyright (c) 2015 Victor Gaydov
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+//! @file roc_core/hash_map.h
+//! @brief Hash map.
+
+#ifndef ROC_CORE_HASH_MAP_H_
+#define ROC_CORE_HASH_MAP_H_
+
+#include "roc_core/stddefs.h"
+#include "roc_core/noncopyable.h"
+#include "roc_core/panic.h"
+#include "roc_core/hash.h"
+
+namespace roc {
+namespace core {
+
+//! Hash map.
+//!
+//! Open addressing hash map with linear probing and fixed capacity.
+//!
+//! @tparam Key should be copyable and define operator==() and
+//!  hash() method returning size_t (see hash_combine()).
+//! @tparam Value should be copyable and default-constructible.
+//!
+//! @remarks
+//!  Memory for all slots is allocated in constructor and is never
+//!  reallocated, so insert(), find() and remove() don't allocate. Table
+//!  is kept at most half full. Removal shifts following entries back
+//!  instead of leaving tombstones, so lookups don't degrade over time.
+template <class Key, class Value> class HashMap : public NonCopyable<> {
+public:
+    //! Initialize map able to hold up to @p max_size entries.
+    explicit HashMap(size_t max_size)
+        : slots_(NULL)
+        , mask_(0)
+        , size_(0)
+        , max_size_(max_size) {
+        size_t n_slots = 2;
+        while (n_slots < max_size * 2) {
+            n_slots *= 2;
+        }
+
+        slots_ = new (std::nothrow) Slot[n_slots];
+        if (!slots_) {
+            roc_panic("hash map: can't allocate %lu slots", (unsigned long)n_slots);
+        }
+
+        mask_ = n_slots - 1;
+    }
+
+    ~HashMap() {
+        delete[] slots_;
+    }
+
+    //! Get number of entries.
+    size_t size() const {
+        return size_;
+    }
+
+    //! Get maximum number of entries.
+    size_t max_size() const {
+        return max_size_;
+    }
+
+    //! Find value by key.
+    //! @returns
+    //!  pointer to value or NULL if there is no such key.
+    Value* find(const Key& key) const {
+        for (size_t n = key.hash() & mask_;; n = (n + 1) & mask_) {
+            if (!slots_[n].used) {
+                return NULL;
+            }
+            if (slots_[n].key == key) {
+                return &slots_[n].value;
+            }
+        }
+    }
+
+    //! Insert entry.
+    //! @returns
+    //!  false if map is full.
+    //! @pre
+    //!  Map should not contain @p key.
+    bool insert(const Key& key, const Value& value) {
+        if (size_ == max_size_) {
+            return false;
+        }
+
+        size_t n = key.hash() & mask_;
+
+        for (; slots_[n].used; n = (n + 1) & mask_) {
+            if (slots_[n].key == key) {
+                roc_panic("hash map: attempting to insert duplicate key");
+            }
+        }
+
+        slots_[n].key = key;
+        slots_[n].value = value;
+        slots_[n].used = true;
+
+        size_++;
+        return true;
+    }
+
+    //! Remove entry.
+    //! @returns
+    //!  false if there is no such key.
+    bool remove(const Key& key) {
+        size_t n = key.hash() & mask_;
+
+        for (;; n = (n + 1) & mask_) {
+            if (!slots_[n].used) {
+                return false;
+            }
+            if (slots_[n].key == key) {
+                break;
+            }
+        }
+
+        // Move back entries that would become unreachable after removal.
+        for (size_t next = (n + 1) & mask_; slots_[next].used; next = (next + 1) & mask_) {
+            const size_t home = slots_[next].key.hash() & mask_;
+
+            if (((next - home) & mask_) >= ((next - n) & mask_)) {
+                slots_[n] = slots_[next];
+                n = next;
+            }
+        }
+
+        slots_[n] = Slot();
+
+        size_--;
+        return true;
+    }
+
+private:
+    struct Slot {
+        Key key;
+        Value value;
+        bool used;
+
+        Slot()
+            : key()
+            , value()
+            , used(false) {
+        }
+    };
+
+    Slot* slots_;
+    size_t mask_;
+
+    size_t size_;
+    const size_t max_size_;
+};
+
+} // namespace core
+} // namespace roc
+
+#endif // ROC_CORE_HASH_MAP_H_
@@ -16,8 +16,10 @@
 #include "roc_core/stddefs.h"
 #include "roc_core/noncopyable.h"
 #include "roc_core/panic.h"
-#include "roc_core/atomic.h"
-#include "roc_core/shared_ptr.h"
+#include "roc_core/list.h"
+#include "roc_core/spin_mutex.h"
+#include "roc_core/aligned_storage.h"
+#include "roc_core/helpers.h"
 #include "roc_core/singleton.h"
 #include "roc_core/ipool.h"
 
@@ -25,34 +27,74 @@ namespace roc {
 namespace core {
 
 //! IPool implementation using heap.
+//!
+//! Memory of deallocated objects isn't returned to heap but is kept for
+//! subsequent allocations until pool is destroyed. When number of objects
+//! in use stops growing, allocate() and deallocate() never touch heap.
 template <class T> class HeapPool : public IPool<T>, public NonCopyable<> {
 public:
+    HeapPool()
+        : num_allocated_(0) {
+    }
+
     ~HeapPool() {
         if (num_allocated_ != 0) {
             roc_panic("memory leak in heap pool: %u leaked elements",
                       (unsigned)num_allocated_);
         }
+
+        while (ListNode* node = free_nodes_.back()) {
+            free_nodes_.remove(*node);
+            node->~ListNode();
+            delete[](char*)ROC_CONTAINER_OF(node, Element, u_node);
+        }
     }
 
     //! Allocate memory for new object.
     virtual void* allocate() {
-        // Note: `new char[]` returns memory aligned for any type.
-        void* memory = new (std::nothrow) char[sizeof(T)];
-        if (memory != NULL) {
+        ListNode* node;
+        {
+            SpinMutex::Lock lock(mutex_);
+            node = free_nodes_.back();
+            if (node != NULL) {
+                free_nodes_.remove(*node);
+            }
             ++num_allocated_;
         }
-        return memory;
+
+        if (node != NULL) {
+            Element* elem = ROC_CONTAINER_OF(node, Element, u_node);
+            node->~ListNode();
+            return elem->u_data.mem();
+        }
+
+        // Note: `new char[]` returns memory aligned for any type.
+        Element* elem = (Element*)(void*)new (std::nothrow) char[sizeof(Element)];
+        if (elem == NULL) {
+            SpinMutex::Lock lock(mutex_);
+            --num_allocated_;
+            return NULL;
+        }
+
+        return elem->u_data.mem();
     }
 
     //! Destroy previously allocated object and memory.
     virtual void deallocate(void* memory) {
         roc_panic_if(memory == NULL);
+
+        Element* elem = ROC_CONTAINER_OF(&AlignedStorage<T>::container_of(*(T*)memory),
+                                         Element, u_data);
+
+        ListNode* node = new (elem->u_node.mem()) ListNode();
+
+        SpinMutex::Lock lock(mutex_);
         if (num_allocated_ == 0) {
             roc_panic(
                 "trying to deallocate more objects than were allocated in heap pool");
         }
         --num_allocated_;
-        delete[](char*)memory;
+        free_nodes_.append(*node);
     }
 
     //! Check if this object belongs to this pool.
@@ -60,13 +102,33 @@ public:
         roc_panic_if(&object == NULL);
     }
 
+    //! Number of objects currently allocated from pool.
+    size_t num_allocated() {
+        SpinMutex::Lock lock(mutex_);
+        return num_allocated_;
+    }
+
+    //! Number of elements kept for reuse.
+    size_t num_free() {
+        SpinMutex::Lock lock(mutex_);
+        return free_nodes_.size();
+    }
+
     //! Get static instance.
     static HeapPool& instance() {
         return Singleton<HeapPool>::instance();
     }
 
 private:
-    Atomic num_allocated_;
+    union Element {
+        AlignedStorage<T> u_data;
+        AlignedStorage<ListNode> u_node;
+    };
+
+    size_t num_allocated_;
+
+    List<ListNode, NoOwnership> free_nodes_;
+    SpinMutex mutex_;
 };
 
 } // namespace core
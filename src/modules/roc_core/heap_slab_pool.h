@@ -0,0 +1,137 @@
+/*
+ * Copyright (c) 2015 Mikhail Baranov
+ * Copyright (c) 2015 Victor Gaydov
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+//! @file roc_core/heap_slab_pool.h
+//! @brief Slab pool with storage allocated on heap.
+
+#ifndef ROC_CORE_HEAP_SLAB_POOL_H_
+#define ROC_CORE_HEAP_SLAB_POOL_H_
+
+#include "roc_core/ipool.h"
+#include "roc_core/noncopyable.h"
+#include "roc_core/list.h"
+#include "roc_core/panic.h"
+#include "roc_core/spin_mutex.h"
+#include "roc_core/aligned_storage.h"
+#include "roc_core/helpers.h"
+
+namespace roc {
+namespace core {
+
+//! Slab pool with storage allocated on heap.
+//!
+//! Same as SlabPool, but number of elements is defined at run time and
+//! storage for all elements is allocated once in constructor. allocate()
+//! and deallocate() never touch heap.
+//!
+//! @tparam T defines object type in memory.
+template <class T> class HeapSlabPool : public IPool<T>, public NonCopyable<> {
+public:
+    //! Initialize pool with @p size elements.
+    explicit HeapSlabPool(size_t size)
+        : size_(size) {
+        elements_ = new (std::nothrow) Element[size_];
+        if (!elements_) {
+            roc_panic("heap slab pool: can't allocate %u elements", (unsigned)size_);
+        }
+
+        for (size_t i = 0; i < size_; ++i) {
+            ListNode* node = new (elements_[i].u_node.mem()) ListNode();
+            free_nodes_.append(*node);
+        }
+    }
+
+    ~HeapSlabPool() {
+        if (free_nodes_.size() != size_) {
+            roc_panic("memory leak in heap slab pool: %u leaked elements",
+                      (unsigned)(size_ - free_nodes_.size()));
+        }
+
+        while (ListNode* node = free_nodes_.back()) {
+            free_nodes_.remove(*node);
+            node->~ListNode();
+        }
+
+        delete[] elements_;
+    }
+
+    //! Allocate new object.
+    virtual void* allocate() {
+        ListNode* node;
+        {
+            SpinMutex::Lock lock(mutex_);
+            node = free_nodes_.back();
+            if (node != NULL) {
+                free_nodes_.remove(*node);
+            }
+        }
+        if (node != NULL) {
+            Element* elem = ROC_CONTAINER_OF(node, Element, u_node);
+            node->~ListNode();
+            return elem->u_data.mem();
+        } else {
+            return NULL;
+        }
+    }
+
+    //! Destroy previously allocated object and memory.
+    virtual void deallocate(void* memory) {
+        Element* elem = container_of_(memory);
+        ListNode* node = new (elem->u_node.mem()) ListNode();
+        {
+            SpinMutex::Lock lock(mutex_);
+            free_nodes_.append(*node);
+        }
+    }
+
+    //! Check if this object belongs to this pool.
+    virtual void check(T& object) {
+        char* elem = (char*)container_of_(&object);
+        if (elem < (char*)&elements_[0] || elem >= (char*)&elements_[size_]) {
+            roc_panic("object doesn't belong to this pool");
+        }
+        if ((unsigned long)(elem - (char*)elements_) % sizeof(Element) != 0) {
+            roc_panic("object address is misaligned inside pool");
+        }
+    }
+
+    //! Number of elements in pool.
+    size_t size() const {
+        return size_;
+    }
+
+    //! Number of free object available in pool.
+    size_t available() {
+        SpinMutex::Lock lock(mutex_);
+        return free_nodes_.size();
+    }
+
+private:
+    union Element {
+        AlignedStorage<T> u_data;
+        AlignedStorage<ListNode> u_node;
+    };
+
+    Element* container_of_(void* memory) {
+        roc_panic_if(memory == NULL);
+        return ROC_CONTAINER_OF(&AlignedStorage<T>::container_of(*(T*)memory), Element,
+                                u_data);
+    }
+
+    const size_t size_;
+    Element* elements_;
+
+    List<ListNode, NoOwnership> free_nodes_;
+    SpinMutex mutex_;
+};
+
+} // namespace core
+} // namespace roc
+
+#endif // ROC_CORE_HEAP_SLAB_POOL_H_
@@ -141,6 +141,13 @@ private:
         return &storage_.ref();
     }
 
+    const T* safe_get_() const {
+        if (!allocated_) {
+            roc_panic("attempting access non-allocated `maybe' object");
+        }
+        return &storage_.ref();
+    }
+
     typedef AlignedStorage<T> Storage;
 
     Storage storage_;
@@ -52,6 +52,38 @@ public:
         return __sync_sub_and_fetch(&value_, 1);
     }
 
+    //! Atomic load with acquire semantics.
+    //! @remarks
+    //!  Memory operations following the load can't be reordered before it.
+    //!  Legacy __sync builtins have no acquire or release variants, so plain
+    //!  aligned load is followed by full barrier.
+    long load_acquire() const {
+        const long v = *(volatile long*)&value_;
+        __sync_synchronize();
+        return v;
+    }
+
+    //! Atomic store with release semantics.
+    //! @remarks
+    //!  Memory operations preceding the store can't be reordered after it.
+    //!  Implemented as full barrier followed by plain aligned store.
+    void store_release(long v) {
+        __sync_synchronize();
+        *(volatile long*)&value_ = v;
+    }
+
+    //! Atomic exchange.
+    //! @remarks
+    //!  Sets value to @p v and returns previous value. Acts as full
+    //!  memory barrier.
+    long exchange(long v) {
+        long prev;
+        do {
+            prev = *(volatile long*)&value_;
+        } while (!__sync_bool_compare_and_swap(&value_, prev, v));
+        return prev;
+    }
+
     //! Atomic test-and-set.
     //! @remarks
     //!  Atomically sets value to non-zero and returns '0' if previous value
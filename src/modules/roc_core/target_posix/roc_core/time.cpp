@@ -26,6 +26,15 @@ uint64_t timestamp_ms() {
     return uint64_t(ts.tv_sec * 1000 + ts.tv_nsec / 1000000);
 }
 
+uint64_t timestamp_us() {
+    timespec ts;
+    if (clock_gettime(CLOCK_MONOTONIC, &ts) == -1) {
+        roc_panic("clock_gettime(CLOCK_MONOTONIC): %s", errno_to_str().c_str());
+    }
+
+    return uint64_t(ts.tv_sec) * 1000000 + uint64_t(ts.tv_nsec / 1000);
+}
+
 void sleep_until_ms(uint64_t ms) {
     timespec ts;
     ts.tv_sec = ms / 1000;
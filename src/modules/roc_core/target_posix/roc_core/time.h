@@ -21,6 +21,9 @@ namespace core {
 //! Get current timestamp in milliseconds.
 uint64_t timestamp_ms();
 
+//! Get current timestamp in microseconds.
+uint64_t timestamp_us();
+
 //! Sleep until specified absolute time point has been reached.
 //! @remarks
 //!  @p timestamp specifies time point in milleseconds.
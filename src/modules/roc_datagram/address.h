@@ -14,6 +14,7 @@
 #define ROC_DATAGRAM_ADDRESS_H_
 
 #include "roc_core/stddefs.h"
+#include "roc_core/hash.h"
 
 namespace roc {
 namespace datagram {
@@ -43,6 +44,15 @@ struct Address {
     bool operator!=(const Address& other) const {
         return !(*this == other);
     }
+
+    //! Compute hash value.
+    size_t hash() const {
+        size_t h = 0;
+        for (size_t n = 0; n < sizeof(ip); n++) {
+            h = core::hash_combine(h, ip[n]);
+        }
+        return core::hash_combine(h, port);
+    }
 };
 
 } // namespace datagram
@@ -28,9 +28,43 @@ IDatagramConstPtr DatagramQueue::read() {
     return dgm;
 }
 
+size_t DatagramQueue::read_batch(IDatagramConstPtr* dgms, size_t n) {
+    Lock lock(mutex_);
+
+    size_t n_read = 0;
+    for (; n_read < n; n_read++) {
+        IDatagramPtr dgm = list_.front();
+        if (!dgm) {
+            break;
+        }
+        list_.remove(*dgm);
+        dgms[n_read] = dgm;
+    }
+
+    return n_read;
+}
+
 void DatagramQueue::write(const IDatagramPtr& dgm) {
     Lock lock(mutex_);
 
+    append_(dgm);
+}
+
+void DatagramQueue::write_batch(const IDatagramPtr* dgms, size_t n) {
+    Lock lock(mutex_);
+
+    for (size_t i = 0; i < n; i++) {
+        append_(dgms[i]);
+    }
+}
+
+size_t DatagramQueue::size() const {
+    Lock lock(mutex_);
+
+    return list_.size();
+}
+
+void DatagramQueue::append_(const IDatagramPtr& dgm) {
     if (!dgm) {
         roc_panic("attempting to write null datagram to datagram queue");
     }
@@ -48,11 +82,5 @@ void DatagramQueue::write(const IDatagramPtr& dgm) {
     list_.append(*dgm);
 }
 
-size_t DatagramQueue::size() const {
-    Lock lock(mutex_);
-
-    return list_.size();
-}
-
 } // namespace datagram
 } // namespace roc
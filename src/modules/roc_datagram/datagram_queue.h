@@ -40,15 +40,27 @@ public:
     //! Read datagram.
     virtual IDatagramConstPtr read();
 
+    //! Read multiple datagrams.
+    //! @remarks
+    //!  Takes lock once for all datagrams.
+    virtual size_t read_batch(IDatagramConstPtr* dgms, size_t n);
+
     //! Write datagram.
     virtual void write(const IDatagramPtr&);
 
+    //! Write multiple datagrams.
+    //! @remarks
+    //!  Takes lock once for all datagrams.
+    virtual void write_batch(const IDatagramPtr* dgms, size_t n);
+
     //! Number of datagrams in queue.
     size_t size() const;
 
 private:
     typedef core::SpinMutex::Lock Lock;
 
+    void append_(const IDatagramPtr&);
+
     core::SpinMutex mutex_;
     core::List<IDatagram> list_;
 
@@ -0,0 +1,160 @@
+/*
+ * Copyright (c) 2015 Mikhail Baranov
+ * Copyright (c) 2015 Victor Gaydov
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "roc_core/stddefs.h"
+#include "roc_core/log.h"
+#include "roc_core/panic.h"
+
+#include "roc_datagram/datagram_ring.h"
+
+namespace roc {
+namespace datagram {
+
+DatagramRing::DatagramRing(size_t max_size)
+    : slots_(NULL)
+    , mask_(0)
+    , cached_tail_(0)
+    , cached_head_(0)
+    , n_dropped_(0) {
+    size_t n_slots = 1;
+    while (n_slots < max_size) {
+        n_slots *= 2;
+    }
+
+    slots_ = new (std::nothrow) IDatagramPtr[n_slots];
+    if (!slots_) {
+        roc_panic("datagram ring: can't allocate %lu slots", (unsigned long)n_slots);
+    }
+
+    mask_ = n_slots - 1;
+}
+
+DatagramRing::~DatagramRing() {
+    delete[] slots_;
+}
+
+IDatagramConstPtr DatagramRing::read() {
+    const long head = head_.load_acquire();
+
+    if (head == cached_tail_) {
+        cached_tail_ = tail_.load_acquire();
+        if (head == cached_tail_) {
+            return NULL;
+        }
+    }
+
+    IDatagramPtr& slot = slots_[(size_t)head & mask_];
+
+    IDatagramPtr dgm = slot;
+    slot = NULL;
+
+    head_.store_release(head + 1);
+
+    return dgm;
+}
+
+size_t DatagramRing::read_batch(IDatagramConstPtr* dgms, size_t n) {
+    const long head = head_.load_acquire();
+
+    if ((size_t)(cached_tail_ - head) < n) {
+        cached_tail_ = tail_.load_acquire();
+    }
+
+    size_t n_read = (size_t)(cached_tail_ - head);
+    if (n_read > n) {
+        n_read = n;
+    }
+
+    for (size_t i = 0; i < n_read; i++) {
+        IDatagramPtr& slot = slots_[(size_t)(head + (long)i) & mask_];
+
+        dgms[i] = slot;
+        slot = NULL;
+    }
+
+    if (n_read != 0) {
+        head_.store_release(head + (long)n_read);
+    }
+
+    return n_read;
+}
+
+void DatagramRing::write(const IDatagramPtr& dgm) {
+    if (!dgm) {
+        roc_panic("attempting to write null datagram to datagram ring");
+    }
+
+    const long tail = tail_.load_acquire();
+
+    if ((size_t)(tail - cached_head_) > mask_) {
+        cached_head_ = head_.load_acquire();
+        if ((size_t)(tail - cached_head_) > mask_) {
+            roc_log(LOG_TRACE,
+                    "datagram ring is full, dropping new datagram (size = %lu)",
+                    (unsigned long)(mask_ + 1));
+            n_dropped_++;
+            return;
+        }
+    }
+
+    slots_[(size_t)tail & mask_] = dgm;
+
+    tail_.store_release(tail + 1);
+}
+
+void DatagramRing::write_batch(const IDatagramPtr* dgms, size_t n) {
+    for (size_t i = 0; i < n; i++) {
+        if (!dgms[i]) {
+            roc_panic("attempting to write null datagram to datagram ring");
+        }
+    }
+
+    const long tail = tail_.load_acquire();
+
+    size_t n_free = mask_ + 1 - (size_t)(tail - cached_head_);
+    if (n_free < n) {
+        cached_head_ = head_.load_acquire();
+        n_free = mask_ + 1 - (size_t)(tail - cached_head_);
+    }
+
+    size_t n_written = n;
+    if (n_written > n_free) {
+        roc_log(LOG_TRACE,
+                "datagram ring is full, dropping %lu new datagrams (size = %lu)",
+                (unsigned long)(n - n_free), (unsigned long)(mask_ + 1));
+        n_dropped_ += n - n_free;
+        n_written = n_free;
+    }
+
+    for (size_t i = 0; i < n_written; i++) {
+        slots_[(size_t)(tail + (long)i) & mask_] = dgms[i];
+    }
+
+    if (n_written != 0) {
+        tail_.store_release(tail + (long)n_written);
+    }
+}
+
+size_t DatagramRing::size() const {
+    const long head = head_.load_acquire();
+    const long tail = tail_.load_acquire();
+
+    return (size_t)(tail - head);
+}
+
+size_t DatagramRing::max_size() const {
+    return mask_ + 1;
+}
+
+size_t DatagramRing::num_dropped() const {
+    return n_dropped_;
+}
+
+} // namespace datagram
+} // namespace roc
@@ -0,0 +1,114 @@
+/*
+ * Copyright (c) 2015 Mikhail Baranov
+ * Copyright (c) 2015 Victor Gaydov
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+//! @file roc_datagram/datagram_ring.h
+//! @brief Lock-free datagram ring.
+
+#ifndef ROC_DATAGRAM_DATAGRAM_RING_H_
+#define ROC_DATAGRAM_DATAGRAM_RING_H_
+
+#include "roc_config/config.h"
+
+#include "roc_core/noncopyable.h"
+#include "roc_core/atomic.h"
+
+#include "roc_datagram/idatagram_reader.h"
+#include "roc_datagram/idatagram_writer.h"
+
+namespace roc {
+namespace datagram {
+
+//! Lock-free datagram ring.
+//!
+//! Bounded single-producer single-consumer queue. write() may be called
+//! from one thread and read() and read_batch() from another thread
+//! concurrently, without locks.
+//!
+//! @remarks
+//!  Slots are allocated in constructor. If ring is full when datagram
+//!  is written, the new datagram is dropped, since the oldest one is
+//!  owned by reader side.
+class DatagramRing : public IDatagramReader,
+                     public IDatagramWriter,
+                     public core::NonCopyable<> {
+public:
+    //! Construct empty ring.
+    //! @remarks
+    //!  @p max_size is rounded up to power of two.
+    explicit DatagramRing(size_t max_size = ROC_CONFIG_DEFAULT_DATAGRAM_RING_SIZE);
+
+    ~DatagramRing();
+
+    //! Read datagram.
+    //! @note
+    //!  Should be called only from reader thread.
+    virtual IDatagramConstPtr read();
+
+    //! Read multiple datagrams.
+    //! @remarks
+    //!  Reads up to @p n datagrams into @p dgms.
+    //! @returns
+    //!  number of datagrams read.
+    //! @note
+    //!  Should be called only from reader thread.
+    virtual size_t read_batch(IDatagramConstPtr* dgms, size_t n);
+
+    //! Write datagram.
+    //! @note
+    //!  Should be called only from writer thread.
+    virtual void write(const IDatagramPtr&);
+
+    //! Write multiple datagrams.
+    //! @remarks
+    //!  Datagrams are published to reader at once. Datagrams that don't
+    //!  fit into ring are dropped.
+    //! @note
+    //!  Should be called only from writer thread.
+    virtual void write_batch(const IDatagramPtr* dgms, size_t n);
+
+    //! Number of datagrams in ring.
+    size_t size() const;
+
+    //! Maximum number of datagrams in ring.
+    size_t max_size() const;
+
+    //! Number of datagrams dropped because ring was full.
+    size_t num_dropped() const;
+
+private:
+    enum { CacheLine = 64 };
+
+    IDatagramPtr* slots_;
+    size_t mask_;
+
+    char pad0_[CacheLine];
+
+    // Next position to read. Modified only by reader.
+    core::Atomic head_;
+
+    // Last value of tail_ seen by reader.
+    long cached_tail_;
+
+    char pad1_[CacheLine];
+
+    // Next position to write. Modified only by writer.
+    core::Atomic tail_;
+
+    // Last value of head_ seen by writer.
+    long cached_head_;
+
+    size_t n_dropped_;
+
+    char pad2_[CacheLine];
+};
+
+} // namespace datagram
+} // namespace roc
+
+#endif // ROC_DATAGRAM_DATAGRAM_RING_H_
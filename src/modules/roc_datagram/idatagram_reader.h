@@ -27,6 +27,14 @@ public:
     //! @returns
     //!  next datagram or NULL if there is no datagrams.
     virtual IDatagramConstPtr read() = 0;
+
+    //! Read multiple datagrams.
+    //! @remarks
+    //!  Reads up to @p n datagrams into @p dgms. Default implementation calls
+    //!  read() until it returns NULL or @p n datagrams are read.
+    //! @returns
+    //!  number of datagrams read.
+    virtual size_t read_batch(IDatagramConstPtr* dgms, size_t n);
 };
 
 } // namespace datagram
@@ -25,6 +25,12 @@ public:
 
     //! Write datagram.
     virtual void write(const IDatagramPtr&) = 0;
+
+    //! Write multiple datagrams.
+    //! @remarks
+    //!  Writes @p n datagrams from @p dgms. Default implementation calls
+    //!  write() for every datagram.
+    virtual void write_batch(const IDatagramPtr* dgms, size_t n);
 };
 
 } // namespace datagram
@@ -24,8 +24,24 @@ IDatagramComposer::~IDatagramComposer() {
 IDatagramReader::~IDatagramReader() {
 }
 
+size_t IDatagramReader::read_batch(IDatagramConstPtr* dgms, size_t n) {
+    size_t n_read = 0;
+    for (; n_read < n; n_read++) {
+        if (!(dgms[n_read] = read())) {
+            break;
+        }
+    }
+    return n_read;
+}
+
 IDatagramWriter::~IDatagramWriter() {
 }
 
+void IDatagramWriter::write_batch(const IDatagramPtr* dgms, size_t n) {
+    for (size_t i = 0; i < n; i++) {
+        write(dgms[i]);
+    }
+}
+
 } // namespace datagram
 } // namespace roc
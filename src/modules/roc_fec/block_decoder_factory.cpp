@@ -0,0 +1,64 @@
+/*
+ * Copyright (c) 2015 Mikhail Baranov
+ * Copyright (c) 2015 Victor Gaydov
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "roc_core/log.h"
+#include "roc_core/heap_pool.h"
+
+#include "roc_fec/block_decoder_factory.h"
+
+namespace roc {
+namespace fec {
+
+BlockDecoderFactory::BlockDecoderFactory(core::IByteBufferComposer& composer)
+    : composer_(composer)
+    , rs_decoder_(NULL)
+#ifdef ROC_TARGET_OPENFEC
+    , ldpc_decoder_(NULL)
+#endif
+{
+}
+
+BlockDecoderFactory::~BlockDecoderFactory() {
+    if (rs_decoder_) {
+        core::HeapPool<RS_BlockDecoder>::instance().destroy(*rs_decoder_);
+    }
+#ifdef ROC_TARGET_OPENFEC
+    if (ldpc_decoder_) {
+        core::HeapPool<LDPC_BlockDecoder>::instance().destroy(*ldpc_decoder_);
+    }
+#endif
+}
+
+IBlockDecoder* BlockDecoderFactory::new_block_decoder(packet::FECScheme scheme) {
+    switch (scheme) {
+    case packet::FEC_ReedSolomon8:
+        if (!rs_decoder_) {
+            rs_decoder_ = new (core::HeapPool<RS_BlockDecoder>::instance())
+                RS_BlockDecoder(composer_);
+        }
+        return rs_decoder_;
+
+    case packet::FEC_LDPC_Staircase:
+#ifdef ROC_TARGET_OPENFEC
+        if (!ldpc_decoder_) {
+            ldpc_decoder_ = new (core::HeapPool<LDPC_BlockDecoder>::instance())
+                LDPC_BlockDecoder(composer_);
+        }
+        return ldpc_decoder_;
+#else
+        roc_log(LOG_DEBUG, "block decoder factory: OpenFEC support not enabled");
+        return NULL;
+#endif
+    }
+
+    return NULL;
+}
+
+} // namespace fec
+} // namespace roc
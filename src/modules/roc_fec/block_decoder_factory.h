@@ -0,0 +1,59 @@
+/*
+ * Copyright (c) 2015 Mikhail Baranov
+ * Copyright (c) 2015 Victor Gaydov
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+//! @file roc_fec/block_decoder_factory.h
+//! @brief Block decoder factory.
+
+#ifndef ROC_FEC_BLOCK_DECODER_FACTORY_H_
+#define ROC_FEC_BLOCK_DECODER_FACTORY_H_
+
+#include "roc_core/noncopyable.h"
+#include "roc_core/byte_buffer.h"
+#include "roc_datagram/default_buffer_composer.h"
+#include "roc_fec/iblock_decoder_factory.h"
+#include "roc_fec/rs_block_decoder.h"
+
+#ifdef ROC_TARGET_OPENFEC
+#include "roc_fec/ldpc_block_decoder.h"
+#endif
+
+namespace roc {
+namespace fec {
+
+//! Block decoder factory.
+//! @remarks
+//!  Creates at most one block decoder per FEC scheme. Decoders are allocated
+//!  from heap pools on first request and destroyed with factory.
+//!  LDPC-Staircase is available only if built with OpenFEC.
+class BlockDecoderFactory : public IBlockDecoderFactory, public core::NonCopyable<> {
+public:
+    //! Initialize.
+    //! @remarks
+    //!  Block decoders use @p composer to allocate repaired buffers.
+    explicit BlockDecoderFactory(
+        core::IByteBufferComposer& composer = datagram::default_buffer_composer());
+
+    ~BlockDecoderFactory();
+
+    //! Get block decoder for given FEC scheme.
+    virtual IBlockDecoder* new_block_decoder(packet::FECScheme scheme);
+
+private:
+    core::IByteBufferComposer& composer_;
+
+    RS_BlockDecoder* rs_decoder_;
+#ifdef ROC_TARGET_OPENFEC
+    LDPC_BlockDecoder* ldpc_decoder_;
+#endif
+};
+
+} // namespace fec
+} // namespace roc
+
+#endif // ROC_FEC_BLOCK_DECODER_FACTORY_H_
@@ -23,15 +23,17 @@ namespace fec {
 Decoder::Decoder(IBlockDecoder& block_decoder,
                  packet::IPacketReader& data_reader,
                  packet::IPacketReader& fec_reader,
-                 packet::IPacketParser& parser)
-    : block_decoder_(block_decoder)
+                 packet::IPacketParser& parser,
+                 size_t n_data,
+                 size_t n_fec)
+    : block_decoder_(&block_decoder)
+    , block_decoder_factory_(NULL)
+    , scheme_mismatch_(false)
     , data_reader_(data_reader)
     , fec_reader_(fec_reader)
     , parser_(parser)
     , data_queue_(0)
     , fec_queue_(0)
-    , data_block_(N_DATA_PACKETS)
-    , fec_block_(N_FEC_PACKETS)
     , is_alive_(true)
     , is_started_(false)
     , can_repair_(false)
@@ -40,6 +42,42 @@ Decoder::Decoder(IBlockDecoder& block_decoder,
     , has_source_(false)
     , source_(0)
     , n_packets_(0) {
+    init_(n_data, n_fec);
+}
+
+Decoder::Decoder(IBlockDecoderFactory& block_decoder_factory,
+                 packet::IPacketReader& data_reader,
+                 packet::IPacketReader& fec_reader,
+                 packet::IPacketParser& parser,
+                 size_t n_data,
+                 size_t n_fec)
+    : block_decoder_(NULL)
+    , block_decoder_factory_(&block_decoder_factory)
+    , scheme_mismatch_(false)
+    , data_reader_(data_reader)
+    , fec_reader_(fec_reader)
+    , parser_(parser)
+    , data_queue_(0)
+    , fec_queue_(0)
+    , is_alive_(true)
+    , is_started_(false)
+    , can_repair_(false)
+    , next_packet_(0)
+    , cur_block_sn_(0)
+    , has_source_(false)
+    , source_(0)
+    , n_packets_(0) {
+    init_(n_data, n_fec);
+}
+
+void Decoder::init_(size_t n_data, size_t n_fec) {
+    if (n_data > data_block_.max_size() || n_fec > fec_block_.max_size()
+        || (block_decoder_ && !block_decoder_->resize(n_data, n_fec))) {
+        roc_panic("decoder: unsupported block geometry: n_data=%lu n_fec=%lu",
+                  (unsigned long)n_data, (unsigned long)n_fec);
+    }
+
+    resize_(n_data, n_fec);
 }
 
 bool Decoder::is_started() const {
@@ -96,6 +134,11 @@ packet::IPacketConstPtr Decoder::get_next_packet_() {
     packet::IPacketConstPtr pp = data_block_[next_packet_];
 
     do {
+        if (!is_started_) {
+            // Block geometry changed, wait for next block beginning.
+            return read_();
+        }
+
         if (!pp) {
             try_repair_();
 
@@ -141,35 +184,25 @@ void Decoder::next_block_() {
     cur_block_sn_ += data_block_.size();
     next_packet_ = 0;
 
+    if (block_decoder_) {
+        block_decoder_->reset();
+    }
     can_repair_ = false;
+
     update_packets_();
 }
 
 void Decoder::try_repair_() {
-    if (!can_repair_) {
+    if (!can_repair_ || !block_decoder_) {
         return;
     }
 
-    for (size_t n = 0; n < data_block_.size(); n++) {
-        if (!data_block_[n]) {
-            continue;
-        }
-        block_decoder_.write(n, data_block_[n]->raw_data());
-    }
-
-    for (size_t n = 0; n < fec_block_.size(); n++) {
-        if (!fec_block_[n]) {
-            continue;
-        }
-        block_decoder_.write(data_block_.size() + n, fec_block_[n]->payload());
-    }
-
     for (size_t n = 0; n < data_block_.size(); n++) {
         if (data_block_[n]) {
             continue;
         }
 
-        core::IByteBufferConstSlice buffer = block_decoder_.repair(n);
+        core::IByteBufferConstSlice buffer = block_decoder_->repair(n);
         if (!buffer) {
             continue;
         }
@@ -188,7 +221,6 @@ void Decoder::try_repair_() {
         data_block_[n] = pp;
     }
 
-    block_decoder_.reset();
     can_repair_ = false;
 }
 
@@ -215,6 +247,55 @@ bool Decoder::check_packet_(const packet::IPacketConstPtr& pp, size_t pos) {
     return true;
 }
 
+bool Decoder::update_geometry_(const packet::IFECPacket& fp) {
+    const size_t n_data = fp.data_blksz();
+    const size_t n_fec = fp.fec_blksz();
+
+    if (n_data == data_block_.size() && n_fec == fec_block_.size()) {
+        return true;
+    }
+
+    if (n_data == 0 || n_data > data_block_.max_size() || n_fec == 0
+        || n_fec > fec_block_.max_size()) {
+        return false;
+    }
+
+    if (block_decoder_ && !block_decoder_->resize(n_data, n_fec)) {
+        return false;
+    }
+
+    roc_log(LOG_DEBUG, "decoder: changing block geometry:"
+                       " n_data=%lu->%lu n_fec=%lu->%lu started=%d",
+            (unsigned long)data_block_.size(), (unsigned long)n_data,
+            (unsigned long)fec_block_.size(), (unsigned long)n_fec, (int)is_started_);
+
+    if (is_started_) {
+        // Return packets that were not read yet back to queue, they'll be
+        // read again when decoder is restarted.
+        for (size_t n = next_packet_; n < data_block_.size(); n++) {
+            if (data_block_[n]) {
+                data_queue_.write(data_block_[n]);
+            }
+        }
+        is_started_ = false;
+    }
+
+    resize_(n_data, n_fec);
+
+    return true;
+}
+
+void Decoder::resize_(size_t n_data, size_t n_fec) {
+    data_block_.resize(0);
+    data_block_.resize(n_data);
+
+    fec_block_.resize(0);
+    fec_block_.resize(n_fec);
+
+    next_packet_ = 0;
+    can_repair_ = false;
+}
+
 void Decoder::fetch_packets_() {
     while (data_queue_.size() <= data_block_.size() * 2) {
         if (packet::IPacketConstPtr pp = data_reader_.read()) {
@@ -229,6 +310,9 @@ void Decoder::fetch_packets_() {
             if (pp->type() != packet::IFECPacket::Type) {
                 roc_panic("decoder: fec reader returned packet of wrong type");
             }
+            if (!check_scheme_(*static_cast<const packet::IFECPacket*>(pp.get()))) {
+                continue;
+            }
             fec_queue_.write(pp);
         } else {
             break;
@@ -236,6 +320,55 @@ void Decoder::fetch_packets_() {
     }
 }
 
+bool Decoder::check_scheme_(const packet::IFECPacket& fp) {
+    if (!block_decoder_ && block_decoder_factory_) {
+        if (IBlockDecoder* block_decoder =
+                block_decoder_factory_->new_block_decoder(fp.scheme())) {
+            if (set_block_decoder_(*block_decoder)) {
+                return true;
+            }
+        }
+    }
+
+    if (block_decoder_ && fp.scheme() == block_decoder_->scheme()) {
+        return true;
+    }
+
+    if (!scheme_mismatch_) {
+        roc_log(LOG_ERROR, "decoder: dropping fec packets of unsupported scheme:"
+                           " got=%s expected=%s",
+                packet::fec_scheme_to_str(fp.scheme()),
+                block_decoder_ ? packet::fec_scheme_to_str(block_decoder_->scheme())
+                               : "none");
+        scheme_mismatch_ = true;
+    } else {
+        roc_log(LOG_TRACE, "decoder: dropping fec packet of unexpected scheme");
+    }
+
+    return false;
+}
+
+bool Decoder::set_block_decoder_(IBlockDecoder& block_decoder) {
+    if (!block_decoder.resize(data_block_.size(), fec_block_.size())) {
+        return false;
+    }
+
+    roc_log(LOG_DEBUG, "decoder: using fec scheme %s",
+            packet::fec_scheme_to_str(block_decoder.scheme()));
+
+    block_decoder_ = &block_decoder;
+
+    // No FEC packets were accepted yet, but data packets of current block
+    // should be passed to block decoder.
+    for (size_t n = 0; n < data_block_.size(); n++) {
+        if (data_block_[n]) {
+            block_decoder_->write(n, data_block_[n]->raw_data());
+        }
+    }
+
+    return true;
+}
+
 void Decoder::update_packets_() {
     update_data_packets_();
     update_fec_packets_();
@@ -270,6 +403,9 @@ void Decoder::update_data_packets_() {
         if (!data_block_[p_num]) {
             can_repair_ = true;
             data_block_[p_num] = pp;
+            if (block_decoder_) {
+                block_decoder_->write(p_num, pp->raw_data());
+            }
             n_added++;
         }
     }
@@ -295,6 +431,24 @@ void Decoder::update_fec_packets_() {
             break;
         }
 
+        if (!SEQ_IS_BEFORE(fp->data_blknum(), cur_block_sn_)
+            && (fp->data_blksz() != data_block_.size()
+                || fp->fec_blksz() != fec_block_.size())) {
+            if (update_geometry_(*fp)) {
+                // Decoding restarted, keep packet for next block.
+                break;
+            }
+
+            roc_log(LOG_TRACE, "decoder: dropping fec packet with bad block geometry:"
+                               " n_data=%lu n_fec=%lu",
+                    (unsigned long)fp->data_blksz(), (unsigned long)fp->fec_blksz());
+
+            fec_queue_.read();
+            n_fetched++;
+            n_dropped++;
+            continue;
+        }
+
         fec_queue_.read();
         n_fetched++;
 
@@ -314,11 +468,28 @@ void Decoder::update_fec_packets_() {
             continue;
         }
 
+        if (!fp->payload()) {
+            roc_log(LOG_TRACE, "decoder: dropping fec packet with empty payload:"
+                               " pkt_sn=%lu",
+                    (unsigned long)fp->seqnum());
+            n_dropped++;
+            continue;
+        }
+
         const size_t p_num = SEQ_SUBTRACT(fp->seqnum(), fp->fec_blknum());
 
+        if (p_num >= fec_block_.size()) {
+            roc_log(LOG_TRACE, "decoder: dropping invalid fec packet:"
+                               " pkt_sn=%lu pkt_fec_blk=%lu",
+                    (unsigned long)fp->seqnum(), (unsigned long)fp->fec_blknum());
+            n_dropped++;
+            continue;
+        }
+
         if (!fec_block_[p_num]) {
             can_repair_ = true;
             fec_block_[p_num] = fp;
+            block_decoder_->write(data_block_.size() + p_num, fp->payload());
             n_added++;
         }
     }
@@ -340,6 +511,16 @@ void Decoder::skip_fec_packets_() {
 
         packet::IFECPacketConstPtr fp = static_cast<const packet::IFECPacket*>(pp.get());
 
+        if (!update_geometry_(*fp)) {
+            roc_log(LOG_TRACE, "decoder: dropping fec packet with bad block geometry:"
+                               " n_data=%lu n_fec=%lu",
+                    (unsigned long)fp->data_blksz(), (unsigned long)fp->fec_blksz());
+
+            fec_queue_.read();
+            n_skipped++;
+            continue;
+        }
+
         if (!SEQ_IS_BEFORE(fp->data_blknum(), cur_block_sn_)) {
             break;
         }
@@ -26,6 +26,7 @@
 #include "roc_packet/packet_queue.h"
 
 #include "roc_fec/iblock_decoder.h"
+#include "roc_fec/iblock_decoder_factory.h"
 
 namespace roc {
 namespace fec {
@@ -33,6 +34,14 @@ namespace fec {
 //! FEC decoder.
 //! @remarks
 //!  Reads data and FEC packets from input queues and restores missing data packets.
+//!  Block geometry is taken from FEC packets. If it differs from the current one,
+//!  decoder switches to new geometry and restarts from next block beginning.
+//!  Block decoder is either given at construction or requested from factory
+//!  for the scheme of the first FEC packet. FEC packets encoded with other
+//!  scheme than block decoder's are dropped.
+//!  Packets are passed to block decoder as soon as they're added to current
+//!  block, so that codecs supporting iterative decoding can do most of the
+//!  work before a missing packet is actually requested.
 class Decoder : public packet::IPacketReader, public core::NonCopyable<> {
 public:
     //! Initialize.
@@ -41,11 +50,28 @@ public:
     //!  - @p block_decoder specifies FEC codec implementation;
     //!  - @p data_reader specifies input queue with data packets;
     //!  - @p fec_reader specifies input queue with FEC packets;
-    //!  - @p parser specifies packet parser for restored packets.
+    //!  - @p parser specifies packet parser for restored packets;
+    //!  - @p n_data and @p n_fec specify expected block geometry, used until
+    //!    first FEC packet is received.
     Decoder(IBlockDecoder& block_decoder,
             packet::IPacketReader& data_reader,
             packet::IPacketReader& fec_reader,
-            packet::IPacketParser& parser);
+            packet::IPacketParser& parser,
+            size_t n_data = ROC_CONFIG_DEFAULT_FEC_BLOCK_DATA_PACKETS,
+            size_t n_fec = ROC_CONFIG_DEFAULT_FEC_BLOCK_REDUNDANT_PACKETS);
+
+    //! Initialize with block decoder chosen by FEC scheme.
+    //!
+    //! @b Parameters
+    //!  - @p block_decoder_factory provides block decoder for the scheme of
+    //!    the first FEC packet; until then, lost packets can't be restored;
+    //!  - other parameters are the same as above.
+    Decoder(IBlockDecoderFactory& block_decoder_factory,
+            packet::IPacketReader& data_reader,
+            packet::IPacketReader& fec_reader,
+            packet::IPacketParser& parser,
+            size_t n_data = ROC_CONFIG_DEFAULT_FEC_BLOCK_DATA_PACKETS,
+            size_t n_fec = ROC_CONFIG_DEFAULT_FEC_BLOCK_REDUNDANT_PACKETS);
 
     //! Get packet.
     //! @returns next available packet.
@@ -61,8 +87,10 @@ public:
     bool is_alive() const;
 
 private:
-    static const size_t N_DATA_PACKETS = ROC_CONFIG_DEFAULT_FEC_BLOCK_DATA_PACKETS;
-    static const size_t N_FEC_PACKETS = ROC_CONFIG_DEFAULT_FEC_BLOCK_REDUNDANT_PACKETS;
+    static const size_t MAX_DATA_PACKETS = ROC_CONFIG_MAX_FEC_BLOCK_DATA_PACKETS;
+    static const size_t MAX_FEC_PACKETS = ROC_CONFIG_MAX_FEC_BLOCK_REDUNDANT_PACKETS;
+
+    void init_(size_t n_data, size_t n_fec);
 
     packet::IPacketConstPtr read_();
     packet::IPacketConstPtr get_next_packet_();
@@ -71,6 +99,16 @@ private:
     void try_repair_();
     bool check_packet_(const packet::IPacketConstPtr&, size_t pos);
 
+    // Checks that FEC packet scheme matches block decoder. Requests block decoder
+    // from factory if there is no one yet.
+    bool check_scheme_(const packet::IFECPacket&);
+    bool set_block_decoder_(IBlockDecoder&);
+
+    // Switches to block geometry of given packet if it differs from current one.
+    // Returns false if packet's geometry is invalid or unsupported.
+    bool update_geometry_(const packet::IFECPacket&);
+    void resize_(size_t n_data, size_t n_fec);
+
     void fetch_packets_();
     void update_packets_();
 
@@ -81,7 +119,10 @@ private:
     // or later.
     void skip_fec_packets_();
 
-    IBlockDecoder& block_decoder_;
+    IBlockDecoder* block_decoder_;
+    IBlockDecoderFactory* block_decoder_factory_;
+
+    bool scheme_mismatch_;
 
     packet::IPacketReader& data_reader_;
     packet::IPacketReader& fec_reader_;
@@ -90,8 +131,8 @@ private:
     packet::PacketQueue data_queue_;
     packet::PacketQueue fec_queue_;
 
-    core::Array<packet::IPacketConstPtr, N_DATA_PACKETS> data_block_;
-    core::Array<packet::IFECPacketConstPtr, N_FEC_PACKETS> fec_block_;
+    core::Array<packet::IPacketConstPtr, MAX_DATA_PACKETS> data_block_;
+    core::Array<packet::IFECPacketConstPtr, MAX_FEC_PACKETS> fec_block_;
 
     bool is_alive_;
     bool is_started_;
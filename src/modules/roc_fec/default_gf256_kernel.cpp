@@ -0,0 +1,35 @@
+/*
+ * Copyright (c) 2015 Mikhail Baranov
+ * Copyright (c) 2015 Victor Gaydov
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "roc_core/singleton.h"
+
+#include "roc_fec/default_gf256_kernel.h"
+#include "roc_fec/generic_gf256_kernel.h"
+
+#ifdef ROC_TARGET_SSE
+#include "roc_fec/sse_gf256_kernel.h"
+#endif
+
+namespace roc {
+namespace fec {
+
+IGF256Kernel& default_gf256_kernel() {
+#if defined(ROC_TARGET_SSE)
+    if (AVX2GF256Kernel::supported()) {
+        return core::Singleton<AVX2GF256Kernel>::instance();
+    }
+    if (SSSE3GF256Kernel::supported()) {
+        return core::Singleton<SSSE3GF256Kernel>::instance();
+    }
+#endif
+    return core::Singleton<GenericGF256Kernel>::instance();
+}
+
+} // namespace fec
+} // namespace roc
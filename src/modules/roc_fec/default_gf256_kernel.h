@@ -0,0 +1,30 @@
+/*
+ * Copyright (c) 2015 Mikhail Baranov
+ * Copyright (c) 2015 Victor Gaydov
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+//! @file roc_fec/default_gf256_kernel.h
+//! @brief Default GF(2^8) kernel.
+
+#ifndef ROC_FEC_DEFAULT_GF256_KERNEL_H_
+#define ROC_FEC_DEFAULT_GF256_KERNEL_H_
+
+#include "roc_fec/igf256_kernel.h"
+
+namespace roc {
+namespace fec {
+
+//! Get fastest GF(2^8) kernel supported by current CPU.
+//! @remarks
+//!  Vectorized kernels are used when they are enabled at build time and
+//!  supported by CPU we're running on; otherwise, generic kernel is used.
+IGF256Kernel& default_gf256_kernel();
+
+} // namespace fec
+} // namespace roc
+
+#endif // ROC_FEC_DEFAULT_GF256_KERNEL_H_
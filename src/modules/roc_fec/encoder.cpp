@@ -48,49 +48,82 @@ void Encoder::write(const packet::IPacketPtr& p) {
 
     block_encoder_.write(cur_data_pack_i_, p->raw_data());
 
-    if (++cur_data_pack_i_ >= N_DATA_PACKETS) {
-        // Calculate redundant packet of this block.
-        block_encoder_.commit();
-
-        // Send redundant packets.
-        for (packet::seqnum_t i = 0; i < N_FEC_PACKETS; ++i) {
-            packet::IFECPacketPtr fec_p = make_fec_packet_(
-                block_encoder_.read(i), cur_block_seqnum_, cur_session_fec_seqnum_,
-                cur_session_fec_seqnum_ + i, i == 0);
-
-            if (fec_p) {
-                packet_output_.write(fec_p);
-            } else {
-                roc_log(LOG_TRACE, "fec encoder: can't create fec packet");
-            }
-        }
-        cur_session_fec_seqnum_ += N_FEC_PACKETS;
+    if (++cur_data_pack_i_ >= block_encoder_.n_data_packets()) {
+        send_fec_packets_(p->raw_data().size());
+
         cur_data_pack_i_ = 0;
 
         block_encoder_.reset();
     }
 }
 
-packet::IFECPacketPtr Encoder::make_fec_packet_(const core::IByteBufferConstSlice& buff,
-                                                const packet::seqnum_t block_data_seqnum,
+void Encoder::send_fec_packets_(size_t symb_sz) {
+    const size_t n_fec = block_encoder_.n_fec_packets();
+
+    fec_packets_.resize(n_fec);
+
+    // Compose FEC packets in advance and let block encoder write FEC symbols
+    // right into their payloads.
+    for (size_t i = 0; i < n_fec; ++i) {
+        fec_packets_[i] =
+            make_fec_packet_(cur_block_seqnum_, cur_session_fec_seqnum_,
+                             packet::seqnum_t(cur_session_fec_seqnum_ + i), i == 0);
+
+        if (fec_packets_[i]) {
+            block_encoder_.set_fec_buffer(i, fec_packets_[i]->alloc_payload(symb_sz));
+        }
+    }
+
+    // Calculate redundant packets of this block.
+    block_encoder_.commit();
+
+    for (size_t i = 0; i < n_fec; ++i) {
+        packet::IFECPacketPtr fec_p = fec_packets_[i];
+        fec_packets_[i] = NULL;
+
+        if (!fec_p) {
+            roc_log(LOG_TRACE, "fec encoder: can't create fec packet");
+            continue;
+        }
+
+        core::IByteBufferConstSlice buff = block_encoder_.read(i);
+        if (!buff) {
+            roc_log(LOG_TRACE, "fec encoder: can't encode fec packet");
+            continue;
+        }
+
+        // Block encoder may ignore provided buffer, e.g. if its size doesn't
+        // match encoding symbol size.
+        if (buff.data() != fec_p->payload().data()) {
+            fec_p->set_payload(buff.data(), buff.size());
+        }
+
+        packet_output_.write(fec_p);
+    }
+
+    cur_session_fec_seqnum_ += (packet::seqnum_t)n_fec;
+}
+
+packet::IFECPacketPtr Encoder::make_fec_packet_(const packet::seqnum_t block_data_seqnum,
                                                 const packet::seqnum_t block_fec_seqnum,
                                                 const packet::seqnum_t seqnum,
                                                 const bool marker_bit) {
-    if (!buff) {
+    packet::IPacketPtr p = packet_composer_.compose(packet::IFECPacket::Type);
+    if (!p) {
         return NULL;
     }
 
-    packet::IPacketPtr p = packet_composer_.compose(packet::IFECPacket::Type);
-
     roc_panic_if(p->type() != packet::IFECPacket::Type);
 
     if (packet::IFECPacketPtr fec_p = static_cast<packet::IFECPacket*>(p.get())) {
         fec_p->set_source(source_);
         fec_p->set_seqnum(seqnum);
         fec_p->set_marker(marker_bit);
+        fec_p->set_scheme(block_encoder_.scheme());
         fec_p->set_data_blknum(block_data_seqnum);
         fec_p->set_fec_blknum(block_fec_seqnum);
-        fec_p->set_payload(buff.data(), buff.size());
+        fec_p->set_data_blksz(block_encoder_.n_data_packets());
+        fec_p->set_fec_blksz(block_encoder_.n_fec_packets());
         return fec_p;
     } else {
         return NULL;
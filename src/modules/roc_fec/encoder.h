@@ -32,7 +32,9 @@ namespace fec {
 //! FEC encoder.
 //! @remarks
 //!  Writes data packets to output queue, generates additional FEC packets and
-//!  writes them to output queue too.
+//!  writes them to output queue too. Block geometry is taken from block encoder
+//!  and is stored in every FEC packet. FEC packets are composed before encoding
+//!  block, so that block encoder can write FEC symbols directly into packets.
 class Encoder : public packet::IPacketWriter, public core::NonCopyable<> {
 public:
     //! Initialize.
@@ -52,12 +54,13 @@ public:
     virtual void write(const packet::IPacketPtr&);
 
 private:
-    static const size_t N_DATA_PACKETS = ROC_CONFIG_DEFAULT_FEC_BLOCK_DATA_PACKETS;
-    static const size_t N_FEC_PACKETS = ROC_CONFIG_DEFAULT_FEC_BLOCK_REDUNDANT_PACKETS;
+    static const size_t MAX_FEC_PACKETS = ROC_CONFIG_MAX_FEC_BLOCK_REDUNDANT_PACKETS;
 
-    //! Create FEC-packet.
-    packet::IFECPacketPtr make_fec_packet_(const core::IByteBufferConstSlice& buff,
-                                           const packet::seqnum_t block_data_seqnum,
+    //! Encode current block and send FEC packets.
+    void send_fec_packets_(size_t symb_sz);
+
+    //! Create FEC-packet without payload.
+    packet::IFECPacketPtr make_fec_packet_(const packet::seqnum_t block_data_seqnum,
                                            const packet::seqnum_t block_fec_seqnum,
                                            const packet::seqnum_t seqnum,
                                            const bool marker_bit);
@@ -74,6 +77,8 @@ private:
     packet::seqnum_t cur_session_fec_seqnum_;
 
     size_t cur_data_pack_i_;
+
+    core::Array<packet::IFECPacketPtr, MAX_FEC_PACKETS> fec_packets_;
 };
 
 } // namespace fec
@@ -0,0 +1,48 @@
+/*
+ * Copyright (c) 2015 Mikhail Baranov
+ * Copyright (c) 2015 Victor Gaydov
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "roc_core/singleton.h"
+#include "roc_fec/generic_gf256_kernel.h"
+
+namespace roc {
+namespace fec {
+
+GenericGF256Kernel::GenericGF256Kernel()
+    : gf_(core::Singleton<GF256>::instance()) {
+}
+
+const char* GenericGF256Kernel::name() const {
+    return "generic";
+}
+
+void GenericGF256Kernel::mul_add(uint8_t* dst,
+                                 const uint8_t* src,
+                                 uint8_t c,
+                                 size_t n) const {
+    if (c == 0) {
+        return;
+    }
+
+    if (c == 1) {
+        for (size_t k = 0; k < n; ++k) {
+            dst[k] ^= src[k];
+        }
+        return;
+    }
+
+    uint8_t lo[16], hi[16];
+    gf_.nibble_tables(c, lo, hi);
+
+    for (size_t k = 0; k < n; ++k) {
+        dst[k] ^= lo[src[k] & 0xf] ^ hi[src[k] >> 4];
+    }
+}
+
+} // namespace fec
+} // namespace roc
@@ -0,0 +1,44 @@
+/*
+ * Copyright (c) 2015 Mikhail Baranov
+ * Copyright (c) 2015 Victor Gaydov
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+//! @file roc_fec/generic_gf256_kernel.h
+//! @brief Generic GF(2^8) kernel.
+
+#ifndef ROC_FEC_GENERIC_GF256_KERNEL_H_
+#define ROC_FEC_GENERIC_GF256_KERNEL_H_
+
+#include "roc_core/noncopyable.h"
+#include "roc_fec/igf256_kernel.h"
+#include "roc_fec/gf256.h"
+
+namespace roc {
+namespace fec {
+
+//! Generic GF(2^8) kernel.
+//! @remarks
+//!  Plain scalar implementation available on every platform. Uses two
+//!  16-entry lookups per byte.
+class GenericGF256Kernel : public IGF256Kernel, public core::NonCopyable<> {
+public:
+    GenericGF256Kernel();
+
+    //! Get kernel name.
+    virtual const char* name() const;
+
+    //! Compute dst[k] ^= c * src[k] for k in [0; n).
+    virtual void mul_add(uint8_t* dst, const uint8_t* src, uint8_t c, size_t n) const;
+
+private:
+    const GF256& gf_;
+};
+
+} // namespace fec
+} // namespace roc
+
+#endif // ROC_FEC_GENERIC_GF256_KERNEL_H_
@@ -0,0 +1,51 @@
+/*
+ * Copyright (c) 2015 Mikhail Baranov
+ * Copyright (c) 2015 Victor Gaydov
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "roc_fec/gf256.h"
+
+namespace roc {
+namespace fec {
+
+namespace {
+
+const unsigned Polynomial = 0x11d;
+
+} // namespace
+
+GF256::GF256() {
+    unsigned x = 1;
+
+    for (unsigned i = 0; i < 255; ++i) {
+        exp_[i] = (uint8_t)x;
+        exp_[i + 255] = (uint8_t)x;
+        log_[x] = (uint8_t)i;
+
+        x <<= 1;
+        if (x & 0x100) {
+            x ^= Polynomial;
+        }
+    }
+
+    // Makes exp_[log_[a] + log_[b]] valid for any a, b and exp_[255 - log_[a]]
+    // valid for any non-zero a.
+    exp_[510] = exp_[0];
+    exp_[511] = exp_[1];
+
+    log_[0] = 0;
+}
+
+void GF256::nibble_tables(uint8_t c, uint8_t lo[16], uint8_t hi[16]) const {
+    for (unsigned x = 0; x < 16; ++x) {
+        lo[x] = mul(c, (uint8_t)x);
+        hi[x] = mul(c, (uint8_t)(x << 4));
+    }
+}
+
+} // namespace fec
+} // namespace roc
@@ -0,0 +1,70 @@
+/*
+ * Copyright (c) 2015 Mikhail Baranov
+ * Copyright (c) 2015 Victor Gaydov
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+//! @file roc_fec/gf256.h
+//! @brief GF(2^8) arithmetic.
+
+#ifndef ROC_FEC_GF256_H_
+#define ROC_FEC_GF256_H_
+
+#include "roc_core/stddefs.h"
+#include "roc_core/noncopyable.h"
+#include "roc_core/panic.h"
+
+namespace roc {
+namespace fec {
+
+//! GF(2^8) arithmetic.
+//! @remarks
+//!  Field is generated by x^8 + x^4 + x^3 + x^2 + 1 polynomial (0x11d).
+//!  Addition is XOR; multiplication and division use exp/log tables.
+//!  Tables are built once in constructor, so instance is usually obtained
+//!  via core::Singleton.
+class GF256 : public core::NonCopyable<> {
+public:
+    GF256();
+
+    //! Multiply two elements.
+    uint8_t mul(uint8_t a, uint8_t b) const {
+        if (a == 0 || b == 0) {
+            return 0;
+        }
+        return exp_[log_[a] + log_[b]];
+    }
+
+    //! Divide @p a by non-zero @p b.
+    uint8_t div(uint8_t a, uint8_t b) const {
+        roc_panic_if(b == 0);
+        if (a == 0) {
+            return 0;
+        }
+        return exp_[log_[a] + 255 - log_[b]];
+    }
+
+    //! Get multiplicative inverse of non-zero element.
+    uint8_t inv(uint8_t a) const {
+        roc_panic_if(a == 0);
+        return exp_[255 - log_[a]];
+    }
+
+    //! Build split multiplication tables for @p c.
+    //! @remarks
+    //!  Fills @p lo[x] = c * x and @p hi[x] = c * (x << 4) for x in [0; 16),
+    //!  so that c * s = lo[s & 0xf] ^ hi[s >> 4] for any element s.
+    void nibble_tables(uint8_t c, uint8_t lo[16], uint8_t hi[16]) const;
+
+private:
+    uint8_t exp_[512];
+    uint8_t log_[256];
+};
+
+} // namespace fec
+} // namespace roc
+
+#endif // ROC_FEC_GF256_H_
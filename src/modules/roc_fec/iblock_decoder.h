@@ -15,6 +15,7 @@
 
 #include "roc_core/stddefs.h"
 #include "roc_core/byte_buffer.h"
+#include "roc_packet/ifec_packet.h"
 
 namespace roc {
 namespace fec {
@@ -25,6 +26,9 @@ public:
     virtual ~IBlockDecoder();
 
     //! Store encoded buffer to current block at given position.
+    //! @remarks
+    //!  Buffers may be written as they arrive, interleaved with repair()
+    //!  calls. If buffer at given position was already repaired, it's ignored.
     virtual void write(size_t index, const core::IByteBufferConstSlice& buffer) = 0;
 
     //! Repair data buffer at given position of current block.
@@ -32,6 +36,17 @@ public:
 
     //! Reset state and start next block.
     virtual void reset() = 0;
+
+    //! Change block geometry.
+    //! @remarks
+    //!  Resets current block and sets number of data and FEC buffers for
+    //!  following blocks.
+    //! @returns
+    //!  false if given geometry is not supported.
+    virtual bool resize(size_t n_data, size_t n_fec) = 0;
+
+    //! Get FEC scheme implemented by decoder.
+    virtual packet::FECScheme scheme() const = 0;
 };
 
 } // namespace fec
@@ -0,0 +1,37 @@
+/*
+ * Copyright (c) 2015 Mikhail Baranov
+ * Copyright (c) 2015 Victor Gaydov
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+//! @file roc_fec/iblock_decoder_factory.h
+//! @brief FEC block decoder factory interface.
+
+#ifndef ROC_FEC_IBLOCK_DECODER_FACTORY_H_
+#define ROC_FEC_IBLOCK_DECODER_FACTORY_H_
+
+#include "roc_packet/ifec_packet.h"
+#include "roc_fec/iblock_decoder.h"
+
+namespace roc {
+namespace fec {
+
+//! FEC block decoder factory interface.
+class IBlockDecoderFactory {
+public:
+    virtual ~IBlockDecoderFactory();
+
+    //! Get block decoder for given FEC scheme.
+    //! @returns
+    //!  block decoder owned by factory or NULL if scheme isn't supported
+    //!  or decoder can't be allocated.
+    virtual IBlockDecoder* new_block_decoder(packet::FECScheme scheme) = 0;
+};
+
+} // namespace fec
+} // namespace roc
+
+#endif // ROC_FEC_IBLOCK_DECODER_FACTORY_H_
@@ -15,6 +15,7 @@
 
 #include "roc_core/stddefs.h"
 #include "roc_core/byte_buffer.h"
+#include "roc_packet/ifec_packet.h"
 
 namespace roc {
 namespace fec {
@@ -27,6 +28,14 @@ public:
     //! Store data buffer to current block at given position.
     virtual void write(size_t index, const core::IByteBufferConstSlice& buffer) = 0;
 
+    //! Provide buffer for FEC symbol at given position.
+    //! @remarks
+    //!  Should be called before commit(). If @p buffer has suitable size,
+    //!  encoder computes FEC symbol directly into it instead of allocating
+    //!  new buffer; otherwise @p buffer is ignored. In both cases, read()
+    //!  returns actual FEC buffer. Provided buffers are forgotten on reset().
+    virtual void set_fec_buffer(size_t index, const core::IByteBufferSlice& buffer) = 0;
+
     //! Finish writing data buffers for current block.
     //! @remarks
     //!  Calculates FEC buffers from previously added data buffers. After this
@@ -38,6 +47,15 @@ public:
 
     //! Reset state and start next block.
     virtual void reset() = 0;
+
+    //! Get number of data buffers in block.
+    virtual size_t n_data_packets() const = 0;
+
+    //! Get number of FEC buffers in block.
+    virtual size_t n_fec_packets() const = 0;
+
+    //! Get FEC scheme implemented by encoder.
+    virtual packet::FECScheme scheme() const = 0;
 };
 
 } // namespace fec
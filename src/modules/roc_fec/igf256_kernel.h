@@ -0,0 +1,42 @@
+/*
+ * Copyright (c) 2015 Mikhail Baranov
+ * Copyright (c) 2015 Victor Gaydov
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+//! @file roc_fec/igf256_kernel.h
+//! @brief GF(2^8) kernel interface.
+
+#ifndef ROC_FEC_IGF256_KERNEL_H_
+#define ROC_FEC_IGF256_KERNEL_H_
+
+#include "roc_core/stddefs.h"
+
+namespace roc {
+namespace fec {
+
+//! GF(2^8) kernel interface.
+//! @remarks
+//!  Performs multiply-accumulate of a run of bytes by a constant, which
+//!  is the inner loop of Reed-Solomon encoding and decoding:
+//!  @code
+//!   dst[k] ^= c * src[k]
+//!  @endcode
+class IGF256Kernel {
+public:
+    virtual ~IGF256Kernel();
+
+    //! Get kernel name.
+    virtual const char* name() const = 0;
+
+    //! Compute dst[k] ^= c * src[k] for k in [0; n).
+    virtual void mul_add(uint8_t* dst, const uint8_t* src, uint8_t c, size_t n) const = 0;
+};
+
+} // namespace fec
+} // namespace roc
+
+#endif // ROC_FEC_IGF256_KERNEL_H_
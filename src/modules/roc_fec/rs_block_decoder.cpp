@@ -0,0 +1,308 @@
+/*
+ * Copyright (c) 2015 Mikhail Baranov
+ * Copyright (c) 2015 Victor Gaydov
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <string.h>
+
+#include "roc_core/panic.h"
+#include "roc_core/log.h"
+#include "roc_core/singleton.h"
+#include "roc_core/heap_pool.h"
+#include "roc_fec/rs_block_decoder.h"
+#include "roc_fec/rs_matrix.h"
+#include "roc_fec/default_gf256_kernel.h"
+
+namespace roc {
+namespace fec {
+
+RS_BlockDecoder::RS_BlockDecoder(core::IByteBufferComposer& composer,
+                                 const IGF256Kernel* kernel)
+    : n_data_(0)
+    , n_fec_(0)
+    , symb_sz_(0)
+    , gf_(core::Singleton<GF256>::instance())
+    , kernel_(kernel ? *kernel : default_gf256_kernel())
+    , composer_(composer)
+    , decoding_attempted_(false) {
+    roc_log(LOG_TRACE, "initializing rs decoder: kernel=%s", kernel_.name());
+
+    // non-virtual call from ctor
+    RS_BlockDecoder::resize(ROC_CONFIG_DEFAULT_FEC_BLOCK_DATA_PACKETS,
+                            ROC_CONFIG_DEFAULT_FEC_BLOCK_REDUNDANT_PACKETS);
+}
+
+void RS_BlockDecoder::write(size_t index, const core::IByteBufferConstSlice& buffer) {
+    if (index >= n_data_ + n_fec_) {
+        roc_panic("rs decoder: index out of bounds: index=%lu, size=%lu",
+                  (unsigned long)index, (unsigned long)(n_data_ + n_fec_));
+    }
+
+    if (!buffer) {
+        roc_panic("rs decoder: NULL buffer");
+    }
+
+    if (received_[index]) {
+        roc_panic("rs decoder: can't overwrite buffer: index=%lu", (unsigned long)index);
+    }
+
+    if (buffers_[index]) {
+        // Buffer was already restored by decoder.
+        return;
+    }
+
+    if (symb_sz_ == 0) {
+        symb_sz_ = buffer.size();
+    }
+
+    if (buffer.size() != symb_sz_) {
+        roc_log(LOG_DEBUG, "rs decoder: dropping buffer of unexpected size:"
+                           " size=%lu, expected=%lu",
+                (unsigned long)buffer.size(), (unsigned long)symb_sz_);
+        return;
+    }
+
+    decoding_attempted_ = false;
+
+    buffers_[index] = buffer;
+    received_[index] = true;
+}
+
+core::IByteBufferConstSlice RS_BlockDecoder::repair(size_t index) {
+    if (index >= n_data_) {
+        roc_panic("rs decoder: index out of bounds: index=%lu, n_data=%lu",
+                  (unsigned long)index, (unsigned long)n_data_);
+    }
+
+    if (!buffers_[index] && !decoding_attempted_) {
+        decoding_attempted_ = true;
+        decode_();
+    }
+
+    return buffers_[index];
+}
+
+void RS_BlockDecoder::reset() {
+    report_();
+
+    symb_sz_ = 0;
+    decoding_attempted_ = false;
+
+    for (size_t i = 0; i < buffers_.size(); ++i) {
+        buffers_[i] = core::IByteBufferConstSlice();
+        received_[i] = false;
+    }
+}
+
+bool RS_BlockDecoder::resize(size_t n_data, size_t n_fec) {
+    if (n_data == 0 || n_data > MAX_DATA_PACKETS) {
+        roc_log(LOG_ERROR, "rs decoder: unsupported number of data packets:"
+                           " n_data=%lu max=%lu",
+                (unsigned long)n_data, (unsigned long)MAX_DATA_PACKETS);
+        return false;
+    }
+
+    if (n_fec == 0 || n_fec > MAX_FEC_PACKETS) {
+        roc_log(LOG_ERROR, "rs decoder: unsupported number of fec packets:"
+                           " n_fec=%lu max=%lu",
+                (unsigned long)n_fec, (unsigned long)MAX_FEC_PACKETS);
+        return false;
+    }
+
+    reset();
+
+    n_data_ = n_data;
+    n_fec_ = n_fec;
+
+    buffers_.resize(n_data_ + n_fec_);
+    received_.resize(n_data_ + n_fec_);
+
+    return true;
+}
+
+packet::FECScheme RS_BlockDecoder::scheme() const {
+    return packet::FEC_ReedSolomon8;
+}
+
+void RS_BlockDecoder::decode_() {
+    core::IPool<Scratch>& pool = core::HeapPool<Scratch>::instance();
+
+    Scratch* scratch = new (pool) Scratch;
+    if (!scratch) {
+        roc_log(LOG_TRACE, "rs decoder: can't allocate scratch space");
+        return;
+    }
+
+    decode_(*scratch);
+
+    pool.destroy(*scratch);
+}
+
+void RS_BlockDecoder::decode_(Scratch& s) {
+    bool is_lost[MAX_DATA_PACKETS];
+
+    size_t n_lost = 0;
+    for (size_t j = 0; j < n_data_; ++j) {
+        is_lost[j] = !buffers_[j];
+        if (is_lost[j]) {
+            s.lost[n_lost++] = j;
+        }
+    }
+
+    size_t n_rows = 0;
+    for (size_t i = 0; i < n_fec_ && n_rows < n_lost; ++i) {
+        if (buffers_[n_data_ + i]) {
+            s.rows[n_rows++] = i;
+        }
+    }
+
+    if (n_lost == 0 || n_rows < n_lost) {
+        return;
+    }
+
+    for (size_t r = 0; r < n_lost; ++r) {
+        for (size_t c = 0; c < n_lost; ++c) {
+            s.matrix[r][c] = rs_coefficient(gf_, n_fec_, s.rows[r], s.lost[c]);
+        }
+    }
+
+    if (!invert_(s, n_lost)) {
+        roc_log(LOG_ERROR, "rs decoder: can't invert matrix");
+        return;
+    }
+
+    // Every received FEC buffer is a sum of C[i][j] * data[j] for all j. After
+    // moving received data buffers to the left side, lost buffers are:
+    //
+    //  lost[m] = sum(inv[m][r] * fec[r]) + sum(coeff[m][j] * data[j]),
+    //  coeff[m][j] = sum(inv[m][r] * C[r][j])
+    //
+    // where r iterates over used FEC buffers and j over received data buffers.
+    for (size_t m = 0; m < n_lost; ++m) {
+        core::IByteBufferPtr buffer = composer_.compose();
+        if (!buffer) {
+            roc_log(LOG_TRACE, "rs decoder: can't allocate buffer");
+            return;
+        }
+
+        buffer->set_size(symb_sz_);
+
+        uint8_t* data = buffer->data();
+        memset(data, 0, symb_sz_);
+
+        for (size_t r = 0; r < n_lost; ++r) {
+            kernel_.mul_add(data, buffers_[n_data_ + s.rows[r]].data(), s.inverse[m][r],
+                            symb_sz_);
+        }
+
+        for (size_t j = 0; j < n_data_; ++j) {
+            if (is_lost[j]) {
+                continue;
+            }
+
+            uint8_t coeff = 0;
+            for (size_t r = 0; r < n_lost; ++r) {
+                coeff ^=
+                    gf_.mul(s.inverse[m][r], rs_coefficient(gf_, n_fec_, s.rows[r], j));
+            }
+
+            kernel_.mul_add(data, buffers_[j].data(), coeff, symb_sz_);
+        }
+
+        buffers_[s.lost[m]] = *buffer;
+    }
+}
+
+bool RS_BlockDecoder::invert_(Scratch& s, size_t n) {
+    for (size_t r = 0; r < n; ++r) {
+        memset(s.inverse[r], 0, n);
+        s.inverse[r][r] = 1;
+    }
+
+    // Gauss-Jordan elimination; row operations are done by the kernel.
+    for (size_t c = 0; c < n; ++c) {
+        size_t pivot = c;
+        while (pivot < n && s.matrix[pivot][c] == 0) {
+            pivot++;
+        }
+
+        if (pivot == n) {
+            return false;
+        }
+
+        if (pivot != c) {
+            for (size_t k = 0; k < n; ++k) {
+                uint8_t tmp = s.matrix[c][k];
+                s.matrix[c][k] = s.matrix[pivot][k];
+                s.matrix[pivot][k] = tmp;
+
+                tmp = s.inverse[c][k];
+                s.inverse[c][k] = s.inverse[pivot][k];
+                s.inverse[pivot][k] = tmp;
+            }
+        }
+
+        const uint8_t scale = gf_.inv(s.matrix[c][c]);
+        for (size_t k = 0; k < n; ++k) {
+            s.matrix[c][k] = gf_.mul(s.matrix[c][k], scale);
+            s.inverse[c][k] = gf_.mul(s.inverse[c][k], scale);
+        }
+
+        for (size_t r = 0; r < n; ++r) {
+            const uint8_t factor = s.matrix[r][c];
+            if (r == c || factor == 0) {
+                continue;
+            }
+            kernel_.mul_add(s.matrix[r], s.matrix[c], factor, n);
+            kernel_.mul_add(s.inverse[r], s.inverse[c], factor, n);
+        }
+    }
+
+    return true;
+}
+
+void RS_BlockDecoder::report_() {
+    size_t n_lost = 0, n_repaired = 0;
+
+    char status1[MAX_DATA_PACKETS + 1] = {};
+    char status2[MAX_FEC_PACKETS + 1] = {};
+
+    for (size_t i = 0; i < buffers_.size(); ++i) {
+        char* status = (i < n_data_ ? &status1[i] : &status2[i - n_data_]);
+
+        if (buffers_[i]) {
+            if (received_[i]) {
+                *status = '.';
+            } else {
+                *status = 'r';
+                n_repaired++;
+                n_lost++;
+            }
+        } else {
+            if (i < n_data_) {
+                *status = 'X';
+            } else {
+                *status = 'x';
+            }
+            n_lost++;
+        }
+    }
+
+    if (n_lost == 0) {
+        return;
+    }
+
+    roc_log(LOG_TRACE, "rs decoder: repaired %u/%u/%u %s %s",
+            (unsigned)n_repaired,      //
+            (unsigned)n_lost,          //
+            (unsigned)buffers_.size(), //
+            status1,                   //
+            status2);
+}
+
+} // namespace fec
+} // namespace roc
@@ -0,0 +1,100 @@
+/*
+ * Copyright (c) 2015 Mikhail Baranov
+ * Copyright (c) 2015 Victor Gaydov
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+//! @file roc_fec/rs_block_decoder.h
+//! @brief Reed-Solomon implementation of IBlockDecoder.
+
+#ifndef ROC_FEC_RS_BLOCK_DECODER_H_
+#define ROC_FEC_RS_BLOCK_DECODER_H_
+
+#include "roc_config/config.h"
+#include "roc_core/noncopyable.h"
+#include "roc_core/byte_buffer.h"
+#include "roc_core/array.h"
+#include "roc_datagram/default_buffer_composer.h"
+#include "roc_fec/iblock_decoder.h"
+#include "roc_fec/igf256_kernel.h"
+#include "roc_fec/gf256.h"
+
+namespace roc {
+namespace fec {
+
+//! Reed-Solomon implementation of IBlockDecoder.
+//! @remarks
+//!  Decodes blocks produced by RS_BlockEncoder. If e data buffers are lost
+//!  and at least e FEC buffers are received, inverts e x e submatrix of
+//!  generator matrix and computes every lost buffer as a linear combination
+//!  of received buffers, without intermediate copies. Matrices are allocated
+//!  from a heap pool only while block is repaired, so idle decoder is small.
+class RS_BlockDecoder : public IBlockDecoder, public core::NonCopyable<> {
+public:
+    //! Construct.
+    //! @remarks
+    //!  Uses default block geometry until resize() is called. If @p kernel
+    //!  is NULL, default_gf256_kernel() is used.
+    explicit RS_BlockDecoder(
+        core::IByteBufferComposer& composer = datagram::default_buffer_composer(),
+        const IGF256Kernel* kernel = NULL);
+
+    //! Store encoded buffer to current block at given position.
+    virtual void write(size_t index, const core::IByteBufferConstSlice& buffer);
+
+    //! Repair data buffer at given position of current block.
+    virtual core::IByteBufferConstSlice repair(size_t index);
+
+    //! Reset state and start next block.
+    virtual void reset();
+
+    //! Change block geometry.
+    virtual bool resize(size_t n_data, size_t n_fec);
+
+    //! Get FEC scheme implemented by decoder.
+    virtual packet::FECScheme scheme() const;
+
+private:
+    static const size_t MAX_DATA_PACKETS = ROC_CONFIG_MAX_FEC_BLOCK_DATA_PACKETS;
+    static const size_t MAX_FEC_PACKETS = ROC_CONFIG_MAX_FEC_BLOCK_REDUNDANT_PACKETS;
+
+    // Scratch space used while block is repaired.
+    struct Scratch {
+        // Indices of lost data buffers and of FEC buffers used to restore them.
+        size_t lost[MAX_FEC_PACKETS];
+        size_t rows[MAX_FEC_PACKETS];
+
+        // Submatrix of generator matrix and its inverse.
+        uint8_t matrix[MAX_FEC_PACKETS][MAX_FEC_PACKETS];
+        uint8_t inverse[MAX_FEC_PACKETS][MAX_FEC_PACKETS];
+    };
+
+    void decode_();
+    void decode_(Scratch&);
+    bool invert_(Scratch&, size_t n);
+
+    void report_();
+
+    size_t n_data_;
+    size_t n_fec_;
+
+    size_t symb_sz_;
+
+    const GF256& gf_;
+    const IGF256Kernel& kernel_;
+
+    core::IByteBufferComposer& composer_;
+
+    core::Array<core::IByteBufferConstSlice, MAX_DATA_PACKETS + MAX_FEC_PACKETS> buffers_;
+    core::Array<bool, MAX_DATA_PACKETS + MAX_FEC_PACKETS> received_;
+
+    bool decoding_attempted_;
+};
+
+} // namespace fec
+} // namespace roc
+
+#endif // ROC_FEC_RS_BLOCK_DECODER_H_
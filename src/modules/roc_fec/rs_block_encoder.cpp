@@ -0,0 +1,142 @@
+/*
+ * Copyright (c) 2015 Mikhail Baranov
+ * Copyright (c) 2015 Victor Gaydov
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <string.h>
+
+#include "roc_core/panic.h"
+#include "roc_core/log.h"
+#include "roc_core/singleton.h"
+#include "roc_fec/rs_block_encoder.h"
+#include "roc_fec/rs_matrix.h"
+#include "roc_fec/default_gf256_kernel.h"
+
+namespace roc {
+namespace fec {
+
+RS_BlockEncoder::RS_BlockEncoder(core::IByteBufferComposer& composer,
+                                 size_t n_data,
+                                 size_t n_fec,
+                                 const IGF256Kernel* kernel)
+    : n_data_(n_data)
+    , n_fec_(n_fec)
+    , gf_(core::Singleton<GF256>::instance())
+    , kernel_(kernel ? *kernel : default_gf256_kernel())
+    , composer_(composer)
+    , buffers_(n_data + n_fec)
+    , fec_buffers_(n_fec) {
+    roc_log(LOG_TRACE, "initializing rs encoder: n_data=%lu n_fec=%lu kernel=%s",
+            (unsigned long)n_data, (unsigned long)n_fec, kernel_.name());
+
+    if (n_data == 0 || n_data > ROC_CONFIG_MAX_FEC_BLOCK_DATA_PACKETS) {
+        roc_panic("rs encoder: invalid number of data packets: n_data=%lu max=%lu",
+                  (unsigned long)n_data,
+                  (unsigned long)ROC_CONFIG_MAX_FEC_BLOCK_DATA_PACKETS);
+    }
+
+    if (n_fec == 0 || n_fec > ROC_CONFIG_MAX_FEC_BLOCK_REDUNDANT_PACKETS) {
+        roc_panic("rs encoder: invalid number of fec packets: n_fec=%lu max=%lu",
+                  (unsigned long)n_fec,
+                  (unsigned long)ROC_CONFIG_MAX_FEC_BLOCK_REDUNDANT_PACKETS);
+    }
+}
+
+void RS_BlockEncoder::write(size_t index, const core::IByteBufferConstSlice& buffer) {
+    if (index >= n_data_) {
+        roc_panic("rs encoder: can't write more than %lu data buffers",
+                  (unsigned long)n_data_);
+    }
+
+    if (!buffer) {
+        roc_panic("rs encoder: NULL buffer");
+    }
+
+    if (buffers_[0] && buffer.size() != buffers_[0].size()) {
+        roc_panic("rs encoder: data buffers should have equal size: size=%lu, "
+                  "expected=%lu",
+                  (unsigned long)buffer.size(), (unsigned long)buffers_[0].size());
+    }
+
+    buffers_[index] = buffer;
+}
+
+void RS_BlockEncoder::set_fec_buffer(size_t index, const core::IByteBufferSlice& buffer) {
+    if (index >= n_fec_) {
+        roc_panic("rs encoder: can't set more than %lu fec buffers",
+                  (unsigned long)n_fec_);
+    }
+
+    fec_buffers_[index] = buffer;
+}
+
+void RS_BlockEncoder::commit() {
+    for (size_t j = 0; j < n_data_; ++j) {
+        if (!buffers_[j]) {
+            roc_panic("rs encoder: data buffer wasn't written: index=%lu",
+                      (unsigned long)j);
+        }
+    }
+
+    const size_t symb_sz = buffers_[0].size();
+
+    for (size_t i = 0; i < n_fec_; ++i) {
+        core::IByteBufferSlice buffer = fec_buffers_[i];
+
+        if (!buffer || buffer.size() != symb_sz) {
+            core::IByteBufferPtr new_buffer = composer_.compose();
+            if (!new_buffer) {
+                roc_log(LOG_TRACE, "rs encoder: can't allocate buffer");
+                continue;
+            }
+            new_buffer->set_size(symb_sz);
+            buffer = *new_buffer;
+        }
+
+        memset(buffer.data(), 0, symb_sz);
+
+        for (size_t j = 0; j < n_data_; ++j) {
+            kernel_.mul_add(buffer.data(), buffers_[j].data(),
+                            rs_coefficient(gf_, n_fec_, i, j), symb_sz);
+        }
+
+        buffers_[n_data_ + i] = buffer;
+    }
+}
+
+core::IByteBufferConstSlice RS_BlockEncoder::read(size_t index) {
+    if (index >= n_fec_) {
+        roc_panic("rs encoder: can't read more than %lu fec buffers",
+                  (unsigned long)n_fec_);
+    }
+
+    return buffers_[n_data_ + index];
+}
+
+void RS_BlockEncoder::reset() {
+    for (size_t i = 0; i < buffers_.size(); ++i) {
+        buffers_[i] = core::IByteBufferConstSlice();
+    }
+    for (size_t i = 0; i < fec_buffers_.size(); ++i) {
+        fec_buffers_[i] = core::IByteBufferSlice();
+    }
+}
+
+size_t RS_BlockEncoder::n_data_packets() const {
+    return n_data_;
+}
+
+size_t RS_BlockEncoder::n_fec_packets() const {
+    return n_fec_;
+}
+
+packet::FECScheme RS_BlockEncoder::scheme() const {
+    return packet::FEC_ReedSolomon8;
+}
+
+} // namespace fec
+} // namespace roc
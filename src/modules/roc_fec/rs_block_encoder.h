@@ -0,0 +1,94 @@
+/*
+ * Copyright (c) 2015 Mikhail Baranov
+ * Copyright (c) 2015 Victor Gaydov
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+//! @file roc_fec/rs_block_encoder.h
+//! @brief Reed-Solomon implementation of IBlockEncoder.
+
+#ifndef ROC_FEC_RS_BLOCK_ENCODER_H_
+#define ROC_FEC_RS_BLOCK_ENCODER_H_
+
+#include "roc_config/config.h"
+#include "roc_core/noncopyable.h"
+#include "roc_core/byte_buffer.h"
+#include "roc_core/array.h"
+#include "roc_datagram/default_buffer_composer.h"
+#include "roc_fec/iblock_encoder.h"
+#include "roc_fec/igf256_kernel.h"
+#include "roc_fec/gf256.h"
+
+namespace roc {
+namespace fec {
+
+//! Reed-Solomon implementation of IBlockEncoder.
+//! @remarks
+//!  Systematic code over GF(2^8) with Cauchy generator matrix. Unlike
+//!  LDPC-Staircase, any n_data received buffers are always enough to
+//!  restore data, which matters for small blocks. All data buffers in
+//!  block should have the same size, which becomes the size of FEC buffers.
+class RS_BlockEncoder : public IBlockEncoder, public core::NonCopyable<> {
+public:
+    //! Construct.
+    //!
+    //! @b Parameters
+    //!  - @p composer is used to allocate FEC buffers;
+    //!  - @p n_data is number of data buffers in block;
+    //!  - @p n_fec is number of FEC buffers in block;
+    //!  - @p kernel is used to compute FEC buffers.
+    explicit RS_BlockEncoder(
+        core::IByteBufferComposer& composer = datagram::default_buffer_composer(),
+        size_t n_data = ROC_CONFIG_DEFAULT_FEC_BLOCK_DATA_PACKETS,
+        size_t n_fec = ROC_CONFIG_DEFAULT_FEC_BLOCK_REDUNDANT_PACKETS,
+        const IGF256Kernel* kernel = NULL);
+
+    //! Store data buffer to current block at given position.
+    virtual void write(size_t index, const core::IByteBufferConstSlice& buffer);
+
+    //! Provide buffer for FEC symbol at given position.
+    virtual void set_fec_buffer(size_t index, const core::IByteBufferSlice& buffer);
+
+    //! Finish writing data buffers for current block.
+    virtual void commit();
+
+    //! Retreive calculated FEC buffer at given position.
+    virtual core::IByteBufferConstSlice read(size_t index);
+
+    //! Reset state and start next block.
+    virtual void reset();
+
+    //! Get number of data buffers in block.
+    virtual size_t n_data_packets() const;
+
+    //! Get number of FEC buffers in block.
+    virtual size_t n_fec_packets() const;
+
+    //! Get FEC scheme implemented by encoder.
+    virtual packet::FECScheme scheme() const;
+
+private:
+    static const size_t MAX_PACKETS = ROC_CONFIG_MAX_FEC_BLOCK_DATA_PACKETS
+        + ROC_CONFIG_MAX_FEC_BLOCK_REDUNDANT_PACKETS;
+
+    static const size_t MAX_FEC_PACKETS = ROC_CONFIG_MAX_FEC_BLOCK_REDUNDANT_PACKETS;
+
+    const size_t n_data_;
+    const size_t n_fec_;
+
+    const GF256& gf_;
+    const IGF256Kernel& kernel_;
+
+    core::IByteBufferComposer& composer_;
+
+    core::Array<core::IByteBufferConstSlice, MAX_PACKETS> buffers_;
+    core::Array<core::IByteBufferSlice, MAX_FEC_PACKETS> fec_buffers_;
+};
+
+} // namespace fec
+} // namespace roc
+
+#endif // ROC_FEC_RS_BLOCK_ENCODER_H_
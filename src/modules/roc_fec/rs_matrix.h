@@ -0,0 +1,44 @@
+/*
+ * Copyright (c) 2015 Mikhail Baranov
+ * Copyright (c) 2015 Victor Gaydov
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+//! @file roc_fec/rs_matrix.h
+//! @brief Reed-Solomon generator matrix.
+
+#ifndef ROC_FEC_RS_MATRIX_H_
+#define ROC_FEC_RS_MATRIX_H_
+
+#include "roc_core/stddefs.h"
+#include "roc_core/panic.h"
+#include "roc_fec/gf256.h"
+
+namespace roc {
+namespace fec {
+
+//! Get coefficient of Reed-Solomon generator matrix.
+//! @remarks
+//!  Repair symbol @p fec_index is a sum of data symbols multiplied by
+//!  coefficients of Cauchy matrix:
+//!  @code
+//!   C[i][j] = 1 / (x[i] + y[j]), where x[i] = i, y[j] = n_fec + j
+//!  @endcode
+//!  Every square submatrix of Cauchy matrix is invertible, so any @p n_data
+//!  received symbols are enough to restore data. All x[i] and y[j] should be
+//!  distinct elements, hence n_data + n_fec can't exceed 256.
+inline uint8_t
+rs_coefficient(const GF256& gf, size_t n_fec, size_t fec_index, size_t data_index) {
+    roc_panic_if_not(fec_index < n_fec);
+    roc_panic_if_not(n_fec + data_index <= 0xff);
+
+    return gf.inv(uint8_t(fec_index ^ (n_fec + data_index)));
+}
+
+} // namespace fec
+} // namespace roc
+
+#endif // ROC_FEC_RS_MATRIX_H_
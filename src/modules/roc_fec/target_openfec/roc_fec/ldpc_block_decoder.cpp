@@ -10,6 +10,7 @@
 #include "roc_config/config.h"
 #include "roc_core/panic.h"
 #include "roc_core/log.h"
+#include "roc_core/math.h"
 #include "roc_fec/ldpc_block_decoder.h"
 
 namespace roc {
@@ -19,70 +20,105 @@ namespace {
 
 const size_t SYMB_SZ = ROC_CONFIG_DEFAULT_PACKET_SIZE;
 
+// LDPC-Staircase N1 parameter, can't exceed number of FEC symbols.
+const size_t N1 = 7;
+
 } // namespace
 
 LDPC_BlockDecoder::LDPC_BlockDecoder(core::IByteBufferComposer& composer)
-    : of_inst_(NULL)
-    , of_inst_inited_(false)
+    : n_data_(0)
+    , n_fec_(0)
+    , of_inst_(NULL)
     , composer_(composer)
-    , buffers_(N_DATA_PACKETS + N_FEC_PACKETS)
-    , sym_tab_(N_DATA_PACKETS + N_FEC_PACKETS)
-    , received_(N_DATA_PACKETS + N_FEC_PACKETS) {
+    , defecation_attempted_(false)
+    , packets_rcvd_(0)
+    , data_rcvd_(0)
+    , n_codecs_(0) {
     roc_log(LOG_TRACE, "initializing ldpc decoder");
 
-    of_inst_params_.nb_source_symbols = N_DATA_PACKETS;
-    of_inst_params_.nb_repair_symbols = N_FEC_PACKETS;
     of_inst_params_.encoding_symbol_length = SYMB_SZ;
     of_inst_params_.prng_seed = 1297501556;
-    of_inst_params_.N1 = 7;
 
     of_verbosity = 0;
 
-    LDPC_BlockDecoder::reset(); // non-virtual call from ctor
+    // non-virtual call from ctor
+    LDPC_BlockDecoder::resize(ROC_CONFIG_DEFAULT_FEC_BLOCK_DATA_PACKETS,
+                              ROC_CONFIG_DEFAULT_FEC_BLOCK_REDUNDANT_PACKETS);
 }
 
 LDPC_BlockDecoder::~LDPC_BlockDecoder() {
+    release_codec_();
+}
+
+size_t LDPC_BlockDecoder::num_codecs() const {
+    return n_codecs_;
 }
 
 void LDPC_BlockDecoder::write(size_t index, const core::IByteBufferConstSlice& buffer) {
-    if (index >= N_DATA_PACKETS + N_FEC_PACKETS) {
+    if (index >= n_data_ + n_fec_) {
         roc_panic("ldpc decoder: index out of bounds: index=%lu, size=%lu",
-                  (unsigned long)index, (unsigned long)(N_DATA_PACKETS + N_FEC_PACKETS));
+                  (unsigned long)index, (unsigned long)(n_data_ + n_fec_));
     }
 
     if (!buffer) {
         roc_panic("ldpc decoder: NULL buffer");
     }
 
-    if (buffer.size() != SYMB_SZ) {
-        roc_panic("ldpc decoder: invalid payload size: size=%lu, expected=%lu",
-                  (unsigned long)buffer.size(), (unsigned long)SYMB_SZ);
+    if (received_[index]) {
+        roc_panic("ldpc decoder: can't overwrite buffer: index=%lu",
+                  (unsigned long)index);
     }
 
     if (buffers_[index]) {
-        roc_panic("ldpc decoder: can't overwrite buffer: index=%lu",
-                  (unsigned long)index);
+        // Buffer was already restored by decoder.
+        return;
+    }
+
+    if (buffer.size() != SYMB_SZ) {
+        roc_log(LOG_DEBUG, "ldpc decoder: dropping buffer of unexpected size:"
+                           " size=%lu, expected=%lu",
+                (unsigned long)buffer.size(), (unsigned long)SYMB_SZ);
+        return;
     }
 
     defecation_attempted_ = false;
     ++packets_rcvd_;
 
+    if (index < n_data_) {
+        ++data_rcvd_;
+    }
+
     // const_cast<> is OK since OpenFEC will not modify this buffer.
     sym_tab_[index] = const_cast<uint8_t*>(buffer.data());
     buffers_[index] = buffer;
     received_[index] = true;
+
+    if (of_inst_) {
+        decode_symbol_(index);
+    } else if (index >= n_data_ && data_rcvd_ < n_data_) {
+        start_decoding_();
+    }
 }
 
 core::IByteBufferConstSlice LDPC_BlockDecoder::repair(size_t index) {
     if (!buffers_[index] && !defecation_attempted_) {
         defecation_attempted_ = true;
 
-        if ((packets_rcvd_ >= N_DATA_PACKETS)
-            && (of_set_available_symbols(of_inst_, &sym_tab_[0]) != OF_STATUS_OK)) {
+        // Decoding can't succeed with less than n_data_ symbols, so don't
+        // even create codec instance in this case.
+        if (packets_rcvd_ < n_data_) {
             return core::IByteBufferConstSlice();
         }
 
-        of_finish_decoding(of_inst_);
+        if (!of_inst_ && !start_decoding_()) {
+            return core::IByteBufferConstSlice();
+        }
+
+        // Iterative decoding was already done in write(); finish with
+        // maximum likelihood decoding if it wasn't enough.
+        if (!of_is_decoding_complete(of_inst_)) {
+            of_finish_decoding(of_inst_);
+        }
 
         if (of_get_source_symbols_tab(of_inst_, &sym_tab_[0]) != OF_STATUS_OK) {
             return core::IByteBufferConstSlice();
@@ -96,45 +132,127 @@ void LDPC_BlockDecoder::reset() {
     report_();
 
     packets_rcvd_ = 0;
+    data_rcvd_ = 0;
     defecation_attempted_ = false;
-    if (of_inst_inited_ && of_inst_) {
-        of_release_codec_instance(of_inst_);
+
+    release_codec_();
+
+    for (size_t i = 0; i < buffers_.size(); ++i) {
+        buffers_[i] = core::IByteBufferConstSlice();
+        sym_tab_[i] = NULL;
+        received_[i] = false;
+    }
+}
+
+bool LDPC_BlockDecoder::resize(size_t n_data, size_t n_fec) {
+    if (n_data == 0 || n_data > MAX_DATA_PACKETS) {
+        roc_log(LOG_ERROR, "ldpc decoder: unsupported number of data packets:"
+                           " n_data=%lu max=%lu",
+                (unsigned long)n_data, (unsigned long)MAX_DATA_PACKETS);
+        return false;
+    }
+
+    if (n_fec == 0 || n_fec > MAX_FEC_PACKETS) {
+        roc_log(LOG_ERROR, "ldpc decoder: unsupported number of fec packets:"
+                           " n_fec=%lu max=%lu",
+                (unsigned long)n_fec, (unsigned long)MAX_FEC_PACKETS);
+        return false;
     }
 
+    reset();
+
+    n_data_ = n_data;
+    n_fec_ = n_fec;
+
+    of_inst_params_.nb_source_symbols = (uint32_t)n_data_;
+    of_inst_params_.nb_repair_symbols = (uint32_t)n_fec_;
+    of_inst_params_.N1 = (uint8_t)ROC_MIN(N1, n_fec_);
+
+    buffers_.resize(n_data_ + n_fec_);
+    sym_tab_.resize(n_data_ + n_fec_);
+    received_.resize(n_data_ + n_fec_);
+
+    return true;
+}
+
+packet::FECScheme LDPC_BlockDecoder::scheme() const {
+    return packet::FEC_LDPC_Staircase;
+}
+
+bool LDPC_BlockDecoder::create_codec_() {
+    roc_panic_if(of_inst_ != NULL);
+
     if (OF_STATUS_OK != of_create_codec_instance(
                             &of_inst_, OF_CODEC_LDPC_STAIRCASE_STABLE, OF_DECODER, 0)) {
-        roc_panic("ldpc decoder: of_create_codec_instance() failed");
+        roc_log(LOG_ERROR, "ldpc decoder: of_create_codec_instance() failed");
+        of_inst_ = NULL;
+        return false;
     }
 
     roc_panic_if(of_inst_ == NULL);
 
     if (OF_STATUS_OK
         != of_set_fec_parameters(of_inst_, (of_parameters_t*)&of_inst_params_)) {
-        roc_panic("ldpc decoder: of_set_fec_parameters() failed");
+        roc_log(LOG_ERROR, "ldpc decoder: of_set_fec_parameters() failed");
+        release_codec_();
+        return false;
     }
 
-    of_inst_inited_ = true;
-
     if (OF_STATUS_OK
         != of_set_callback_functions(of_inst_, source_cb_, repair_cb_, (void*)this)) {
-        roc_panic("ldpc decoder: of_set_callback_functions() failed");
+        roc_log(LOG_ERROR, "ldpc decoder: of_set_callback_functions() failed");
+        release_codec_();
+        return false;
     }
 
-    for (size_t i = 0; i < buffers_.size(); ++i) {
-        buffers_[i] = core::IByteBufferConstSlice();
-        sym_tab_[i] = NULL;
-        received_[i] = false;
+    n_codecs_++;
+
+    return true;
+}
+
+void LDPC_BlockDecoder::release_codec_() {
+    if (of_inst_) {
+        of_release_codec_instance(of_inst_);
+        of_inst_ = NULL;
+    }
+}
+
+bool LDPC_BlockDecoder::start_decoding_() {
+    if (!create_codec_()) {
+        return false;
+    }
+
+    for (size_t i = 0; i < received_.size(); ++i) {
+        if (received_[i]) {
+            decode_symbol_(i);
+        }
+    }
+
+    return true;
+}
+
+void LDPC_BlockDecoder::decode_symbol_(size_t index) {
+    roc_panic_if(of_inst_ == NULL);
+
+    if (of_is_decoding_complete(of_inst_)) {
+        return;
+    }
+
+    if (of_decode_with_new_symbol(of_inst_, sym_tab_[index], (uint32_t)index)
+        != OF_STATUS_OK) {
+        roc_log(LOG_DEBUG, "ldpc decoder: of_decode_with_new_symbol() failed: index=%lu",
+                (unsigned long)index);
     }
 }
 
 void LDPC_BlockDecoder::report_() {
     size_t n_lost = 0, n_repaired = 0;
 
-    char status1[N_DATA_PACKETS + 1] = {};
-    char status2[N_FEC_PACKETS + 1] = {};
+    char status1[MAX_DATA_PACKETS + 1] = {};
+    char status2[MAX_FEC_PACKETS + 1] = {};
 
     for (size_t i = 0; i < buffers_.size(); ++i) {
-        char* status = (i < N_DATA_PACKETS ? &status1[i] : &status2[i - N_DATA_PACKETS]);
+        char* status = (i < n_data_ ? &status1[i] : &status2[i - n_data_]);
 
         if (buffers_[i]) {
             if (received_[i]) {
@@ -145,7 +263,7 @@ void LDPC_BlockDecoder::report_() {
                 n_lost++;
             }
         } else {
-            if (i < N_DATA_PACKETS) {
+            if (i < n_data_) {
                 *status = 'X';
             } else {
                 *status = 'x';
@@ -167,7 +285,7 @@ void LDPC_BlockDecoder::report_() {
 }
 
 void* LDPC_BlockDecoder::make_buffer_(const size_t index) {
-    roc_panic_if_not(index < N_DATA_PACKETS + N_FEC_PACKETS);
+    roc_panic_if_not(index < n_data_ + n_fec_);
 
     if (core::IByteBufferPtr buffer = composer_.compose()) {
         buffer->set_size(SYMB_SZ);
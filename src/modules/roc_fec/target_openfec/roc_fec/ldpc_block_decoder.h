@@ -37,9 +37,22 @@ namespace roc {
 namespace fec {
 
 //! Implementation of IBlockDecoder using OpenFEC library.
+//!
+//! @remarks
+//!  Creating OpenFEC codec instance involves building parity check matrix,
+//!  which is expensive. Since OpenFEC doesn't allow to reset decoding state,
+//!  codec instance can't be reused across blocks. Instead, it's created lazily
+//!  only when block actually needs repair, and released on reset().
+//!
+//!  Block is considered to need repair when FEC buffer is written while some
+//!  data buffers are still missing. From that moment, every written buffer is
+//!  passed to OpenFEC iterative decoder immediately, so that decoding work is
+//!  spread over writes and repair() usually only has to fetch restored buffers.
 class LDPC_BlockDecoder : public IBlockDecoder, public core::NonCopyable<> {
 public:
     //! Construct.
+    //! @remarks
+    //!  Uses default block geometry until resize() is called.
     explicit LDPC_BlockDecoder(
         core::IByteBufferComposer& composer = datagram::default_buffer_composer());
 
@@ -54,30 +67,50 @@ public:
     //! Reset state and start next block.
     virtual void reset();
 
+    //! Change block geometry.
+    virtual bool resize(size_t n_data, size_t n_fec);
+
+    //! Get FEC scheme implemented by decoder.
+    virtual packet::FECScheme scheme() const;
+
+    //! Get number of codec instances created so far.
+    size_t num_codecs() const;
+
 private:
-    static const size_t N_DATA_PACKETS = ROC_CONFIG_DEFAULT_FEC_BLOCK_DATA_PACKETS;
-    static const size_t N_FEC_PACKETS = ROC_CONFIG_DEFAULT_FEC_BLOCK_REDUNDANT_PACKETS;
+    static const size_t MAX_DATA_PACKETS = ROC_CONFIG_MAX_FEC_BLOCK_DATA_PACKETS;
+    static const size_t MAX_FEC_PACKETS = ROC_CONFIG_MAX_FEC_BLOCK_REDUNDANT_PACKETS;
 
     static void* source_cb_(void* context, uint32_t size, uint32_t index);
     static void* repair_cb_(void* context, uint32_t size, uint32_t index);
 
+    bool create_codec_();
+    void release_codec_();
+
+    bool start_decoding_();
+    void decode_symbol_(size_t index);
+
     void report_();
 
     void* make_buffer_(const size_t index);
 
+    size_t n_data_;
+    size_t n_fec_;
+
     of_session_t* of_inst_;
-    bool of_inst_inited_;
     of_ldpc_parameters of_inst_params_;
 
     core::IByteBufferComposer& composer_;
 
-    core::Array<core::IByteBufferConstSlice, N_DATA_PACKETS + N_FEC_PACKETS> buffers_;
-    core::Array<void*, N_DATA_PACKETS + N_FEC_PACKETS> sym_tab_;
-    core::Array<bool, N_DATA_PACKETS + N_FEC_PACKETS> received_;
+    core::Array<core::IByteBufferConstSlice, MAX_DATA_PACKETS + MAX_FEC_PACKETS> buffers_;
+    core::Array<void*, MAX_DATA_PACKETS + MAX_FEC_PACKETS> sym_tab_;
+    core::Array<bool, MAX_DATA_PACKETS + MAX_FEC_PACKETS> received_;
 
     bool defecation_attempted_;
 
     size_t packets_rcvd_;
+    size_t data_rcvd_;
+
+    size_t n_codecs_;
 };
 
 } // namespace fec
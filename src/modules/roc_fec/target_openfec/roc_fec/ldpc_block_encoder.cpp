@@ -10,6 +10,7 @@
 #include "roc_config/config.h"
 #include "roc_core/panic.h"
 #include "roc_core/log.h"
+#include "roc_core/math.h"
 #include "roc_fec/ldpc_block_encoder.h"
 
 namespace roc {
@@ -19,14 +20,34 @@ namespace {
 
 const size_t SYMB_SZ = ROC_CONFIG_DEFAULT_PACKET_SIZE;
 
+// LDPC-Staircase N1 parameter, can't exceed number of FEC symbols.
+const size_t N1 = 7;
+
 } // namespace
 
-LDPC_BlockEncoder::LDPC_BlockEncoder(core::IByteBufferComposer& composer)
-    : of_inst_(NULL)
+LDPC_BlockEncoder::LDPC_BlockEncoder(core::IByteBufferComposer& composer,
+                                     size_t n_data,
+                                     size_t n_fec)
+    : n_data_(n_data)
+    , n_fec_(n_fec)
+    , of_inst_(NULL)
     , composer_(composer)
-    , sym_tab_(N_DATA_PACKETS + N_FEC_PACKETS)
-    , buffers_(N_DATA_PACKETS + N_FEC_PACKETS) {
-    roc_log(LOG_TRACE, "initializing ldpc encoder");
+    , sym_tab_(n_data + n_fec)
+    , buffers_(n_data + n_fec) {
+    roc_log(LOG_TRACE, "initializing ldpc encoder: n_data=%lu n_fec=%lu",
+            (unsigned long)n_data, (unsigned long)n_fec);
+
+    if (n_data == 0 || n_data > ROC_CONFIG_MAX_FEC_BLOCK_DATA_PACKETS) {
+        roc_panic("ldpc encoder: invalid number of data packets: n_data=%lu max=%lu",
+                  (unsigned long)n_data,
+                  (unsigned long)ROC_CONFIG_MAX_FEC_BLOCK_DATA_PACKETS);
+    }
+
+    if (n_fec == 0 || n_fec > ROC_CONFIG_MAX_FEC_BLOCK_REDUNDANT_PACKETS) {
+        roc_panic("ldpc encoder: invalid number of fec packets: n_fec=%lu max=%lu",
+                  (unsigned long)n_fec,
+                  (unsigned long)ROC_CONFIG_MAX_FEC_BLOCK_REDUNDANT_PACKETS);
+    }
 
     of_ldpc_parameters params;
 
@@ -39,11 +60,11 @@ LDPC_BlockEncoder::LDPC_BlockEncoder(core::IByteBufferComposer& composer)
 
     roc_panic_if(of_inst_ == NULL);
 
-    params.nb_source_symbols = N_DATA_PACKETS;
-    params.nb_repair_symbols = N_FEC_PACKETS;
+    params.nb_source_symbols = (uint32_t)n_data_;
+    params.nb_repair_symbols = (uint32_t)n_fec_;
     params.encoding_symbol_length = SYMB_SZ;
     params.prng_seed = 1297501556;
-    params.N1 = 7;
+    params.N1 = (uint8_t)ROC_MIN(N1, n_fec_);
 
     if (OF_STATUS_OK != of_set_fec_parameters(of_inst_, (of_parameters_t*)&params)) {
         roc_panic("ldpc encoder: of_set_fec_parameters() failed");
@@ -55,9 +76,9 @@ LDPC_BlockEncoder::~LDPC_BlockEncoder() {
 }
 
 void LDPC_BlockEncoder::write(size_t index, const core::IByteBufferConstSlice& buffer) {
-    if (index >= N_DATA_PACKETS) {
+    if (index >= n_data_) {
         roc_panic("ldpc encoder: can't write more than %lu data buffers",
-                  (unsigned long)N_DATA_PACKETS);
+                  (unsigned long)n_data_);
     }
 
     if (!buffer) {
@@ -68,24 +89,47 @@ void LDPC_BlockEncoder::write(size_t index, const core::IByteBufferConstSlice& b
         roc_panic("ldpc encoder: buffer data should be 8-byte aligned");
     }
 
+    if (buffer.size() != SYMB_SZ) {
+        roc_panic("ldpc encoder: invalid buffer size: size=%lu, expected=%lu",
+                  (unsigned long)buffer.size(), (unsigned long)SYMB_SZ);
+    }
+
     // const_cast<> is OK since OpenFEC will not modify this buffer.
     sym_tab_[index] = const_cast<uint8_t*>(buffer.data());
     buffers_[index] = buffer;
 }
 
+void LDPC_BlockEncoder::set_fec_buffer(size_t index,
+                                       const core::IByteBufferSlice& buffer) {
+    if (index >= n_fec_) {
+        roc_panic("ldpc encoder: can't set more than %lu fec buffers",
+                  (unsigned long)n_fec_);
+    }
+
+    if (!buffer || buffer.size() != SYMB_SZ || (uintptr_t)buffer.data() % 8 != 0) {
+        return;
+    }
+
+    sym_tab_[n_data_ + index] = buffer.data();
+    buffers_[n_data_ + index] = buffer;
+}
+
 void LDPC_BlockEncoder::commit() {
-    for (size_t i = 0; i < N_FEC_PACKETS; ++i) {
+    for (size_t i = 0; i < n_fec_; ++i) {
+        if (buffers_[n_data_ + i]) {
+            continue;
+        }
         if (core::IByteBufferPtr buffer = composer_.compose()) {
             buffer->set_size(SYMB_SZ);
-            sym_tab_[N_DATA_PACKETS + i] = buffer->data();
-            buffers_[N_DATA_PACKETS + i] = *buffer;
+            sym_tab_[n_data_ + i] = buffer->data();
+            buffers_[n_data_ + i] = *buffer;
         } else {
             roc_log(LOG_TRACE, "ldpc encoder: can't allocate buffer");
-            sym_tab_[N_DATA_PACKETS + i] = NULL;
+            sym_tab_[n_data_ + i] = NULL;
         }
     }
 
-    for (size_t i = N_DATA_PACKETS; i < N_DATA_PACKETS + N_FEC_PACKETS; ++i) {
+    for (size_t i = n_data_; i < n_data_ + n_fec_; ++i) {
         if (OF_STATUS_OK != of_build_repair_symbol(of_inst_, &sym_tab_[0], (uint32_t)i)) {
             roc_panic("ldpc encoder: of_build_repair_symbol() failed");
         }
@@ -93,12 +137,12 @@ void LDPC_BlockEncoder::commit() {
 }
 
 core::IByteBufferConstSlice LDPC_BlockEncoder::read(size_t index) {
-    if (index >= N_FEC_PACKETS) {
+    if (index >= n_fec_) {
         roc_panic("ldpc encoder: can't read more than %lu fec buffers",
-                  (unsigned long)N_FEC_PACKETS);
+                  (unsigned long)n_fec_);
     }
 
-    return buffers_[N_DATA_PACKETS + index];
+    return buffers_[n_data_ + index];
 }
 
 void LDPC_BlockEncoder::reset() {
@@ -108,5 +152,17 @@ void LDPC_BlockEncoder::reset() {
     }
 }
 
+size_t LDPC_BlockEncoder::n_data_packets() const {
+    return n_data_;
+}
+
+size_t LDPC_BlockEncoder::n_fec_packets() const {
+    return n_fec_;
+}
+
+packet::FECScheme LDPC_BlockEncoder::scheme() const {
+    return packet::FEC_LDPC_Staircase;
+}
+
 } // namespace fec
 } // namespace roc
@@ -40,14 +40,27 @@ namespace fec {
 class LDPC_BlockEncoder : public IBlockEncoder, public core::NonCopyable<> {
 public:
     //! Construct.
+    //!
+    //! @b Parameters
+    //!  - @p composer is used to allocate FEC buffers;
+    //!  - @p n_data is number of data buffers in block;
+    //!  - @p n_fec is number of FEC buffers in block.
     explicit LDPC_BlockEncoder(
-        core::IByteBufferComposer& composer = datagram::default_buffer_composer());
+        core::IByteBufferComposer& composer = datagram::default_buffer_composer(),
+        size_t n_data = ROC_CONFIG_DEFAULT_FEC_BLOCK_DATA_PACKETS,
+        size_t n_fec = ROC_CONFIG_DEFAULT_FEC_BLOCK_REDUNDANT_PACKETS);
 
     virtual ~LDPC_BlockEncoder();
 
     //! Store data buffer to current block at given position.
     virtual void write(size_t index, const core::IByteBufferConstSlice& buffer);
 
+    //! Provide buffer for FEC symbol at given position.
+    //! @remarks
+    //!  Buffer is used only if its size equals to encoding symbol size and
+    //!  its data is 8-byte aligned.
+    virtual void set_fec_buffer(size_t index, const core::IByteBufferSlice& buffer);
+
     //! Finish writing data buffers for current block.
     virtual void commit();
 
@@ -57,15 +70,27 @@ public:
     //! Reset state and start next block.
     virtual void reset();
 
+    //! Get number of data buffers in block.
+    virtual size_t n_data_packets() const;
+
+    //! Get number of FEC buffers in block.
+    virtual size_t n_fec_packets() const;
+
+    //! Get FEC scheme implemented by encoder.
+    virtual packet::FECScheme scheme() const;
+
 private:
-    static const size_t N_DATA_PACKETS = ROC_CONFIG_DEFAULT_FEC_BLOCK_DATA_PACKETS;
-    static const size_t N_FEC_PACKETS = ROC_CONFIG_DEFAULT_FEC_BLOCK_REDUNDANT_PACKETS;
+    static const size_t MAX_PACKETS = ROC_CONFIG_MAX_FEC_BLOCK_DATA_PACKETS
+        + ROC_CONFIG_MAX_FEC_BLOCK_REDUNDANT_PACKETS;
+
+    const size_t n_data_;
+    const size_t n_fec_;
 
     of_session_t* of_inst_;
     core::IByteBufferComposer& composer_;
 
-    core::Array<void*, N_DATA_PACKETS + N_FEC_PACKETS> sym_tab_;
-    core::Array<core::IByteBufferConstSlice, N_DATA_PACKETS + N_FEC_PACKETS> buffers_;
+    core::Array<void*, MAX_PACKETS> sym_tab_;
+    core::Array<core::IByteBufferConstSlice, MAX_PACKETS> buffers_;
 };
 
 } // namespace fec
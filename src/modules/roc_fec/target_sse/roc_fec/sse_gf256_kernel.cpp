@@ -0,0 +1,158 @@
+/*
+ * Copyright (c) 2015 Mikhail Baranov
+ * Copyright (c) 2015 Victor Gaydov
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <immintrin.h>
+
+#include "roc_core/singleton.h"
+#include "roc_fec/sse_gf256_kernel.h"
+
+namespace roc {
+namespace fec {
+
+namespace {
+
+void scalar_mul_add(
+    uint8_t* dst, const uint8_t* src, const uint8_t* lo, const uint8_t* hi, size_t n) {
+    for (size_t k = 0; k < n; ++k) {
+        dst[k] ^= lo[src[k] & 0xf] ^ hi[src[k] >> 4];
+    }
+}
+
+void sse2_add(uint8_t* dst, const uint8_t* src, size_t n) {
+    size_t k = 0;
+
+    for (; k + 16 <= n; k += 16) {
+        const __m128i s = _mm_loadu_si128((const __m128i*)(src + k));
+        const __m128i d = _mm_loadu_si128((const __m128i*)(dst + k));
+        _mm_storeu_si128((__m128i*)(dst + k), _mm_xor_si128(d, s));
+    }
+
+    for (; k < n; ++k) {
+        dst[k] ^= src[k];
+    }
+}
+
+__attribute__((target("ssse3"))) size_t ssse3_mul_add(
+    uint8_t* dst, const uint8_t* src, const uint8_t* lo, const uint8_t* hi, size_t n) {
+    const __m128i tlo = _mm_loadu_si128((const __m128i*)lo);
+    const __m128i thi = _mm_loadu_si128((const __m128i*)hi);
+    const __m128i mask = _mm_set1_epi8(0x0f);
+
+    size_t k = 0;
+
+    for (; k + 16 <= n; k += 16) {
+        const __m128i s = _mm_loadu_si128((const __m128i*)(src + k));
+        const __m128i d = _mm_loadu_si128((const __m128i*)(dst + k));
+
+        const __m128i l = _mm_shuffle_epi8(tlo, _mm_and_si128(s, mask));
+        const __m128i h =
+            _mm_shuffle_epi8(thi, _mm_and_si128(_mm_srli_epi64(s, 4), mask));
+
+        _mm_storeu_si128((__m128i*)(dst + k), _mm_xor_si128(d, _mm_xor_si128(l, h)));
+    }
+
+    return k;
+}
+
+__attribute__((target("avx2"))) size_t avx2_mul_add(
+    uint8_t* dst, const uint8_t* src, const uint8_t* lo, const uint8_t* hi, size_t n) {
+    // VPSHUFB looks up within each 128-bit lane, so tables are duplicated.
+    const __m256i tlo =
+        _mm256_broadcastsi128_si256(_mm_loadu_si128((const __m128i*)lo));
+    const __m256i thi =
+        _mm256_broadcastsi128_si256(_mm_loadu_si128((const __m128i*)hi));
+    const __m256i mask = _mm256_set1_epi8(0x0f);
+
+    size_t k = 0;
+
+    for (; k + 32 <= n; k += 32) {
+        const __m256i s = _mm256_loadu_si256((const __m256i*)(src + k));
+        const __m256i d = _mm256_loadu_si256((const __m256i*)(dst + k));
+
+        const __m256i l = _mm256_shuffle_epi8(tlo, _mm256_and_si256(s, mask));
+        const __m256i h =
+            _mm256_shuffle_epi8(thi, _mm256_and_si256(_mm256_srli_epi64(s, 4), mask));
+
+        _mm256_storeu_si256((__m256i*)(dst + k),
+                            _mm256_xor_si256(d, _mm256_xor_si256(l, h)));
+    }
+
+    return k + ssse3_mul_add(dst + k, src + k, lo, hi, n - k);
+}
+
+} // namespace
+
+SSSE3GF256Kernel::SSSE3GF256Kernel()
+    : gf_(core::Singleton<GF256>::instance()) {
+}
+
+bool SSSE3GF256Kernel::supported() {
+    __builtin_cpu_init();
+    return __builtin_cpu_supports("ssse3");
+}
+
+const char* SSSE3GF256Kernel::name() const {
+    return "ssse3";
+}
+
+void SSSE3GF256Kernel::mul_add(uint8_t* dst,
+                               const uint8_t* src,
+                               uint8_t c,
+                               size_t n) const {
+    if (c == 0) {
+        return;
+    }
+
+    if (c == 1) {
+        sse2_add(dst, src, n);
+        return;
+    }
+
+    uint8_t lo[16], hi[16];
+    gf_.nibble_tables(c, lo, hi);
+
+    const size_t k = ssse3_mul_add(dst, src, lo, hi, n);
+    scalar_mul_add(dst + k, src + k, lo, hi, n - k);
+}
+
+AVX2GF256Kernel::AVX2GF256Kernel()
+    : gf_(core::Singleton<GF256>::instance()) {
+}
+
+bool AVX2GF256Kernel::supported() {
+    __builtin_cpu_init();
+    return __builtin_cpu_supports("avx2");
+}
+
+const char* AVX2GF256Kernel::name() const {
+    return "avx2";
+}
+
+void AVX2GF256Kernel::mul_add(uint8_t* dst,
+                              const uint8_t* src,
+                              uint8_t c,
+                              size_t n) const {
+    if (c == 0) {
+        return;
+    }
+
+    if (c == 1) {
+        sse2_add(dst, src, n);
+        return;
+    }
+
+    uint8_t lo[16], hi[16];
+    gf_.nibble_tables(c, lo, hi);
+
+    const size_t k = avx2_mul_add(dst, src, lo, hi, n);
+    scalar_mul_add(dst + k, src + k, lo, hi, n - k);
+}
+
+} // namespace fec
+} // namespace roc
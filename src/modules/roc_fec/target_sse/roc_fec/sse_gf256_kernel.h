@@ -0,0 +1,69 @@
+/*
+ * Copyright (c) 2015 Mikhail Baranov
+ * Copyright (c) 2015 Victor Gaydov
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+//! @file roc_fec/target_sse/roc_fec/sse_gf256_kernel.h
+//! @brief SSSE3 and AVX2 GF(2^8) kernels.
+
+#ifndef ROC_FEC_SSE_GF256_KERNEL_H_
+#define ROC_FEC_SSE_GF256_KERNEL_H_
+
+#include "roc_core/noncopyable.h"
+#include "roc_fec/igf256_kernel.h"
+#include "roc_fec/gf256.h"
+
+namespace roc {
+namespace fec {
+
+//! SSSE3 GF(2^8) kernel.
+//! @remarks
+//!  Multiplies sixteen bytes at once by looking up low and high nibbles
+//!  in split multiplication tables with PSHUFB. Compiled for every x86
+//!  build, but may be used only if supported() returns true.
+class SSSE3GF256Kernel : public IGF256Kernel, public core::NonCopyable<> {
+public:
+    SSSE3GF256Kernel();
+
+    //! Check if current CPU supports SSSE3.
+    static bool supported();
+
+    //! Get kernel name.
+    virtual const char* name() const;
+
+    //! Compute dst[k] ^= c * src[k] for k in [0; n).
+    virtual void mul_add(uint8_t* dst, const uint8_t* src, uint8_t c, size_t n) const;
+
+private:
+    const GF256& gf_;
+};
+
+//! AVX2 GF(2^8) kernel.
+//! @remarks
+//!  Same as SSSE3 kernel, but processes thirty two bytes at once. Compiled
+//!  for every x86 build, but may be used only if supported() returns true.
+class AVX2GF256Kernel : public IGF256Kernel, public core::NonCopyable<> {
+public:
+    AVX2GF256Kernel();
+
+    //! Check if current CPU supports AVX2.
+    static bool supported();
+
+    //! Get kernel name.
+    virtual const char* name() const;
+
+    //! Compute dst[k] ^= c * src[k] for k in [0; n).
+    virtual void mul_add(uint8_t* dst, const uint8_t* src, uint8_t c, size_t n) const;
+
+private:
+    const GF256& gf_;
+};
+
+} // namespace fec
+} // namespace roc
+
+#endif // ROC_FEC_SSE_GF256_KERNEL_H_
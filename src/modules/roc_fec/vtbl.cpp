@@ -9,6 +9,8 @@
 
 #include "roc_fec/iblock_encoder.h"
 #include "roc_fec/iblock_decoder.h"
+#include "roc_fec/iblock_decoder_factory.h"
+#include "roc_fec/igf256_kernel.h"
 
 namespace roc {
 namespace fec {
@@ -19,5 +21,11 @@ IBlockEncoder::~IBlockEncoder() {
 IBlockDecoder::~IBlockDecoder() {
 }
 
+IBlockDecoderFactory::~IBlockDecoderFactory() {
+}
+
+IGF256Kernel::~IGF256Kernel() {
+}
+
 } // namespace fec
 } // namespace roc
@@ -0,0 +1,189 @@
+/*
+ * Copyright (c) 2015 Mikhail Baranov
+ * Copyright (c) 2015 Victor Gaydov
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <errno.h>
+#include <unistd.h>
+
+#include "roc_core/errno_to_str.h"
+#include "roc_core/log.h"
+#include "roc_core/panic.h"
+
+#include "roc_datagram/address_to_str.h"
+
+#include "roc_netio/inet_address.h"
+#include "roc_netio/udp_batch_socket.h"
+
+namespace roc {
+namespace netio {
+
+UDPBatchSocket::UDPBatchSocket()
+    : fd_(-1)
+    , owner_(false) {
+    memset(msgs_, 0, sizeof(msgs_));
+    memset(iovecs_, 0, sizeof(iovecs_));
+    memset(addrs_, 0, sizeof(addrs_));
+}
+
+UDPBatchSocket::~UDPBatchSocket() {
+    close();
+}
+
+bool UDPBatchSocket::open(const datagram::Address& address,
+                          size_t rcvbuf_size,
+                          bool reuse_port) {
+    roc_panic_if(fd_ >= 0);
+
+    fd_ = socket(AF_INET, SOCK_DGRAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
+    if (fd_ < 0) {
+        roc_log(LOG_ERROR, "udp batch socket: socket(): %s",
+                core::errno_to_str(errno).c_str());
+        return false;
+    }
+
+    owner_ = true;
+
+    int one = 1;
+    if (setsockopt(fd_, SOL_SOCKET, SO_REUSEADDR, &one, sizeof(one)) != 0) {
+        roc_log(LOG_ERROR, "udp batch socket: setsockopt(SO_REUSEADDR): %s",
+                core::errno_to_str(errno).c_str());
+        close();
+        return false;
+    }
+
+    if (reuse_port) {
+        if (setsockopt(fd_, SOL_SOCKET, SO_REUSEPORT, &one, sizeof(one)) != 0) {
+            roc_log(LOG_ERROR, "udp batch socket: setsockopt(SO_REUSEPORT): %s",
+                    core::errno_to_str(errno).c_str());
+            close();
+            return false;
+        }
+    }
+
+    if (rcvbuf_size != 0) {
+        int value = (int)rcvbuf_size;
+        if (setsockopt(fd_, SOL_SOCKET, SO_RCVBUF, &value, sizeof(value)) != 0) {
+            // Not fatal: kernel just keeps default buffer size.
+            roc_log(LOG_ERROR, "udp batch socket: setsockopt(SO_RCVBUF, %d): %s", value,
+                    core::errno_to_str(errno).c_str());
+        }
+    }
+
+    sockaddr_in inet_addr;
+    to_inet_address(address, inet_addr);
+
+    if (bind(fd_, (const sockaddr*)&inet_addr, sizeof(inet_addr)) != 0) {
+        roc_log(LOG_ERROR, "udp batch socket: bind(%s): %s",
+                datagram::address_to_str(address).c_str(),
+                core::errno_to_str(errno).c_str());
+        close();
+        return false;
+    }
+
+    return true;
+}
+
+void UDPBatchSocket::attach(int fd) {
+    roc_panic_if(fd_ >= 0);
+    roc_panic_if(fd < 0);
+
+    fd_ = fd;
+    owner_ = false;
+}
+
+void UDPBatchSocket::close() {
+    if (fd_ < 0) {
+        return;
+    }
+
+    if (owner_ && ::close(fd_) != 0) {
+        roc_log(LOG_ERROR, "udp batch socket: close(): %s",
+                core::errno_to_str(errno).c_str());
+    }
+
+    fd_ = -1;
+    owner_ = false;
+}
+
+int UDPBatchSocket::fd() const {
+    return fd_;
+}
+
+ssize_t UDPBatchSocket::recv(UDPBatchSlot* slots, size_t n) {
+    roc_panic_if(fd_ < 0);
+    roc_panic_if(n > MaxBatch);
+
+    setup_(slots, n);
+
+    int ret;
+    do {
+        ret = recvmmsg(fd_, msgs_, (unsigned)n, MSG_DONTWAIT, NULL);
+    } while (ret < 0 && errno == EINTR);
+
+    if (ret < 0) {
+        if (errno == EAGAIN) {
+            return 0;
+        }
+        return -errno;
+    }
+
+    for (int i = 0; i < ret; i++) {
+        if (msgs_[i].msg_hdr.msg_flags & MSG_TRUNC) {
+            slots[i].size = 0;
+        } else {
+            slots[i].size = msgs_[i].msg_len;
+        }
+        from_inet_address(addrs_[i], slots[i].address);
+    }
+
+    return ret;
+}
+
+ssize_t UDPBatchSocket::send(const UDPBatchSlot* slots, size_t n) {
+    roc_panic_if(fd_ < 0);
+    roc_panic_if(n > MaxBatch);
+
+    setup_(slots, n);
+
+    for (size_t i = 0; i < n; i++) {
+        to_inet_address(slots[i].address, addrs_[i]);
+    }
+
+    int ret;
+    do {
+        ret = sendmmsg(fd_, msgs_, (unsigned)n, MSG_DONTWAIT);
+    } while (ret < 0 && errno == EINTR);
+
+    if (ret < 0) {
+        if (errno == EAGAIN) {
+            return 0;
+        }
+        return -errno;
+    }
+
+    return ret;
+}
+
+void UDPBatchSocket::setup_(const UDPBatchSlot* slots, size_t n) {
+    for (size_t i = 0; i < n; i++) {
+        iovecs_[i].iov_base = slots[i].data;
+        iovecs_[i].iov_len = slots[i].size;
+
+        msgs_[i].msg_hdr.msg_name = &addrs_[i];
+        msgs_[i].msg_hdr.msg_namelen = sizeof(addrs_[i]);
+        msgs_[i].msg_hdr.msg_iov = &iovecs_[i];
+        msgs_[i].msg_hdr.msg_iovlen = 1;
+        msgs_[i].msg_hdr.msg_control = NULL;
+        msgs_[i].msg_hdr.msg_controllen = 0;
+        msgs_[i].msg_hdr.msg_flags = 0;
+        msgs_[i].msg_len = 0;
+    }
+}
+
+} // namespace netio
+} // namespace roc
@@ -0,0 +1,119 @@
+/*
+ * Copyright (c) 2015 Mikhail Baranov
+ * Copyright (c) 2015 Victor Gaydov
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+//! @file roc_netio/target_linux/roc_netio/udp_batch_socket.h
+//! @brief Batched UDP socket.
+
+#ifndef ROC_NETIO_UDP_BATCH_SOCKET_H_
+#define ROC_NETIO_UDP_BATCH_SOCKET_H_
+
+#include <sys/types.h>
+#include <sys/socket.h>
+#include <netinet/in.h>
+
+#include "roc_config/config.h"
+
+#include "roc_core/noncopyable.h"
+#include "roc_core/stddefs.h"
+
+#include "roc_datagram/address.h"
+
+namespace roc {
+namespace netio {
+
+//! Datagram slot used by batched socket operations.
+struct UDPBatchSlot {
+    //! Datagram data.
+    uint8_t* data;
+
+    //! Datagram size.
+    //! @remarks
+    //!  When receiving, should be set to buffer size before the call and is
+    //!  updated with datagram size after the call.
+    size_t size;
+
+    //! Remote address.
+    datagram::Address address;
+
+    UDPBatchSlot()
+        : data(NULL)
+        , size(0) {
+    }
+};
+
+//! Batched UDP socket.
+//! @remarks
+//!  Non-blocking IPv4 UDP socket that receives and sends multiple datagrams
+//!  per system call using recvmmsg() and sendmmsg().
+class UDPBatchSocket : public core::NonCopyable<> {
+public:
+    //! Maximum number of datagrams per call.
+    enum { MaxBatch = ROC_CONFIG_MAX_UDP_BATCH };
+
+    //! Initialize.
+    UDPBatchSocket();
+
+    //! Close socket if it's opened.
+    ~UDPBatchSocket();
+
+    //! Open socket and bind it to @p address.
+    //! @remarks
+    //!  If @p rcvbuf_size is non-zero, it's used as SO_RCVBUF value.
+    //!  If @p reuse_port is true, SO_REUSEPORT is enabled, so that several
+    //!  sockets may be bound to the same address.
+    bool open(const datagram::Address& address, size_t rcvbuf_size, bool reuse_port);
+
+    //! Use existing socket.
+    //! @remarks
+    //!  @p fd should be a non-blocking UDP socket. It's not owned and is not
+    //!  closed by close().
+    void attach(int fd);
+
+    //! Close socket.
+    void close();
+
+    //! Get file descriptor.
+    //! @returns
+    //!  negative value if socket is not opened.
+    int fd() const;
+
+    //! Receive datagrams.
+    //! @remarks
+    //!  Reads up to @p n datagrams into @p slots without blocking. Datagrams
+    //!  truncated because of small buffer are reported with zero size.
+    //! @returns
+    //!  number of received datagrams, zero if there are no pending datagrams,
+    //!  or negative errno value on error.
+    ssize_t recv(UDPBatchSlot* slots, size_t n);
+
+    //! Send datagrams.
+    //! @remarks
+    //!  Sends up to @p n datagrams from @p slots without blocking. Datagrams
+    //!  are sent in order, so if only some of them were sent, the rest
+    //!  are the tail of @p slots.
+    //! @returns
+    //!  number of sent datagrams, zero if socket send buffer is full,
+    //!  or negative errno value on error.
+    ssize_t send(const UDPBatchSlot* slots, size_t n);
+
+private:
+    void setup_(const UDPBatchSlot* slots, size_t n);
+
+    int fd_;
+    bool owner_;
+
+    mmsghdr msgs_[MaxBatch];
+    iovec iovecs_[MaxBatch];
+    sockaddr_in addrs_[MaxBatch];
+};
+
+} // namespace netio
+} // namespace roc
+
+#endif // ROC_NETIO_UDP_BATCH_SOCKET_H_
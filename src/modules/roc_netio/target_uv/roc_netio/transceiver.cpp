@@ -58,12 +58,13 @@ Transceiver::~Transceiver() {
 }
 
 bool Transceiver::add_udp_receiver(const datagram::Address& address,
-                                   datagram::IDatagramWriter& writer) {
+                                   datagram::IDatagramWriter& writer,
+                                   const UDPReceiverConfig& config) {
     if (joinable()) {
         roc_panic("transceiver: can't call add_udp_receiver() when thread is running");
     }
 
-    return udp_receiver_.add_port(address, writer);
+    return udp_receiver_.add_port(address, writer, config);
 }
 
 bool Transceiver::add_udp_sender(const datagram::Address& address) {
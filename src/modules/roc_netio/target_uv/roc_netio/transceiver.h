@@ -43,13 +43,15 @@ public:
     //! Add UDP datagram receiver.
     //! @remarks
     //!  Datagrams received on @p address will be passed to @p writer.
+    //!  Socket parameters are taken from @p config.
     //! @note
     //!  Writer will be called from network thread.
     //! @pre
     //!  In current implementation, this method should be called before
     //!  starting thread using start().
     bool add_udp_receiver(const datagram::Address& address,
-                          datagram::IDatagramWriter& writer);
+                          datagram::IDatagramWriter& writer,
+                          const UDPReceiverConfig& config = UDPReceiverConfig());
 
     //! Add UDP datagram sender.
     //! @remarks
@@ -13,6 +13,10 @@
 
 #include "roc_datagram/address_to_str.h"
 
+#ifdef ROC_TARGET_LINUX
+#include "roc_core/errno_to_str.h"
+#endif
+
 #include "roc_netio/inet_address.h"
 #include "roc_netio/udp_receiver.h"
 
@@ -54,7 +58,8 @@ void UDPReceiver::detach(uv_loop_t& loop) {
 }
 
 bool UDPReceiver::add_port(const datagram::Address& address,
-                           datagram::IDatagramWriter& writer) {
+                           datagram::IDatagramWriter& writer,
+                           const UDPReceiverConfig& config) {
     roc_log(LOG_DEBUG, "udp receiver: adding port %s",
             datagram::address_to_str(address).c_str());
 
@@ -66,8 +71,14 @@ bool UDPReceiver::add_port(const datagram::Address& address,
         roc_panic("udp receiver: can't add more than %ld ports", (long)ports_.max_size());
     }
 
+    if (config.batch_size > ROC_CONFIG_MAX_UDP_BATCH) {
+        roc_panic("udp receiver: batch size should be <= %ld (got %ld)",
+                  (long)ROC_CONFIG_MAX_UDP_BATCH, (long)config.batch_size);
+    }
+
     Port* port = new (ports_.allocate()) Port;
 
+    port->config = config;
     port->address = address;
     port->writer = &writer;
 
@@ -83,9 +94,20 @@ bool UDPReceiver::add_port(const datagram::Address& address,
 }
 
 bool UDPReceiver::open_port_(Port& port) {
+#ifdef ROC_TARGET_LINUX
+    if (port.config.batch_size > 1) {
+        return open_batched_port_(port);
+    }
+#endif
+
     roc_log(LOG_TRACE, "udp receiver: opening port %s",
             datagram::address_to_str(port.address).c_str());
 
+    if (port.config.reuse_port) {
+        roc_log(LOG_ERROR, "udp receiver: reuse_port is not supported by libuv backend");
+        return false;
+    }
+
     if (int err = uv_udp_init(loop_, &port.handle)) {
         roc_log(LOG_ERROR, "udp receiver: uv_udp_init(): [%s] %s", uv_err_name(err),
                 uv_strerror(err));
@@ -103,6 +125,14 @@ bool UDPReceiver::open_port_(Port& port) {
         return false;
     }
 
+    if (port.config.socket_buffer_size != 0) {
+        int value = (int)port.config.socket_buffer_size;
+        if (int err = uv_recv_buffer_size((uv_handle_t*)&port.handle, &value)) {
+            roc_log(LOG_ERROR, "udp receiver: uv_recv_buffer_size(): [%s] %s",
+                    uv_err_name(err), uv_strerror(err));
+        }
+    }
+
     if (int err = uv_udp_recv_start(&port.handle, alloc_cb_, recv_cb_)) {
         roc_log(LOG_ERROR, "udp receiver: uv_udp_recv_start(): [%s] %s", uv_err_name(err),
                 uv_strerror(err));
@@ -113,6 +143,13 @@ bool UDPReceiver::open_port_(Port& port) {
 }
 
 void UDPReceiver::close_port_(Port& port) {
+#ifdef ROC_TARGET_LINUX
+    if (port.batched) {
+        close_batched_port_(port);
+        return;
+    }
+#endif
+
     if (uv_is_closing((uv_handle_t*)&port.handle)) {
         return;
     }
@@ -240,17 +277,193 @@ void UDPReceiver::recv_cb_(uv_udp_t* handle,
 
     bp->set_size((size_t)nread);
 
-    datagram::IDatagramPtr dgm = self.dgm_composer_.compose();
+    self.write_datagram_(*port, sender_addr, *bp);
+}
+
+#ifdef ROC_TARGET_LINUX
+
+bool UDPReceiver::open_batched_port_(Port& port) {
+    roc_log(LOG_TRACE, "udp receiver: opening batched port %s: batch_size=%ld",
+            datagram::address_to_str(port.address).c_str(),
+            (long)port.config.batch_size);
+
+    port.batched = true;
+
+    if (!port.socket.open(port.address, port.config.socket_buffer_size,
+                          port.config.reuse_port)) {
+        return false;
+    }
+
+    if (int err = uv_poll_init_socket(loop_, &port.poll_handle, port.socket.fd())) {
+        roc_log(LOG_ERROR, "udp receiver: uv_poll_init_socket(): [%s] %s",
+                uv_err_name(err), uv_strerror(err));
+        port.socket.close();
+        return false;
+    }
+
+    port.poll_handle.data = this;
+
+    if (int err = uv_poll_start(&port.poll_handle, UV_READABLE, poll_cb_)) {
+        roc_log(LOG_ERROR, "udp receiver: uv_poll_start(): [%s] %s", uv_err_name(err),
+                uv_strerror(err));
+        uv_close((uv_handle_t*)&port.poll_handle, NULL);
+        port.socket.close();
+        return false;
+    }
+
+    return true;
+}
+
+void UDPReceiver::close_batched_port_(Port& port) {
+    if (port.socket.fd() < 0) {
+        return;
+    }
+
+    roc_log(LOG_TRACE, "udp receiver: closing batched port %s",
+            datagram::address_to_str(port.address).c_str());
+
+    if (int err = uv_poll_stop(&port.poll_handle)) {
+        roc_log(LOG_ERROR, "udp receiver: uv_poll_stop(): [%s] %s", uv_err_name(err),
+                uv_strerror(err));
+    }
+
+    uv_close((uv_handle_t*)&port.poll_handle, NULL);
+
+    // Poll handle is stopped, so socket is no longer watched by event loop.
+    port.socket.close();
+
+    for (size_t n = 0; n < UDPBatchSocket::MaxBatch; n++) {
+        port.buffers[n] = NULL;
+    }
+}
+
+void UDPReceiver::poll_cb_(uv_poll_t* handle, int status, int events) {
+    roc_panic_if_not(handle);
+
+    UDPReceiver& self = *(UDPReceiver*)handle->data;
+
+    Port* port = ROC_CONTAINER_OF(handle, Port, poll_handle);
+
+    if (status < 0) {
+        roc_log(LOG_ERROR, "udp receiver: poll error: dst=%s: [%s] %s",
+                datagram::address_to_str(port->address).c_str(), uv_err_name(status),
+                uv_strerror(status));
+        return;
+    }
+
+    if ((events & UV_READABLE) == 0) {
+        return;
+    }
+
+    // Socket may have more datagrams than fit into one batch. Keep reading
+    // while batches are full, but don't starve other handles of the loop.
+    for (size_t n = 0; n < MaxBatchesPerPoll; n++) {
+        if (self.read_batch_(*port) < port->config.batch_size) {
+            break;
+        }
+    }
+}
+
+size_t UDPReceiver::read_batch_(Port& port) {
+    size_t num_slots = 0;
+
+    for (; num_slots < port.config.batch_size; num_slots++) {
+        core::IByteBufferPtr& bp = port.buffers[num_slots];
+
+        if (!bp) {
+            if (!(bp = buf_composer_.compose())) {
+                roc_log(LOG_ERROR, "udp receiver: can't get buffer from pool");
+                break;
+            }
+        }
+
+        bp->set_size(bp->max_size());
+
+        port.slots[num_slots].data = bp->data();
+        port.slots[num_slots].size = bp->size();
+    }
+
+    if (num_slots == 0) {
+        return 0;
+    }
+
+    const ssize_t num_read = port.socket.recv(port.slots, num_slots);
+
+    if (num_read < 0) {
+        roc_log(LOG_ERROR, "udp receiver: recvmmsg(): dst=%s: %s",
+                datagram::address_to_str(port.address).c_str(),
+                core::errno_to_str((int)-num_read).c_str());
+        return 0;
+    }
+
+    roc_log(LOG_FLOOD, "udp receiver: got batch: dst=%s num_datagrams=%ld",
+            datagram::address_to_str(port.address).c_str(), (long)num_read);
+
+    datagram::IDatagramPtr dgms[UDPBatchSocket::MaxBatch];
+    size_t num_dgms = 0;
+
+    for (size_t n = 0; n < (size_t)num_read; n++) {
+        number_++;
+
+        const UDPBatchSlot& slot = port.slots[n];
+
+        if (slot.size == 0) {
+            // Buffer is left in place and will be reused by next batch.
+            roc_log(LOG_TRACE,
+                    "udp receiver: ignoring empty or truncated datagram:"
+                    " num=%u src=%s dst=%s",
+                    number_,                                        //
+                    datagram::address_to_str(slot.address).c_str(), //
+                    datagram::address_to_str(port.address).c_str());
+            continue;
+        }
+
+        core::IByteBufferPtr bp = port.buffers[n];
+        port.buffers[n] = NULL;
+
+        bp->set_size(slot.size);
+
+        if (!(dgms[num_dgms] = compose_datagram_(port, slot.address, *bp))) {
+            continue;
+        }
+
+        num_dgms++;
+    }
+
+    // Hand over the whole batch at once, so that the writer (e.g. datagram
+    // ring) synchronizes with its reader once per batch instead of once per
+    // datagram.
+    if (num_dgms != 0) {
+        port.writer->write_batch(dgms, num_dgms);
+    }
+
+    return (size_t)num_read;
+}
+
+#endif // ROC_TARGET_LINUX
+
+void UDPReceiver::write_datagram_(const Port& port,
+                                  const datagram::Address& sender,
+                                  core::IByteBuffer& buffer) {
+    if (datagram::IDatagramPtr dgm = compose_datagram_(port, sender, buffer)) {
+        port.writer->write(dgm);
+    }
+}
+
+datagram::IDatagramPtr UDPReceiver::compose_datagram_(const Port& port,
+                                                      const datagram::Address& sender,
+                                                      core::IByteBuffer& buffer) {
+    datagram::IDatagramPtr dgm = dgm_composer_.compose();
     if (!dgm) {
         roc_log(LOG_ERROR, "udp receiver: composer returned null");
-        return;
+        return NULL;
     }
 
-    dgm->set_receiver(port->address);
-    dgm->set_sender(sender_addr);
-    dgm->set_buffer(*bp);
+    dgm->set_receiver(port.address);
+    dgm->set_sender(sender);
+    dgm->set_buffer(buffer);
 
-    port->writer->write(dgm);
+    return dgm;
 }
 
 } // namespace netio
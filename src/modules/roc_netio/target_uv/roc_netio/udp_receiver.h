@@ -27,9 +27,38 @@
 #include "roc_netio/udp_datagram.h"
 #include "roc_netio/udp_composer.h"
 
+#ifdef ROC_TARGET_LINUX
+#include "roc_netio/udp_batch_socket.h"
+#endif
+
 namespace roc {
 namespace netio {
 
+//! UDP receiver port parameters.
+struct UDPReceiverConfig {
+    //! Maximum number of datagrams read by one system call.
+    //! @remarks
+    //!  If greater than one and the platform supports it, datagrams are
+    //!  read in batches using recvmmsg(). Otherwise they are read one by
+    //!  one using libuv. Every batch is passed to the datagram writer by a
+    //!  single write_batch() call. Should not exceed ROC_CONFIG_MAX_UDP_BATCH.
+    size_t batch_size;
+
+    //! Socket receive buffer size in bytes.
+    //! @remarks
+    //!  Zero means system default.
+    size_t socket_buffer_size;
+
+    //! Allow binding several sockets to the same address (SO_REUSEPORT).
+    bool reuse_port;
+
+    UDPReceiverConfig()
+        : batch_size(ROC_CONFIG_DEFAULT_UDP_BATCH)
+        , socket_buffer_size(0)
+        , reuse_port(false) {
+    }
+};
+
 //! UDP receiver.
 class UDPReceiver : public core::NonCopyable<> {
 public:
@@ -46,19 +75,37 @@ public:
     void detach(uv_loop_t&);
 
     //! Add receiving port.
-    bool add_port(const datagram::Address&, datagram::IDatagramWriter&);
+    bool add_port(const datagram::Address&,
+                  datagram::IDatagramWriter&,
+                  const UDPReceiverConfig& config = UDPReceiverConfig());
 
 private:
     enum { MaxPorts = ROC_CONFIG_MAX_PORTS };
 
+    // Maximum number of batches read per one poll event.
+    enum { MaxBatchesPerPoll = 8 };
+
     struct Port : core::NonCopyable<> {
         uv_udp_t handle;
 
+#ifdef ROC_TARGET_LINUX
+        uv_poll_t poll_handle;
+        UDPBatchSocket socket;
+
+        // Buffers composed in advance for the next recvmmsg() call.
+        core::IByteBufferPtr buffers[UDPBatchSocket::MaxBatch];
+        UDPBatchSlot slots[UDPBatchSocket::MaxBatch];
+#endif
+
+        UDPReceiverConfig config;
+        bool batched;
+
         datagram::Address address;
         datagram::IDatagramWriter* writer;
 
         Port()
-            : writer(NULL) {
+            : batched(false)
+            , writer(NULL) {
         }
     };
 
@@ -69,9 +116,25 @@ private:
                          const sockaddr* addr,
                          unsigned flags);
 
+#ifdef ROC_TARGET_LINUX
+    static void poll_cb_(uv_poll_t* handle, int status, int events);
+
+    bool open_batched_port_(Port& port);
+    void close_batched_port_(Port& port);
+    size_t read_batch_(Port& port);
+#endif
+
     bool open_port_(Port& port);
     void close_port_(Port& port);
 
+    void write_datagram_(const Port& port,
+                         const datagram::Address& sender,
+                         core::IByteBuffer& buffer);
+
+    datagram::IDatagramPtr compose_datagram_(const Port& port,
+                                             const datagram::Address& sender,
+                                             core::IByteBuffer& buffer);
+
     core::Array<Port, MaxPorts> ports_;
     uv_loop_t* loop_;
 
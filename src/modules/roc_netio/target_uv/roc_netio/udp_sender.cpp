@@ -10,6 +10,10 @@
 #include "roc_core/panic.h"
 #include "roc_core/log.h"
 
+#ifdef ROC_TARGET_LINUX
+#include "roc_core/errno_to_str.h"
+#endif
+
 #include "roc_datagram/address_to_str.h"
 
 #include "roc_netio/inet_address.h"
@@ -18,10 +22,18 @@
 namespace roc {
 namespace netio {
 
-UDPSender::UDPSender()
-    : loop_(NULL)
+UDPSender::UDPSender(size_t batch_size)
+    : last_port_(NULL)
+    , batch_size_(batch_size)
+    , num_sent_(0)
+    , num_syscalls_(0)
+    , loop_(NULL)
     , eof_(NULL)
     , number_(0) {
+    if (batch_size_ < 1 || batch_size_ > MaxBatch) {
+        roc_panic("udp sender: batch size should be in range [1; %ld] (got %ld)",
+                  (long)MaxBatch, (long)batch_size_);
+    }
 }
 
 UDPSender::~UDPSender() {
@@ -61,6 +73,9 @@ void UDPSender::detach(uv_loop_t& loop) {
 
     uv_close((uv_handle_t*)&async_, NULL);
 
+    roc_log(LOG_DEBUG, "udp sender: sent %lu datagrams using %lu system calls",
+            (unsigned long)num_sent_, (unsigned long)num_syscalls_);
+
     loop_ = NULL;
     eof_ = NULL;
 }
@@ -85,6 +100,7 @@ bool UDPSender::add_port(const datagram::Address& address) {
         roc_log(LOG_ERROR, "udp sender: can't add port %s",
                 datagram::address_to_str(address).c_str());
 
+        last_port_ = NULL;
         ports_.resize(ports_.size() - 1);
         return false;
     }
@@ -113,6 +129,19 @@ bool UDPSender::open_port_(Port& port) {
         return false;
     }
 
+#ifdef ROC_TARGET_LINUX
+    uv_os_fd_t fd;
+    if (int err = uv_fileno((uv_handle_t*)&port.handle, &fd)) {
+        roc_log(LOG_ERROR, "udp sender: uv_fileno(): [%s] %s", uv_err_name(err),
+                uv_strerror(err));
+        return false;
+    }
+
+    // Socket is owned by libuv handle and is used directly only when
+    // libuv send queue is empty.
+    port.socket.attach(fd);
+#endif
+
     return true;
 }
 
@@ -124,19 +153,36 @@ void UDPSender::close_port_(Port& port) {
     roc_log(LOG_TRACE, "udp sender: closing port %s",
             datagram::address_to_str(port.address).c_str());
 
+#ifdef ROC_TARGET_LINUX
+    port.socket.close();
+#endif
+
     uv_close((uv_handle_t*)&port.handle, NULL);
 }
 
 UDPSender::Port* UDPSender::find_port_(const datagram::Address& address) {
+    // Usually all datagrams are sent from the same address.
+    if (last_port_ && last_port_->address == address) {
+        return last_port_;
+    }
+
     for (size_t n = 0; n < ports_.size(); n++) {
         if (ports_[n].address == address) {
-            return &ports_[n];
+            return (last_port_ = &ports_[n]);
         }
     }
 
     return NULL;
 }
 
+size_t UDPSender::num_sent() const {
+    return num_sent_;
+}
+
+size_t UDPSender::num_syscalls() const {
+    return num_syscalls_;
+}
+
 void UDPSender::write(const datagram::IDatagramPtr& dgm) {
     if (dgm) {
         if (dgm->type() != UDPDatagram::Type) {
@@ -176,15 +222,22 @@ void UDPSender::write(const datagram::IDatagramPtr& dgm) {
     }
 }
 
-UDPDatagramPtr UDPSender::read_() {
+size_t UDPSender::read_batch_() {
     core::SpinMutex::Lock lock(mutex_);
 
-    UDPDatagramPtr dgm = list_.front();
-    if (dgm) {
+    size_t num_datagrams = 0;
+
+    while (num_datagrams < batch_size_) {
+        UDPDatagramPtr dgm = list_.front();
+        if (!dgm) {
+            break;
+        }
+
         list_.remove(*dgm);
+        batch_[num_datagrams++] = dgm;
     }
 
-    return dgm;
+    return num_datagrams;
 }
 
 void UDPSender::async_cb_(uv_async_t* handle) {
@@ -192,48 +245,143 @@ void UDPSender::async_cb_(uv_async_t* handle) {
 
     UDPSender& self = *(UDPSender*)handle->data;
 
-    while (UDPDatagramPtr dgm = self.read_()) {
-        const core::IByteBufferConstSlice& buffer = dgm->buffer();
+    while (size_t num_datagrams = self.read_batch_()) {
+        self.send_batch_(num_datagrams);
+    }
+
+    self.check_eof_();
+}
 
-        self.number_++;
+void UDPSender::send_batch_(size_t num_datagrams) {
+    size_t begin = 0;
 
-        roc_log(LOG_FLOOD, "udp sender: sending datagram:"
-                           " num=%u src=%s dst=%s sz=%ld",
-                self.number_,                                      //
-                datagram::address_to_str(dgm->sender()).c_str(),   //
-                datagram::address_to_str(dgm->receiver()).c_str(), //
-                (long)buffer.size());
+    while (begin < num_datagrams) {
+        const datagram::Address& sender = batch_[begin]->sender();
 
-        Port* port = self.find_port_(dgm->sender());
+        Port* port = find_port_(sender);
         if (!port) {
             roc_log(LOG_ERROR,
                     "udp sender: dropping datagram, no port added for sender address %s"
                     " (use Transceiver::add_udp_sender() to register sender address)",
-                    datagram::address_to_str(dgm->sender()).c_str());
+                    datagram::address_to_str(sender).c_str());
+
+            batch_[begin++] = NULL;
+            --pending_;
             continue;
         }
 
-        sockaddr_in inet_addr;
-        to_inet_address(dgm->receiver(), inet_addr);
-
-        uv_buf_t buf;
-        buf.base = (char*)const_cast<uint8_t*>(buffer.data());
-        buf.len = buffer.size();
+        // Find sequence of datagrams with the same sender port.
+        size_t end = begin + 1;
+        while (end < num_datagrams && batch_[end]->sender() == port->address) {
+            end++;
+        }
 
-        dgm->request().data = &self;
+        for (size_t n = begin + send_port_batch_(*port, begin, end); n < end; n++) {
+            if (!send_datagram_(*port, *batch_[n])) {
+                --pending_;
+            }
+        }
 
-        if (int err = uv_udp_send(&dgm->request(), &port->handle, &buf, 1,
-                                  (sockaddr*)&inet_addr, send_cb_)) {
-            roc_log(LOG_ERROR, "udp sender: uv_udp_send(): [%s] %s", uv_err_name(err),
-                    uv_strerror(err));
-            continue;
+        for (size_t n = begin; n < end; n++) {
+            batch_[n] = NULL;
         }
 
-        // Will be decremented in send_cb_().
-        dgm->incref();
+        begin = end;
     }
+}
 
-    self.check_eof_();
+size_t UDPSender::send_port_batch_(Port& port, size_t begin, size_t end) {
+#ifdef ROC_TARGET_LINUX
+    // Datagrams queued in libuv should go first.
+    if (batch_size_ == 1 || port.handle.send_queue_count != 0) {
+        return 0;
+    }
+
+    const size_t num_datagrams = end - begin;
+
+    for (size_t n = 0; n < num_datagrams; n++) {
+        const UDPDatagram& dgm = *batch_[begin + n];
+
+        slots_[n].data = const_cast<uint8_t*>(dgm.buffer().data());
+        slots_[n].size = dgm.buffer().size();
+        slots_[n].address = dgm.receiver();
+    }
+
+    const ssize_t ret = port.socket.send(slots_, num_datagrams);
+
+    num_syscalls_++;
+
+    if (ret < 0) {
+        // Let libuv retry and report errors for every datagram.
+        roc_log(LOG_TRACE, "udp sender: sendmmsg(): %s",
+                core::errno_to_str((int)-ret).c_str());
+        return 0;
+    }
+
+    // Datagrams that didn't fit into socket buffer will be queued
+    // in libuv until socket becomes writable.
+    for (size_t n = 0; n < (size_t)ret; n++) {
+        const UDPDatagram& dgm = *batch_[begin + n];
+
+        number_++;
+
+        roc_log(LOG_FLOOD, "udp sender: sent datagram:"
+                           " num=%u src=%s dst=%s sz=%ld",
+                number_,                                          //
+                datagram::address_to_str(dgm.sender()).c_str(),   //
+                datagram::address_to_str(dgm.receiver()).c_str(), //
+                (long)dgm.buffer().size());
+
+        --pending_;
+    }
+
+    num_sent_ += (size_t)ret;
+
+    return (size_t)ret;
+#else
+    (void)port;
+    (void)begin;
+    (void)end;
+
+    return 0;
+#endif
+}
+
+bool UDPSender::send_datagram_(Port& port, UDPDatagram& dgm) {
+    const core::IByteBufferConstSlice& buffer = dgm.buffer();
+
+    number_++;
+
+    roc_log(LOG_FLOOD, "udp sender: sending datagram:"
+                       " num=%u src=%s dst=%s sz=%ld",
+            number_,                                          //
+            datagram::address_to_str(dgm.sender()).c_str(),   //
+            datagram::address_to_str(dgm.receiver()).c_str(), //
+            (long)buffer.size());
+
+    sockaddr_in inet_addr;
+    to_inet_address(dgm.receiver(), inet_addr);
+
+    uv_buf_t buf;
+    buf.base = (char*)const_cast<uint8_t*>(buffer.data());
+    buf.len = buffer.size();
+
+    dgm.request().data = this;
+
+    if (int err = uv_udp_send(&dgm.request(), &port.handle, &buf, 1,
+                              (sockaddr*)&inet_addr, send_cb_)) {
+        roc_log(LOG_ERROR, "udp sender: uv_udp_send(): [%s] %s", uv_err_name(err),
+                uv_strerror(err));
+        return false;
+    }
+
+    // Will be decremented in send_cb_().
+    dgm.incref();
+
+    num_sent_++;
+    num_syscalls_++;
+
+    return true;
 }
 
 void UDPSender::send_cb_(uv_udp_send_t* req, int status) {
@@ -244,11 +392,11 @@ void UDPSender::send_cb_(uv_udp_send_t* req, int status) {
     // To preventr leak, capture smart pointer before returning.
     UDPDatagramPtr dgm = UDPDatagram::container_of(req);
 
-    // One reference for incref() called from async_cb_(),
+    // One reference for incref() called from send_datagram_(),
     // one more for local smart pointer.
     roc_panic_if(dgm->getref() < 2);
 
-    // Decrement reference counter incremented in async_cb_().
+    // Decrement reference counter incremented in send_datagram_().
     dgm->decref();
 
     if (status < 0) {
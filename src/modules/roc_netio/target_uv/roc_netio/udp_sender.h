@@ -28,6 +28,10 @@
 
 #include "roc_netio/udp_datagram.h"
 
+#ifdef ROC_TARGET_LINUX
+#include "roc_netio/udp_batch_socket.h"
+#endif
+
 namespace roc {
 namespace netio {
 
@@ -35,7 +39,10 @@ namespace netio {
 class UDPSender : public datagram::IDatagramWriter, public core::NonCopyable<> {
 public:
     //! Initialize.
-    UDPSender();
+    //! @remarks
+    //!  Pending datagrams are sent in batches of up to @p batch_size
+    //!  datagrams per system call, when supported by platform.
+    explicit UDPSender(size_t batch_size = ROC_CONFIG_MAX_UDP_BATCH);
 
     //! Destroy.
     ~UDPSender();
@@ -52,12 +59,23 @@ public:
     //! Write datagram.
     virtual void write(const datagram::IDatagramPtr&);
 
+    //! Get number of datagrams passed to system.
+    size_t num_sent() const;
+
+    //! Get number of system calls used to send datagrams.
+    size_t num_syscalls() const;
+
 private:
     enum { MaxPorts = ROC_CONFIG_MAX_PORTS };
+    enum { MaxBatch = ROC_CONFIG_MAX_UDP_BATCH };
 
     struct Port : core::NonCopyable<> {
         uv_udp_t handle;
         datagram::Address address;
+
+#ifdef ROC_TARGET_LINUX
+        UDPBatchSocket socket;
+#endif
     };
 
     static void async_cb_(uv_async_t* handle);
@@ -69,9 +87,23 @@ private:
 
     void check_eof_();
 
-    UDPDatagramPtr read_();
+    size_t read_batch_();
+    void send_batch_(size_t num_datagrams);
+    size_t send_port_batch_(Port& port, size_t begin, size_t end);
+    bool send_datagram_(Port& port, UDPDatagram& dgm);
 
     core::Array<Port, MaxPorts> ports_;
+    Port* last_port_;
+
+    const size_t batch_size_;
+    UDPDatagramPtr batch_[MaxBatch];
+
+#ifdef ROC_TARGET_LINUX
+    UDPBatchSlot slots_[MaxBatch];
+#endif
+
+    size_t num_sent_;
+    size_t num_syscalls_;
 
     uv_loop_t* loop_;
     uv_async_t async_;
@@ -19,6 +19,18 @@
 namespace roc {
 namespace packet {
 
+//! Sample format of audio packet payload.
+enum SampleFormat {
+    //! 16-bit signed integer PCM.
+    Sample_L16,
+
+    //! 24-bit signed integer PCM.
+    Sample_L24,
+
+    //! 32-bit IEEE float PCM.
+    Sample_Float32
+};
+
 //! Audio packet interface.
 class IAudioPacket : public packet::IPacket {
 public:
@@ -30,8 +42,16 @@ public:
     //! Get number of samples in packet.
     virtual size_t num_samples() const = 0;
 
-    //! Set channel mask, number of samples per channel and sample rate.
-    virtual void set_size(channel_mask_t ch_mask, size_t n_samples, size_t rate) = 0;
+    //! Get sample format of packet payload.
+    virtual SampleFormat sample_format() const = 0;
+
+    //! Set channel mask, number of samples per channel, sample rate and format.
+    //! @remarks
+    //!  Panics if there is no payload format for given parameters.
+    virtual void set_size(channel_mask_t ch_mask,
+                          size_t n_samples,
+                          size_t rate,
+                          SampleFormat format = Sample_L16) = 0;
 
     //! Read samples from packet.
     //!
@@ -18,11 +18,29 @@
 namespace roc {
 namespace packet {
 
+//! FEC scheme.
+enum FECScheme {
+    //! LDPC-Staircase codes (OpenFEC).
+    FEC_LDPC_Staircase,
+
+    //! Reed-Solomon codes over GF(2^8).
+    FEC_ReedSolomon8
+};
+
+//! Get FEC scheme name.
+const char* fec_scheme_to_str(FECScheme);
+
 //! FEC packet interface.
 class IFECPacket : public IPacket {
 public:
     virtual ~IFECPacket();
 
+    //! FEC scheme used to encode payload.
+    virtual FECScheme scheme() const = 0;
+
+    //! Set FEC scheme used to encode payload.
+    virtual void set_scheme(FECScheme) = 0;
+
     //! Seqnum of first data packet in block.
     virtual seqnum_t data_blknum() const = 0;
 
@@ -35,6 +53,22 @@ public:
     //! Set seqnum of first FEC packet in block.
     virtual void set_fec_blknum(seqnum_t) = 0;
 
+    //! Number of data packets in block.
+    //! @remarks
+    //!  Returns zero if packet doesn't carry block geometry.
+    virtual size_t data_blksz() const = 0;
+
+    //! Set number of data packets in block.
+    virtual void set_data_blksz(size_t) = 0;
+
+    //! Number of FEC packets in block.
+    //! @remarks
+    //!  Returns zero if packet doesn't carry block geometry.
+    virtual size_t fec_blksz() const = 0;
+
+    //! Set number of FEC packets in block.
+    virtual void set_fec_blksz(size_t) = 0;
+
     //! Get payload.
     //! @remarks
     //!  Contains encoded symbols.
@@ -47,6 +81,13 @@ public:
     //!  Copy @p size bytes from @p data of payload to packet's buffer.
     virtual void set_payload(const uint8_t* data, size_t size) = 0;
 
+    //! Set payload size and get writable payload.
+    //! @remarks
+    //!  Allows to encode symbols directly into packet's buffer instead of
+    //!  copying them with set_payload(). Payload contents is unspecified
+    //!  until written by caller.
+    virtual core::IByteBufferSlice alloc_payload(size_t size) = 0;
+
     //! FEC packet type.
     static const PacketType Type;
 
@@ -35,6 +35,19 @@ public:
     virtual IPacketConstPtr read() = 0;
 };
 
+//! Read next packet from reader of statically known type.
+//! @remarks
+//!  If @p Reader is a concrete reader class, its read() is called directly
+//!  rather than through vtable, so that it can be inlined into caller.
+template <class Reader> inline IPacketConstPtr read_packet(Reader& reader) {
+    return reader.Reader::read();
+}
+
+//! Read next packet from reader of unknown type.
+template <> inline IPacketConstPtr read_packet(IPacketReader& reader) {
+    return reader.read();
+}
+
 } // namespace packet
 } // namespace roc
 
@@ -0,0 +1,118 @@
+/*
+ * Copyright (c) 2015 Mikhail Baranov
+ * Copyright (c) 2015 Victor Gaydov
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "roc_core/panic.h"
+#include "roc_core/helpers.h"
+#include "roc_core/math.h"
+
+#include "roc_packet/jitter_meter.h"
+
+#define SEQ_IS_BEFORE(a, b) ROC_IS_BEFORE(signed_seqnum_t, a, b)
+#define TS_SUBTRACT(a, b) ROC_SUBTRACT(signed_timestamp_t, a, b)
+
+namespace roc {
+namespace packet {
+
+namespace {
+
+// Jitter estimator gain, as suggested by RFC 3550.
+const float G_jitter_gain = 1.0f / 16;
+
+} // namespace
+
+JitterMeter::JitterMeter(IPacketConstWriter& writer, size_t tick_samples)
+    : writer_(writer)
+    , tick_samples_((timestamp_t)tick_samples)
+    , clock_(0)
+    , has_packets_(false)
+    , prev_transit_(0)
+    , jitter_(0)
+    , packet_samples_(0)
+    , base_seqnum_(0)
+    , max_seqnum_(0)
+    , seqnum_cycles_(0)
+    , num_received_(0) {
+}
+
+bool JitterMeter::update() {
+    clock_ += tick_samples_;
+    return true;
+}
+
+void JitterMeter::write(const IPacketConstPtr& packet) {
+    if (!packet) {
+        roc_panic("jitter meter: attempting to write null packet");
+    }
+
+    if (packet->type() != IAudioPacket::Type) {
+        roc_panic("jitter meter: got packet of wrong type (expected audio packet)");
+    }
+
+    const IAudioPacket& ap = static_cast<const IAudioPacket&>(*packet);
+
+    // Transit time is arrival time minus RTP timestamp. It contains unknown
+    // constant offset, but only differences between consecutive transit
+    // times are used.
+    const timestamp_t transit = clock_ - ap.timestamp();
+
+    const seqnum_t seqnum = ap.seqnum();
+
+    if (has_packets_) {
+        const signed_timestamp_t dist = TS_SUBTRACT(transit, prev_transit_);
+
+        jitter_ += ((float)ROC_ABS(dist) - jitter_) * G_jitter_gain;
+
+        if (SEQ_IS_BEFORE(max_seqnum_, seqnum)) {
+            if (seqnum < max_seqnum_) {
+                seqnum_cycles_++;
+            }
+            max_seqnum_ = seqnum;
+        }
+    } else {
+        base_seqnum_ = seqnum;
+        max_seqnum_ = seqnum;
+        has_packets_ = true;
+    }
+
+    prev_transit_ = transit;
+    packet_samples_ = (timestamp_t)ap.num_samples();
+    num_received_++;
+
+    writer_.write(packet);
+}
+
+float JitterMeter::jitter() const {
+    return jitter_;
+}
+
+timestamp_t JitterMeter::packet_samples() const {
+    return packet_samples_;
+}
+
+size_t JitterMeter::num_received() const {
+    return num_received_;
+}
+
+size_t JitterMeter::num_lost() const {
+    if (!has_packets_) {
+        return 0;
+    }
+
+    const size_t num_expected = (seqnum_cycles_ << 16) + (size_t)max_seqnum_ + 1
+        - (size_t)base_seqnum_;
+
+    if (num_expected < num_received_) {
+        return 0;
+    }
+
+    return num_expected - num_received_;
+}
+
+} // namespace packet
+} // namespace roc
@@ -0,0 +1,94 @@
+/*
+ * Copyright (c) 2015 Mikhail Baranov
+ * Copyright (c) 2015 Victor Gaydov
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+//! @file roc_packet/jitter_meter.h
+//! @brief Jitter meter.
+
+#ifndef ROC_PACKET_JITTER_METER_H_
+#define ROC_PACKET_JITTER_METER_H_
+
+#include "roc_core/noncopyable.h"
+
+#include "roc_packet/ipacket_writer.h"
+#include "roc_packet/iaudio_packet.h"
+#include "roc_packet/imonitor.h"
+#include "roc_packet/units.h"
+
+namespace roc {
+namespace packet {
+
+//! Jitter meter.
+//!
+//! Passes audio packets to output writer and estimates network conditions
+//! from their arrival times:
+//!  - interarrival jitter, as defined in RFC 3550;
+//!  - number of lost packets, from gaps in seqnums.
+//!
+//! Arrival time is measured in samples by local clock, which is advanced
+//! by update() once per tick.
+class JitterMeter : public IMonitor,
+                    public IPacketConstWriter,
+                    public core::NonCopyable<> {
+public:
+    //! Initialize.
+    //!
+    //! @b Parameters
+    //!  - @p writer is output packet writer; packets passed to write()
+    //!    are written to @p writer;
+    //!  - @p tick_samples is number of samples per renderer tick.
+    JitterMeter(IPacketConstWriter& writer, size_t tick_samples);
+
+    //! Advance arrival clock by one tick.
+    //! @returns
+    //!  always true.
+    virtual bool update();
+
+    //! Write packet.
+    //! @remarks
+    //!  Updates statistics and writes packet to output writer.
+    virtual void write(const IPacketConstPtr&);
+
+    //! Get interarrival jitter as number of samples.
+    float jitter() const;
+
+    //! Get number of samples in last received packet.
+    timestamp_t packet_samples() const;
+
+    //! Get number of received packets.
+    size_t num_received() const;
+
+    //! Get number of lost packets.
+    //! @remarks
+    //!  Computed as difference between number of packets expected from
+    //!  seqnums range and number of packets received.
+    size_t num_lost() const;
+
+private:
+    IPacketConstWriter& writer_;
+
+    const timestamp_t tick_samples_;
+    timestamp_t clock_;
+
+    bool has_packets_;
+
+    timestamp_t prev_transit_;
+    float jitter_;
+
+    timestamp_t packet_samples_;
+
+    seqnum_t base_seqnum_;
+    seqnum_t max_seqnum_;
+    size_t seqnum_cycles_;
+    size_t num_received_;
+};
+
+} // namespace packet
+} // namespace roc
+
+#endif // ROC_PACKET_JITTER_METER_H_
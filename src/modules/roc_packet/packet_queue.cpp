@@ -7,9 +7,13 @@
  * file, You can obtain one at http://mozilla.org/MPL/2.0/.
  */
 
+#include "roc_config/config.h"
+
+#include "roc_core/stddefs.h"
 #include "roc_core/panic.h"
 #include "roc_core/log.h"
 #include "roc_core/helpers.h"
+#include "roc_core/math.h"
 
 #include "roc_packet/packet_queue.h"
 
@@ -19,16 +23,39 @@ namespace roc {
 namespace packet {
 
 PacketQueue::PacketQueue(size_t max_size)
-    : max_size_(max_size) {
+    : slots_(NULL)
+    , capacity_(0)
+    , head_(0)
+    , tail_(0)
+    , size_(0)
+    , max_size_(max_size) {
+    if (!reserve_(max_size_ != 0 ? max_span_() : (size_t)MinCapacity)) {
+        roc_panic("packet queue: can't allocate slots");
+    }
+}
+
+PacketQueue::~PacketQueue() {
+    delete[] slots_;
 }
 
 IPacketConstPtr PacketQueue::read() {
-    if (IPacketConstPtr packet = list_.back()) {
-        list_.remove(*packet);
-        return packet;
+    if (size_ == 0) {
+        return NULL;
     }
 
-    return NULL;
+    IPacketConstPtr& head_slot = slot_(head_);
+
+    IPacketConstPtr packet = head_slot;
+    head_slot = NULL;
+
+    if (--size_ != 0) {
+        // Skip seqnums of missing packets.
+        do {
+            head_++;
+        } while (!slot_(head_));
+    }
+
+    return packet;
 }
 
 void PacketQueue::write(const IPacketConstPtr& packet) {
@@ -36,47 +63,109 @@ void PacketQueue::write(const IPacketConstPtr& packet) {
         roc_panic("packet queue: attempting to add null packet");
     }
 
-    if (max_size_ > 0 && list_.size() == max_size_) {
+    if (max_size_ > 0 && size_ == max_size_) {
         roc_log(LOG_TRACE, "packet queue: queue is full, dropping packet:"
                            " max_size=%u",
                 (unsigned)max_size_);
         return;
     }
 
-    IPacketConstPtr before = list_.front();
+    const seqnum_t sn = packet->seqnum();
 
-    for (; before; before = list_.next(*before)) {
-        if (SEQ_IS_BEFORE(packet->seqnum(), before->seqnum())) {
-            continue;
+    if (size_ == 0) {
+        head_ = tail_ = sn;
+    } else if (SEQ_IS_BEFORE(sn, head_)) {
+        if (!reserve_(size_t(seqnum_t(tail_ - sn)) + 1)) {
+            return;
         }
-
-        if (packet->seqnum() == before->seqnum()) {
-            roc_log(LOG_TRACE, "packet queue: dropping duplicate packet:"
-                               " pkt_seqnum=%u",
-                    (unsigned)packet->seqnum());
+        head_ = sn;
+    } else if (SEQ_IS_BEFORE(tail_, sn)) {
+        if (!reserve_(size_t(seqnum_t(sn - head_)) + 1)) {
             return;
         }
-
-        break;
+        tail_ = sn;
+    } else if (slot_(sn)) {
+        roc_log(LOG_TRACE, "packet queue: dropping duplicate packet:"
+                           " pkt_seqnum=%u",
+                (unsigned)sn);
+        return;
     }
 
-    if (before) {
-        list_.insert(*packet, &*before);
-    } else {
-        list_.append(*packet);
-    }
+    slot_(sn) = packet;
+    size_++;
 }
 
 size_t PacketQueue::size() const {
-    return list_.size();
+    return size_;
 }
 
 IPacketConstPtr PacketQueue::head() const {
-    return list_.back();
+    if (size_ == 0) {
+        return NULL;
+    }
+    return slot_(head_);
 }
 
 IPacketConstPtr PacketQueue::tail() const {
-    return list_.front();
+    if (size_ == 0) {
+        return NULL;
+    }
+    return slot_(tail_);
+}
+
+IPacketConstPtr& PacketQueue::slot_(seqnum_t sn) const {
+    return slots_[sn & (capacity_ - 1)];
+}
+
+size_t PacketQueue::max_span_() const {
+    if (max_size_ == 0) {
+        return MaxCapacity;
+    }
+    return ROC_MIN(max_size_ + ROC_CONFIG_MAX_SN_JUMP, (size_t)MaxCapacity);
+}
+
+bool PacketQueue::reserve_(size_t span) {
+    if (span > max_span_()) {
+        roc_log(LOG_TRACE, "packet queue: dropping packet, seqnum span is too large:"
+                           " span=%lu max=%lu",
+                (unsigned long)span, (unsigned long)max_span_());
+        return false;
+    }
+
+    if (span <= capacity_) {
+        return true;
+    }
+
+    size_t new_capacity = capacity_ ? capacity_ : 1;
+    while (new_capacity < span) {
+        new_capacity *= 2;
+    }
+
+    roc_log(LOG_TRACE, "packet queue: reallocating slots: old_capacity=%lu new_capacity=%lu",
+            (unsigned long)capacity_, (unsigned long)new_capacity);
+
+    IPacketConstPtr* new_slots = new (std::nothrow) IPacketConstPtr[new_capacity];
+    if (!new_slots) {
+        roc_log(LOG_ERROR, "packet queue: can't allocate %lu slots",
+                (unsigned long)new_capacity);
+        return false;
+    }
+
+    if (size_ != 0) {
+        for (seqnum_t sn = head_;; sn++) {
+            new_slots[sn & (new_capacity - 1)] = slot_(sn);
+            if (sn == tail_) {
+                break;
+            }
+        }
+    }
+
+    delete[] slots_;
+
+    slots_ = new_slots;
+    capacity_ = new_capacity;
+
+    return true;
 }
 
 } // namespace packet
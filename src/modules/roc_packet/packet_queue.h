@@ -14,7 +14,6 @@
 #define ROC_PACKET_PACKET_QUEUE_H_
 
 #include "roc_core/noncopyable.h"
-#include "roc_core/list.h"
 
 #include "roc_packet/ipacket.h"
 #include "roc_packet/ipacket_reader.h"
@@ -24,6 +23,15 @@ namespace roc {
 namespace packet {
 
 //! Sorted packet queue.
+//!
+//! Packets are stored in a ring indexed by seqnum, so write(), read(),
+//! head() and tail() take constant time, regardless of packet order.
+//!
+//! If queue size is limited, seqnum span of queued packets is limited by
+//! maximum queue size plus ROC_CONFIG_MAX_SN_JUMP, and packets exceeding
+//! the limit are dropped; the ring is allocated once in constructor.
+//! Otherwise, the ring is reallocated when span exceeds its capacity.
+//!
 //! @note
 //!  To handle seqnum overflow, ROC_IS_BEFORE() macro is used to compare seqnums.
 class PacketQueue : public IPacketReader,
@@ -36,6 +44,8 @@ public:
     //!  packets in queue.
     PacketQueue(size_t max_size = 0);
 
+    ~PacketQueue();
+
     //! Read next packet.
     //! @returns
     //!  packet with minimum seqnum or NULL if there are no packets.
@@ -70,7 +80,23 @@ public:
     IPacketConstPtr tail() const;
 
 private:
-    core::List<const IPacket> list_;
+    // Initial capacity for unlimited queue.
+    enum { MinCapacity = 64 };
+
+    // Maximum capacity; larger seqnum distances can't be ordered.
+    enum { MaxCapacity = 1 << (sizeof(seqnum_t) * 8 - 1) };
+
+    IPacketConstPtr& slot_(seqnum_t sn) const;
+    size_t max_span_() const;
+    bool reserve_(size_t span);
+
+    IPacketConstPtr* slots_;
+    size_t capacity_;
+
+    seqnum_t head_;
+    seqnum_t tail_;
+
+    size_t size_;
     const size_t max_size_;
 };
 
@@ -47,6 +47,34 @@ bool PacketRouter::may_autodetect_route(const IPacketConstPtr& packet) const {
     return detect_route_(packet) != NULL;
 }
 
+size_t PacketRouter::num_sources() const {
+    size_t n_sources = 0;
+
+    for (size_t n = 0; n < routes_.size(); n++) {
+        if (routes_[n].has_source) {
+            n_sources++;
+        }
+    }
+
+    return n_sources;
+}
+
+source_t PacketRouter::source(size_t index) const {
+    for (size_t n = 0; n < routes_.size(); n++) {
+        if (!routes_[n].has_source) {
+            continue;
+        }
+
+        if (index-- == 0) {
+            return routes_[n].source;
+        }
+    }
+
+    roc_panic("packet router: source index out of range");
+
+    return 0;
+}
+
 void PacketRouter::write(const IPacketConstPtr& packet) {
     if (!packet) {
         roc_panic("packet router: attempting to write null packet");
@@ -44,6 +44,14 @@ public:
     //!  packet type.
     bool may_autodetect_route(const IPacketConstPtr&) const;
 
+    //! Get number of routes with source ID already detected.
+    size_t num_sources() const;
+
+    //! Get source ID of route with source ID already detected.
+    //! @pre
+    //!  @p index should be less than num_sources().
+    source_t source(size_t index) const;
+
     //! Write packet.
     //! @remarks
     //!  If route found for packet's source id, packet is sent to corresponding
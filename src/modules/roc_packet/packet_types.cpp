@@ -30,6 +30,16 @@ IAudioPacket::~IAudioPacket() {
 void IAudioPacket::print(bool body) const {
     print_packet(*this, body);
 }
+const char* fec_scheme_to_str(FECScheme scheme) {
+    switch (scheme) {
+    case FEC_LDPC_Staircase:
+        return "ldpc";
+    case FEC_ReedSolomon8:
+        return "rs8";
+    }
+    return "unknown";
+}
+
 const PacketType IFECPacket::Type = &IFECPacketType;
 
 IFECPacket::~IFECPacket() {
@@ -52,10 +52,12 @@ void print_packet(const IFECPacket& p, bool body) {
 
     core::IByteBufferConstSlice payload = p.payload();
 
-    fprintf(
-        stderr, "packet(fec): src=%lu m=%d, sn=%u, data_blk=%u, fec_blk=%u, payload=%u\n",
-        (unsigned long)p.source(), (int)p.marker(), (unsigned)p.seqnum(),
-        (unsigned)p.data_blknum(), (unsigned)p.fec_blknum(), (unsigned)payload.size());
+    fprintf(stderr, "packet(fec): src=%lu m=%d, sn=%u, scheme=%s,"
+                    " data_blk=%u, fec_blk=%u, data_blksz=%u, fec_blksz=%u, payload=%u\n",
+            (unsigned long)p.source(), (int)p.marker(), (unsigned)p.seqnum(),
+            fec_scheme_to_str(p.scheme()),
+            (unsigned)p.data_blknum(), (unsigned)p.fec_blknum(),
+            (unsigned)p.data_blksz(), (unsigned)p.fec_blksz(), (unsigned)payload.size());
 
     if (!body) {
         return;
@@ -46,7 +46,9 @@ typedef float sample_t;
 static inline size_t num_channels(channel_mask_t ch_mask) {
     size_t n_ch = 0;
     for (; ch_mask != 0; ch_mask >>= 1) {
-        n_ch++;
+        if (ch_mask & 1) {
+            n_ch++;
+        }
     }
     return n_ch;
 }
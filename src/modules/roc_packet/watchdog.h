@@ -15,6 +15,9 @@
 
 #include "roc_config/config.h"
 #include "roc_core/noncopyable.h"
+#include "roc_core/helpers.h"
+#include "roc_core/log.h"
+#include "roc_core/math.h"
 
 #include "roc_packet/ipacket_reader.h"
 #include "roc_packet/iaudio_packet.h"
@@ -28,7 +31,11 @@ namespace packet {
 //! Triggers undesirable stream state and terminates rendering:
 //!  - if there are no new packets during long period;
 //!  - if long timestamp or seqnum jump occured.
-class Watchdog : public IMonitor, public IPacketReader, public core::NonCopyable<> {
+//!
+//! @tparam Reader defines type of input packet reader; if it's a concrete
+//!  reader class, reading from it is not virtual and may be inlined.
+template <class Reader>
+class BasicWatchdog : public IMonitor, public IPacketReader, public core::NonCopyable<> {
 public:
     //! Initialize.
     //!
@@ -39,24 +46,111 @@ public:
     //!    without new packets before renderer termination;
     //!  - @p rate is allowed rate for input packets; packets with
     //!    other rate are dropped.
-    Watchdog(IPacketReader& reader,
-             size_t timeout = ROC_CONFIG_DEFAULT_SESSION_TIMEOUT,
-             size_t rate = ROC_CONFIG_DEFAULT_SAMPLE_RATE);
+    BasicWatchdog(Reader& reader,
+                  size_t timeout = ROC_CONFIG_DEFAULT_SESSION_TIMEOUT,
+                  size_t rate = ROC_CONFIG_DEFAULT_SAMPLE_RATE)
+        : reader_(reader)
+        , rate_(rate)
+        , timeout_(timeout)
+        , countdown_(timeout)
+        , has_packets_(false)
+        , alive_(true) {
+    }
 
     //! Update stream.
     //! @returns
     //!  false if stream is broken and rendering should terminate.
-    virtual bool update();
+    virtual bool update() {
+        if (!alive_) {
+            return false;
+        }
+
+        if (has_packets_) {
+            countdown_ = timeout_;
+        } else {
+            if (countdown_ > 0) {
+                countdown_--;
+            }
+            if (countdown_ == 0) {
+                roc_log(LOG_DEBUG, "watchdog: timeout reached (%u ticks without packets)",
+                        (unsigned)timeout_);
+                return (alive_ = false);
+            }
+        }
+
+        has_packets_ = false;
+        return true;
+    }
 
     //! Read next packet.
     //! @remarks
     //!  updates stream state and returns next packet from input reader.
-    virtual IPacketConstPtr read();
+    virtual IPacketConstPtr read() {
+        if (!alive_) {
+            return NULL;
+        }
+
+        IPacketConstPtr packet = read_packet(reader_);
+        if (!packet) {
+            return NULL;
+        }
+
+        if (packet->rate() != rate_) {
+            roc_log(LOG_DEBUG, "watchdog: unexpected rate: got=%u expected=%u",
+                    (unsigned)packet->rate(), (unsigned)rate_);
+            return NULL;
+        }
+
+        if (detect_jump_(packet)) {
+            alive_ = false;
+            return NULL;
+        }
+
+        has_packets_ = true;
+
+        return packet;
+    }
 
 private:
-    bool detect_jump_(const IPacketConstPtr&);
+    bool detect_jump_(const IPacketConstPtr& next) {
+        if (prev_) {
+            if (prev_->source() != next->source()) {
+                roc_log(LOG_DEBUG, "watchdog: source id jump: prev=%lu next=%lu",
+                        (unsigned long)prev_->source(), (unsigned long)next->source());
+                return true;
+            }
 
-    IPacketReader& reader_;
+            signed_seqnum_t sn_dist =
+                ROC_SUBTRACT(signed_seqnum_t, prev_->seqnum(), next->seqnum());
+
+            if (ROC_ABS(sn_dist) > ROC_CONFIG_MAX_SN_JUMP) {
+                roc_log(LOG_DEBUG, "watchdog: too long seqnum jump:"
+                                   " prev=%lu next=%lu dist=%ld",
+                        (unsigned long)prev_->seqnum(), (unsigned long)next->seqnum(),
+                        (long)sn_dist);
+                return true;
+            }
+
+            signed_timestamp_t ts_dist =
+                ROC_SUBTRACT(signed_timestamp_t, prev_->timestamp(), next->timestamp());
+
+            if (ROC_ABS(ts_dist) > ROC_CONFIG_MAX_TS_JUMP) {
+                roc_log(LOG_DEBUG, "watchdog: too long timestamp jump:"
+                                   " prev=%lu next=%lu dist=%ld",
+                        (unsigned long)prev_->timestamp(),
+                        (unsigned long)next->timestamp(), (long)ts_dist);
+                return true;
+            }
+        }
+
+        if (!prev_ || ROC_IS_BEFORE(signed_seqnum_t, prev_->seqnum(), next->seqnum())) {
+            prev_ = next;
+        }
+
+        return false;
+    }
+
+    Reader& reader_;
     IPacketConstPtr prev_;
 
     const size_t rate_;
@@ -67,6 +161,9 @@ private:
     bool alive_;
 };
 
+//! Watchdog reading from any packet reader.
+typedef BasicWatchdog<IPacketReader> Watchdog;
+
 } // namespace packet
 } // namespace roc
 
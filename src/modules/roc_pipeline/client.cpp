@@ -80,7 +80,7 @@ audio::ISampleBufferWriter* Client::make_audio_writer_() {
 
     audio::ISampleBufferWriter* audio_writer = new (splitter_)
         audio::Splitter(*packet_writer, packet_composer_, config_.samples_per_packet,
-                        config_.channels, config_.sample_rate);
+                        config_.channels, config_.sample_rate, config_.sample_format);
 
     if (config_.options & EnableTiming) {
         audio_writer = new (timed_writer_)
@@ -111,19 +111,36 @@ packet::IPacketWriter* Client::make_packet_writer_() {
     return packet_writer;
 }
 
-#ifdef ROC_TARGET_OPENFEC
 packet::IPacketWriter* Client::make_fec_encoder_(packet::IPacketWriter* packet_writer) {
-    new (fec_ldpc_encoder_) fec::LDPC_BlockEncoder(*config_.byte_buffer_composer);
+    fec::IBlockEncoder* block_encoder = NULL;
 
-    return new (fec_encoder_)
-        fec::Encoder(*fec_ldpc_encoder_, *packet_writer, packet_composer_);
-}
+    switch (config_.fec_scheme) {
+    case packet::FEC_ReedSolomon8:
+        block_encoder = new (fec_rs_encoder_)
+            fec::RS_BlockEncoder(*config_.byte_buffer_composer,
+                                 config_.fec_block_data_packets,
+                                 config_.fec_block_redundant_packets);
+        break;
+
+    case packet::FEC_LDPC_Staircase:
+#ifdef ROC_TARGET_OPENFEC
+        block_encoder = new (fec_ldpc_encoder_)
+            fec::LDPC_BlockEncoder(*config_.byte_buffer_composer,
+                                   config_.fec_block_data_packets,
+                                   config_.fec_block_redundant_packets);
 #else
-packet::IPacketWriter* Client::make_fec_encoder_(packet::IPacketWriter* packet_writer) {
-    roc_log(LOG_ERROR, "client: OpenFEC support not enabled, disabling fec encoder");
-    return packet_writer;
-}
+        roc_log(LOG_ERROR, "client: OpenFEC support not enabled, disabling fec encoder");
 #endif
+        break;
+    }
+
+    if (!block_encoder) {
+        return packet_writer;
+    }
+
+    return new (fec_encoder_)
+        fec::Encoder(*block_encoder, *packet_writer, packet_composer_);
+}
 
 } // namespace pipeline
 } // namespace roc
@@ -26,6 +26,7 @@
 #include "roc_packet/interleaver.h"
 
 #include "roc_fec/encoder.h"
+#include "roc_fec/rs_block_encoder.h"
 
 #ifdef ROC_TARGET_OPENFEC
 #include "roc_fec/ldpc_block_encoder.h"
@@ -124,8 +125,9 @@ private:
 
 #ifdef ROC_TARGET_OPENFEC
     core::Maybe<fec::LDPC_BlockEncoder> fec_ldpc_encoder_;
-    core::Maybe<fec::Encoder> fec_encoder_;
 #endif
+    core::Maybe<fec::RS_BlockEncoder> fec_rs_encoder_;
+    core::Maybe<fec::Encoder> fec_encoder_;
 
     core::Maybe<audio::Splitter> splitter_;
     core::Maybe<audio::TimedWriter> timed_writer_;
@@ -15,9 +15,10 @@
 
 #include "roc_config/config.h"
 #include "roc_core/ipool.h"
-#include "roc_core/heap_pool.h"
 #include "roc_datagram/default_buffer_composer.h"
 #include "roc_packet/units.h"
+#include "roc_packet/ifec_packet.h"
+#include "roc_packet/iaudio_packet.h"
 #include "roc_audio/sample_buffer.h"
 #include "roc_pipeline/session.h"
 
@@ -29,7 +30,7 @@ enum Options {
     //! Use scaler and resamplers (server).
     EnableResampling = (1 << 0),
 
-    //! Use LDPC FEC encoder/decoder (server, client).
+    //! Use FEC encoder/decoder (server, client).
     EnableFEC = (1 << 1),
 
     //! Use interleaver (client).
@@ -42,7 +43,32 @@ enum Options {
     EnableBeep = (1 << 4),
 
     //! Terminate server when first client disconects (server).
-    EnableOneshot = (1 << 5)
+    EnableOneshot = (1 << 5),
+
+    //! Clamp mixed samples to [-1; 1] (server).
+    EnableClipping = (1 << 6),
+
+    //! Adjust session latency to measured jitter and losses (server).
+    //! Requires EnableResampling.
+    EnableLatencyTuning = (1 << 7),
+
+    //! Start playback after fast_start_latency and grow latency afterwards
+    //! by slowing down resampler (server). Requires EnableResampling.
+    EnableFastStart = (1 << 8),
+
+    //! Use session pipeline composed at compile time for enabled options,
+    //! so that packets are passed between stages without virtual calls
+    //! (server).
+    EnableStaticPipeline = (1 << 9)
+};
+
+//! Resampler type (server).
+enum ResamplerType {
+    //! Interpolate sinc taps for exact position of every output sample.
+    ResamplerSinc,
+
+    //! Use precomputed polyphase filter bank.
+    ResamplerPolyphase
 };
 
 //! Server config.
@@ -54,14 +80,22 @@ struct ServerConfig {
         , sample_rate(ROC_CONFIG_DEFAULT_SAMPLE_RATE)
         , samples_per_tick(ROC_CONFIG_DEFAULT_SERVER_TICK_SAMPLES)
         , samples_per_resampler_frame(ROC_CONFIG_DEFAULT_RESAMPLER_FRAME_SAMPLES)
+        , resampler_type(ResamplerSinc)
+        , resampler_phases(ROC_CONFIG_DEFAULT_RESAMPLER_PHASES)
         , output_latency(ROC_CONFIG_DEFAULT_OUTPUT_LATENCY)
         , session_latency(ROC_CONFIG_DEFAULT_SESSION_LATENCY)
+        , min_session_latency(ROC_CONFIG_DEFAULT_MIN_SESSION_LATENCY)
+        , max_session_latency(ROC_CONFIG_DEFAULT_MAX_SESSION_LATENCY)
+        , fast_start_latency(ROC_CONFIG_DEFAULT_FAST_START_LATENCY)
         , session_timeout(ROC_CONFIG_DEFAULT_SESSION_TIMEOUT)
-        , max_sessions(ROC_CONFIG_MAX_SESSIONS)
+        , max_sessions(ROC_CONFIG_DEFAULT_MAX_SESSIONS)
         , max_session_packets(ROC_CONFIG_MAX_SESSION_PACKETS)
+        , fec_block_data_packets(ROC_CONFIG_DEFAULT_FEC_BLOCK_DATA_PACKETS)
+        , fec_block_redundant_packets(ROC_CONFIG_DEFAULT_FEC_BLOCK_REDUNDANT_PACKETS)
+        , num_workers(0)
         , byte_buffer_composer(&datagram::default_buffer_composer())
         , sample_buffer_composer(&audio::default_buffer_composer())
-        , session_pool(&core::HeapPool<Session>::instance()) {
+        , session_pool(NULL) {
     }
 
     //! Bitmask of enabled session options.
@@ -79,21 +113,68 @@ struct ServerConfig {
     //! Number of samples per resampler frame.
     size_t samples_per_resampler_frame;
 
+    //! Resampler type.
+    ResamplerType resampler_type;
+
+    //! Number of phases in polyphase filter bank.
+    //! @remarks
+    //!  Used only if resampler_type is ResamplerPolyphase.
+    size_t resampler_phases;
+
     //! Output latency as number of samples.
     size_t output_latency;
 
     //! Session latency as number of samples.
+    //! @remarks
+    //!  If EnableLatencyTuning is set, this is initial latency, which is
+    //!  then adjusted within [min_session_latency; max_session_latency].
     size_t session_latency;
 
+    //! Minimum session latency as number of samples.
+    //! @remarks
+    //!  Used only if EnableLatencyTuning is set.
+    size_t min_session_latency;
+
+    //! Maximum session latency as number of samples.
+    //! @remarks
+    //!  Used only if EnableLatencyTuning is set.
+    size_t max_session_latency;
+
+    //! Session latency at which playback starts as number of samples.
+    //! @remarks
+    //!  Used only if EnableFastStart is set. Should not exceed session_latency.
+    size_t fast_start_latency;
+
     //! Timeout after which session is terminated as number of samples.
     size_t session_timeout;
 
     //! Maximum number of active sessions.
+    //! @remarks
+    //!  Should not exceed ROC_CONFIG_MAX_SESSIONS.
     size_t max_sessions;
 
     //! Maximum number of queued packets per session.
     size_t max_session_packets;
 
+    //! Expected number of data packets in FEC block.
+    //! @remarks
+    //!  Actual block geometry is taken from received FEC packets; this one is
+    //!  used until first FEC packet arrives. Should not exceed
+    //!  ROC_CONFIG_MAX_FEC_BLOCK_DATA_PACKETS.
+    size_t fec_block_data_packets;
+
+    //! Expected number of FEC packets in FEC block.
+    //! @remarks
+    //!  Should not exceed ROC_CONFIG_MAX_FEC_BLOCK_REDUNDANT_PACKETS.
+    size_t fec_block_redundant_packets;
+
+    //! Number of worker threads rendering sessions in parallel.
+    //! @remarks
+    //!  Workers are used in addition to server thread. If zero, sessions
+    //!  are rendered one by one on server thread. Output doesn't depend
+    //!  on this parameter. Should not exceed ROC_CONFIG_MAX_SERVER_WORKERS.
+    size_t num_workers;
+
     //! Composer for byte buffers.
     core::IByteBufferComposer* byte_buffer_composer;
 
@@ -101,6 +182,8 @@ struct ServerConfig {
     audio::ISampleBufferComposer* sample_buffer_composer;
 
     //! Session pool.
+    //! @remarks
+    //!  If NULL, server preallocates its own pool for max_sessions sessions.
     core::IPool<Session>* session_pool;
 };
 
@@ -112,9 +195,13 @@ struct ClientConfig {
         , channels(ROC_CONFIG_DEFAULT_CHANNEL_MASK)
         , sample_rate(ROC_CONFIG_DEFAULT_SAMPLE_RATE)
         , samples_per_packet(ROC_CONFIG_DEFAULT_PACKET_SAMPLES)
+        , sample_format(packet::Sample_L16)
         , random_loss_rate(0)
         , random_delay_rate(0)
         , random_delay_time(0)
+        , fec_scheme(packet::FEC_LDPC_Staircase)
+        , fec_block_data_packets(ROC_CONFIG_DEFAULT_FEC_BLOCK_DATA_PACKETS)
+        , fec_block_redundant_packets(ROC_CONFIG_DEFAULT_FEC_BLOCK_REDUNDANT_PACKETS)
         , byte_buffer_composer(&datagram::default_buffer_composer()) {
     }
 
@@ -130,6 +217,14 @@ struct ClientConfig {
     //! Number of samples per channel per packet.
     size_t samples_per_packet;
 
+    //! Sample format of audio packets.
+    //! @remarks
+    //!  L24 and Float32 avoid quantization to 16 bits but make packets 1.5 and
+    //!  2 times larger, so samples_per_packet should be reduced to fit packet
+    //!  into ROC_CONFIG_MAX_UDP_BUFSZ. Supported sample rates are 44100 and
+    //!  48000 Hz.
+    packet::SampleFormat sample_format;
+
     //! Percentage of packets to be lost in range [0; 100].
     size_t random_loss_rate;
 
@@ -139,6 +234,25 @@ struct ClientConfig {
     //! Delay time in milliseconds.
     size_t random_delay_time;
 
+    //! FEC scheme.
+    //! @remarks
+    //!  Reed-Solomon restores data from any fec_block_data_packets received
+    //!  packets, which LDPC-Staircase can't guarantee on small blocks.
+    //!  LDPC-Staircase is available only if built with OpenFEC.
+    packet::FECScheme fec_scheme;
+
+    //! Number of data packets in FEC block.
+    //! @remarks
+    //!  Larger blocks tolerate longer loss bursts but increase latency.
+    //!  Should not exceed ROC_CONFIG_MAX_FEC_BLOCK_DATA_PACKETS.
+    size_t fec_block_data_packets;
+
+    //! Number of FEC packets in FEC block.
+    //! @remarks
+    //!  Ratio to fec_block_data_packets defines bandwidth overhead.
+    //!  Should not exceed ROC_CONFIG_MAX_FEC_BLOCK_REDUNDANT_PACKETS.
+    size_t fec_block_redundant_packets;
+
     //! Composer for byte buffers.
     core::IByteBufferComposer* byte_buffer_composer;
 };
@@ -9,6 +9,7 @@
 
 #include "roc_core/panic.h"
 #include "roc_core/log.h"
+#include "roc_core/math.h"
 #include "roc_datagram/address_to_str.h"
 
 #include "roc_pipeline/server.h"
@@ -21,7 +22,9 @@ Server::Server(datagram::IDatagramReader& datagram_reader,
                const ServerConfig& config)
     : config_(config)
     , n_channels_(packet::num_channels(config_.channels))
-    , channel_muxer_(config_.channels, *config_.sample_buffer_composer)
+    , channel_muxer_(config_.channels,
+                     *config_.sample_buffer_composer,
+                     (config_.options & EnableClipping) != 0)
     , delayed_writer_(audio_writer, config_.channels, config_.output_latency)
     , datagram_reader_(datagram_reader)
     , audio_writer_(&delayed_writer_)
@@ -35,6 +38,11 @@ Server::Server(datagram::IDatagramReader& datagram_reader,
         roc_panic("server: # of samples per tick is zero");
     }
 
+    if (config_.max_sessions > ROC_CONFIG_MAX_SESSIONS) {
+        roc_panic("server: # of sessions exceeds maximum: max_sessions=%u limit=%u",
+                  (unsigned)config_.max_sessions, (unsigned)ROC_CONFIG_MAX_SESSIONS);
+    }
+
     if (!config_.byte_buffer_composer) {
         roc_panic("server: byte buffer composer is null");
     }
@@ -43,10 +51,6 @@ Server::Server(datagram::IDatagramReader& datagram_reader,
         roc_panic("server: sample buffer composer is null");
     }
 
-    if (!config_.session_pool) {
-        roc_panic("server: session pool is null");
-    }
-
     if (config_.options & EnableTiming) {
         audio_writer_ = new (timed_writer_)
             audio::TimedWriter(*audio_writer_, config_.channels, config_.sample_rate);
@@ -57,6 +61,10 @@ size_t Server::num_sessions() const {
     return session_manager_.num_sessions();
 }
 
+SessionStats Server::session_stats(size_t index) const {
+    return session_manager_.session_stats(index);
+}
+
 void Server::add_port(const datagram::Address& address, packet::IPacketParser& parser) {
     session_manager_.add_port(address, parser);
 }
@@ -82,28 +90,57 @@ void Server::stop() {
 }
 
 bool Server::tick() {
-    for (size_t n = 0; n < config_.max_sessions * config_.max_session_packets; n++) {
-        if (datagram::IDatagramConstPtr dgm = datagram_reader_.read()) {
-            session_manager_.route(*dgm);
-        } else {
-            break;
-        }
-    }
+    fetch_datagrams_();
 
     if (!session_manager_.update()) {
         return false;
     }
 
-    audio::ISampleBufferPtr buffer = config_.sample_buffer_composer->compose();
-    if (!buffer) {
-        roc_log(LOG_ERROR, "server: can't compose sample buffer");
+    session_manager_.render(config_.samples_per_tick);
+
+    if (!prepare_buffer_()) {
         return false;
     }
 
-    buffer->set_size(config_.samples_per_tick * n_channels_);
+    channel_muxer_.read(*buffer_);
+    audio_writer_->write(*buffer_);
+
+    return true;
+}
+
+void Server::fetch_datagrams_() {
+    const size_t max_datagrams = config_.max_sessions * config_.max_session_packets;
+
+    datagram::IDatagramConstPtr dgms[ReadBatch];
+
+    for (size_t n_fetched = 0; n_fetched < max_datagrams;) {
+        const size_t n_requested = ROC_MIN((size_t)ReadBatch, max_datagrams - n_fetched);
+        const size_t n_read = datagram_reader_.read_batch(dgms, n_requested);
+
+        for (size_t n = 0; n < n_read; n++) {
+            session_manager_.route(*dgms[n]);
+            dgms[n] = NULL;
+        }
+
+        n_fetched += n_read;
+
+        if (n_read < n_requested) {
+            break;
+        }
+    }
+}
+
+bool Server::prepare_buffer_() {
+    // Buffer from previous tick is reused if writer doesn't hold it anymore.
+    // Otherwise, e.g. if it's queued for playback, new buffer is composed.
+    if (!buffer_ || buffer_->getref() != 1) {
+        if (!(buffer_ = config_.sample_buffer_composer->compose())) {
+            roc_log(LOG_ERROR, "server: can't compose sample buffer");
+            return false;
+        }
+    }
 
-    channel_muxer_.read(*buffer);
-    audio_writer_->write(*buffer);
+    buffer_->set_size(config_.samples_per_tick * n_channels_);
 
     return true;
 }
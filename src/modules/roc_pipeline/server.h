@@ -24,6 +24,7 @@
 #include "roc_packet/ipacket_parser.h"
 
 #include "roc_audio/isample_buffer_writer.h"
+#include "roc_audio/sample_buffer.h"
 #include "roc_audio/isink.h"
 #include "roc_audio/channel_muxer.h"
 #include "roc_audio/timed_writer.h"
@@ -58,7 +59,7 @@ namespace pipeline {
 //!  Server pipeline consists of several steps:
 //!
 //!   <i> Fetching datagrams </i>
-//!    - Fetch datagrams from input queue.
+//!    - Fetch datagrams from input queue, in batches.
 //!
 //!    - Look at datagram's source address and check if a session exists for
 //!      this address; if not, and parser exists for datagram's destination
@@ -76,6 +77,10 @@ namespace pipeline {
 //!      that it's broken or inactive), session is unregistered from
 //!      audio sink and removed.
 //!
+//!   <i> Rendering sessions </i>
+//!    - If server workers are enabled, every session renders samples for
+//!      current tick into its own buffers, in parallel with other sessions.
+//!
 //!   <i> Generating samples </i>
 //!    - Requests audio sink to generate samples. During this process,
 //!      previously stored packets are transformed into audio stream.
@@ -96,6 +101,13 @@ public:
     //! Get number of active sessions.
     size_t num_sessions() const;
 
+    //! Get statistics of active session.
+    //! @pre
+    //!  @p index should be less than num_sessions().
+    //! @remarks
+    //!  Should not be called concurrently with tick().
+    SessionStats session_stats(size_t index) const;
+
     //! Register port.
     //! @remarks
     //!  When datagram received with destination @p address, session will
@@ -116,8 +128,14 @@ public:
     void stop();
 
 private:
+    // Maximum number of datagrams fetched from input reader by one call.
+    enum { ReadBatch = ROC_CONFIG_MAX_UDP_BATCH };
+
     virtual void run();
 
+    void fetch_datagrams_();
+    bool prepare_buffer_();
+
     const ServerConfig config_;
     const size_t n_channels_;
 
@@ -129,6 +147,7 @@ private:
 
     datagram::IDatagramReader& datagram_reader_;
     audio::ISampleBufferWriter* audio_writer_;
+    audio::ISampleBufferPtr buffer_;
 
     SessionManager session_manager_;
 };
@@ -9,6 +9,7 @@
 
 #include "roc_core/panic.h"
 #include "roc_core/log.h"
+#include "roc_core/math.h"
 
 #include "roc_pipeline/session.h"
 #include "roc_pipeline/config.h"
@@ -17,32 +18,42 @@ namespace roc {
 namespace pipeline {
 
 Session::Session(const ServerConfig& config,
+                 core::IPool<Session>& pool,
                  const datagram::Address& send_addr,
                  const datagram::Address& recv_addr,
                  packet::IPacketParser& parser)
     : config_(config)
+    , pool_(pool)
     , send_addr_(send_addr)
     , recv_addr_(recv_addr)
     , packet_parser_(parser)
-    , streamers_(MaxChannels)
-    , resamplers_(MaxChannels)
+    , streamer_(NULL)
+    , buffered_readers_(MaxChannels)
     , readers_(MaxChannels) {
     //
-    if (!config_.session_pool) {
-        roc_panic("session: session pool is null");
-    }
-
     make_pipeline_();
 }
 
 void Session::free() {
-    config_.session_pool->destroy(*this);
+    pool_.destroy(*this);
 }
 
 const datagram::Address& Session::sender() const {
     return send_addr_;
 }
 
+const datagram::Address& Session::receiver() const {
+    return recv_addr_;
+}
+
+size_t Session::num_sources() const {
+    return router_.num_sources();
+}
+
+packet::source_t Session::source(size_t index) const {
+    return router_.source(index);
+}
+
 bool Session::may_route(const datagram::IDatagram& dgm,
                         const packet::IPacketConstPtr& packet) const {
     if (dgm.sender() != send_addr_ || dgm.receiver() != recv_addr_) {
@@ -78,6 +89,31 @@ bool Session::update() {
     return true;
 }
 
+void Session::render(size_t num_samples) {
+    // Channels are filled in order, which keeps them in lockstep.
+    for (size_t ch = 0; ch < buffered_readers_.size(); ch++) {
+        if (buffered_readers_[ch]) {
+            buffered_readers_[ch]->fill(num_samples);
+        }
+    }
+}
+
+SessionStats Session::stats() const {
+    SessionStats st;
+
+    st.jitter = jitter_meter_->jitter();
+    st.num_received = jitter_meter_->num_received();
+    st.num_lost = jitter_meter_->num_lost();
+    st.num_missing_samples = streamer_->num_missing_samples();
+
+    if (scaler_) {
+        st.latency = scaler_->queue_size();
+        st.target_latency = scaler_->aim_queue_size();
+    }
+
+    return st;
+}
+
 void Session::attach(audio::ISink& sink) {
     roc_log(LOG_TRACE, "session: attaching readers to sink");
 
@@ -99,95 +135,216 @@ void Session::detach(audio::ISink& sink) {
 }
 
 void Session::make_pipeline_() {
-    packet::IPacketReader* packet_reader = make_packet_reader_();
-    roc_panic_if(!packet_reader);
+    make_packet_reader_();
 
     if (config_.options & EnableResampling) {
-        packet_reader =
-            new (scaler_) audio::Scaler(*packet_reader, *audio_packet_queue_,
-                                        (packet::timestamp_t)config_.session_latency);
+        new (scaler_) audio::Scaler(*audio_packet_queue_,
+                                    (packet::timestamp_t)config_.session_latency,
+                                    start_latency_());
+
+        if (config_.options & EnableLatencyTuning) {
+            make_latency_tuner_();
+        }
 
         monitors_.append(*scaler_);
+    } else if (config_.options & EnableLatencyTuning) {
+        roc_log(LOG_ERROR,
+                "session: latency tuning requires resampling, disabling latency tuner");
     }
 
-    new (chanalyzer_) audio::Chanalyzer(*packet_reader, config_.channels);
+    if ((config_.options & EnableFastStart) && !(config_.options & EnableResampling)) {
+        roc_log(LOG_ERROR,
+                "session: fast start requires resampling, disabling fast start");
+    }
 
-    for (packet::channel_t ch = 0; ch < MaxChannels; ch++) {
-        if ((config_.channels & (1 << ch)) == 0) {
-            continue;
+    // Streamer decodes every packet once for all channels and produces
+    // interleaved stream, which is then resampled as a whole and split
+    // into per-channel streams.
+    audio::IStreamReader* stream_reader = streamer_ = make_streamer_();
+
+    if (config_.options & EnableResampling) {
+        stream_reader = make_resampler_(stream_reader);
+    }
+
+    make_channel_readers_(stream_reader);
+
+    if (config_.num_workers != 0) {
+        make_buffered_readers_();
+    }
+}
+
+audio::StreamerBase* Session::make_streamer_() {
+    if (config_.options & EnableStaticPipeline) {
+        if (fec_watchdog_) {
+            return make_static_streamer_(*fec_watchdog_, static_fec_stages_);
+        } else {
+            return make_static_streamer_(*watchdog_, static_stages_);
         }
-        readers_[ch] = make_stream_reader_(chanalyzer_->reader(ch), ch);
-        roc_panic_if(!readers_[ch]);
     }
+
+    packet::IPacketReader* packet_reader = watchdog_.get();
+
+    if (fec_watchdog_) {
+        packet_reader = fec_watchdog_.get();
+    }
+
+    if (scaler_) {
+        packet_reader =
+            new (scaler_reader_) audio::ScalerReader(*packet_reader, *scaler_);
+    }
+
+    return new (dynamic_streamer_) audio::Streamer(*packet_reader, config_.channels,
+                                                   config_.options & EnableBeep);
 }
 
-audio::IStreamReader* Session::make_stream_reader_(packet::IPacketReader& packet_reader,
-                                                   packet::channel_t ch) {
-    //
-    audio::IStreamReader* stream_reader = new (streamers_[ch])
-        audio::Streamer(packet_reader, ch, config_.options & EnableBeep);
+template <class Reader>
+audio::StreamerBase* Session::make_static_streamer_(Reader& reader,
+                                                    StaticStages<Reader>& stages) {
+    typedef typename StaticStages<Reader>::ScalerReader ScalerReader;
 
-    if (config_.options & EnableResampling) {
-        roc_panic_if_not(scaler_);
+    // Every stage knows exact type of its input, so reading packets from
+    // session queue into streamer is inlined into a single call.
+    if (scaler_) {
+        new (stages.scaler_reader) ScalerReader(reader, *scaler_);
 
-        stream_reader = new (resamplers_[ch])
-            audio::Resampler(*stream_reader, *config_.sample_buffer_composer,
-                             config_.samples_per_resampler_frame);
+        return new (stages.scaled_streamer) audio::BasicStreamer<ScalerReader>(
+            *stages.scaler_reader, config_.channels, config_.options & EnableBeep);
+    } else {
+        return new (stages.streamer) audio::BasicStreamer<Reader>(
+            reader, config_.channels, config_.options & EnableBeep);
+    }
+}
 
-        scaler_->add_resampler(*resamplers_[ch]);
+audio::IStreamReader* Session::make_resampler_(audio::IStreamReader* stream_reader) {
+    roc_panic_if_not(scaler_);
+
+    const audio::PolyphaseBank* bank = NULL;
+    if (config_.resampler_type == ResamplerPolyphase) {
+        bank = &audio::PolyphaseBank::instance(config_.resampler_phases);
     }
 
+    // All channels share single resampler, which computes sinc taps once per
+    // output sample.
+    stream_reader = new (resampler_) audio::Resampler(
+        *stream_reader, *config_.sample_buffer_composer,
+        config_.samples_per_resampler_frame, audio::default_resampler_kernel(), bank,
+        packet::num_channels(config_.channels));
+
+    scaler_->add_resampler(*resampler_);
+
     return stream_reader;
 }
 
-packet::IPacketReader* Session::make_packet_reader_() {
-    packet::IPacketReader* packet_reader =
-        new (audio_packet_queue_) packet::PacketQueue(config_.max_session_packets);
+packet::timestamp_t Session::start_latency_() const {
+    // Without resampler, latency can't be grown after playback is started
+    // without inserting silence.
+    if ((config_.options & EnableFastStart) && (config_.options & EnableResampling)) {
+        return (packet::timestamp_t)ROC_MIN(config_.fast_start_latency,
+                                            config_.session_latency);
+    }
+
+    return (packet::timestamp_t)config_.session_latency;
+}
+
+void Session::make_latency_tuner_() {
+    roc_panic_if_not(scaler_);
+
+    size_t fec_block_packets = 0;
+    if (fec_decoder_) {
+        fec_block_packets =
+            config_.fec_block_data_packets + config_.fec_block_redundant_packets;
+    }
+
+    // Target latency decays during LatencyDecayTime after network conditions
+    // improve, so that short bursts of jitter or losses don't cause latency
+    // to oscillate.
+    size_t decay_ticks =
+        config_.sample_rate * LatencyDecayTime / 1000 / config_.samples_per_tick;
+    if (decay_ticks == 0) {
+        decay_ticks = 1;
+    }
+
+    new (latency_tuner_) audio::LatencyTuner(
+        *jitter_meter_, *scaler_, (packet::timestamp_t)config_.min_session_latency,
+        (packet::timestamp_t)config_.max_session_latency, fec_block_packets,
+        decay_ticks);
+
+    // Tuner should update scaler's target before scaler uses it.
+    monitors_.append(*latency_tuner_);
+}
+
+void Session::make_channel_readers_(audio::IStreamReader* stream_reader) {
+    roc_panic_if(!stream_reader);
+
+    if (packet::num_channels(config_.channels) != 1) {
+        new (unzipper_) audio::Unzipper(*stream_reader, config_.channels,
+                                        *config_.sample_buffer_composer);
+    }
+
+    for (packet::channel_t ch = 0; ch < MaxChannels; ch++) {
+        if ((config_.channels & (1 << ch)) == 0) {
+            continue;
+        }
+        if (unzipper_) {
+            readers_[ch] = &unzipper_->reader(ch);
+        } else {
+            readers_[ch] = stream_reader;
+        }
+    }
+}
+
+void Session::make_buffered_readers_() {
+    for (packet::channel_t ch = 0; ch < MaxChannels; ch++) {
+        if (readers_[ch]) {
+            readers_[ch] = new (buffered_readers_[ch]) audio::BufferedReader(
+                *readers_[ch], *config_.sample_buffer_composer);
+        }
+    }
+}
+
+void Session::make_packet_reader_() {
+    new (audio_packet_queue_) packet::PacketQueue(config_.max_session_packets);
+
+    new (jitter_meter_)
+        packet::JitterMeter(*audio_packet_queue_, config_.samples_per_tick);
+
+    router_.add_route(packet::IAudioPacket::Type, *jitter_meter_);
 
-    router_.add_route(packet::IAudioPacket::Type, *audio_packet_queue_);
+    monitors_.append(*jitter_meter_);
 
-    packet_reader = new (delayer_)
-        audio::Delayer(*packet_reader, (packet::timestamp_t)config_.session_latency);
+    new (delayer_) Delayer(*audio_packet_queue_, start_latency_());
 
-    packet_reader = new (watchdog_) packet::Watchdog(
-        *packet_reader, config_.session_timeout / config_.samples_per_tick,
-        config_.sample_rate);
+    new (watchdog_)
+        Watchdog(*delayer_, config_.session_timeout / config_.samples_per_tick,
+                 config_.sample_rate);
 
     monitors_.append(*watchdog_);
 
     if (config_.options & EnableFEC) {
-        packet_reader = make_fec_decoder_(packet_reader);
+        make_fec_decoder_();
     }
-
-    return packet_reader;
 }
 
-#ifdef ROC_TARGET_OPENFEC
-packet::IPacketReader* Session::make_fec_decoder_(packet::IPacketReader* packet_reader) {
-    //
+void Session::make_fec_decoder_() {
+    // Block decoder is created when first FEC packet is received, for the
+    // scheme used by sender.
+    new (fec_block_decoders_) fec::BlockDecoderFactory(*config_.byte_buffer_composer);
+
     new (fec_packet_queue_) packet::PacketQueue(config_.max_session_packets);
-    new (fec_ldpc_decoder_) fec::LDPC_BlockDecoder(*config_.byte_buffer_composer);
 
     router_.add_route(packet::IFECPacket::Type, *fec_packet_queue_);
 
-    packet_reader = new (fec_decoder_) fec::Decoder(*fec_ldpc_decoder_, *packet_reader,
-                                                    *fec_packet_queue_, packet_parser_);
+    new (fec_decoder_) fec::Decoder(*fec_block_decoders_, *watchdog_,
+                                    *fec_packet_queue_, packet_parser_,
+                                    config_.fec_block_data_packets,
+                                    config_.fec_block_redundant_packets);
 
-    packet_reader = new (fec_watchdog_) packet::Watchdog(
-        *packet_reader, config_.session_timeout / config_.samples_per_tick,
-        config_.sample_rate);
+    new (fec_watchdog_)
+        FECWatchdog(*fec_decoder_, config_.session_timeout / config_.samples_per_tick,
+                    config_.sample_rate);
 
     monitors_.append(*fec_watchdog_);
-
-    return packet_reader;
-}
-#else
-packet::IPacketReader* Session::make_fec_decoder_(packet::IPacketReader* packet_reader) {
-    roc_log(LOG_ERROR, "session: OpenFEC support not enabled, disabling fec decoder");
-    (void)packet_parser_;
-    return packet_reader;
 }
-#endif
 
 } // namespace pipeline
 } // namespace roc
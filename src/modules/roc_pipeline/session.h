@@ -30,27 +30,65 @@
 #include "roc_packet/ipacket_writer.h"
 #include "roc_packet/imonitor.h"
 #include "roc_packet/watchdog.h"
+#include "roc_packet/jitter_meter.h"
 #include "roc_packet/packet_queue.h"
 #include "roc_packet/packet_router.h"
 
 #include "roc_fec/decoder.h"
-
-#ifdef ROC_TARGET_OPENFEC
-#include "roc_fec/ldpc_block_decoder.h"
-#endif
+#include "roc_fec/block_decoder_factory.h"
 
 #include "roc_audio/isink.h"
 #include "roc_audio/delayer.h"
-#include "roc_audio/chanalyzer.h"
 #include "roc_audio/streamer.h"
+#include "roc_audio/unzipper.h"
 #include "roc_audio/resampler.h"
+#include "roc_audio/polyphase_bank.h"
 #include "roc_audio/scaler.h"
+#include "roc_audio/scaler_reader.h"
+#include "roc_audio/latency_tuner.h"
+#include "roc_audio/buffered_reader.h"
 
 namespace roc {
 namespace pipeline {
 
 struct ServerConfig;
 
+//! Session statistics.
+struct SessionStats {
+    //! Construct zero stats.
+    SessionStats()
+        : jitter(0)
+        , num_received(0)
+        , num_lost(0)
+        , num_missing_samples(0)
+        , latency(0)
+        , target_latency(0) {
+    }
+
+    //! Interarrival jitter as number of samples.
+    float jitter;
+
+    //! Number of received audio packets.
+    size_t num_received;
+
+    //! Number of lost audio packets.
+    size_t num_lost;
+
+    //! Number of samples per channel replaced because packets were lost
+    //! or late.
+    size_t num_missing_samples;
+
+    //! Number of samples per channel pending in session.
+    //! @remarks
+    //!  Zero if resampling is disabled.
+    size_t latency;
+
+    //! Target number of samples per channel pending in session.
+    //! @remarks
+    //!  Zero if resampling is disabled.
+    size_t target_latency;
+};
+
 //! Session pipeline.
 //! @remarks
 //!  Session object is created for every client connected to server.
@@ -59,7 +97,10 @@ struct ServerConfig;
 class Session : public core::RefCnt, public core::ListNode {
 public:
     //! Create session.
+    //! @remarks
+    //!  Session should be allocated from @p pool.
     Session(const ServerConfig& config,
+            core::IPool<Session>& pool,
             const datagram::Address& send_addr,
             const datagram::Address& recv_addr,
             packet::IPacketParser& parser);
@@ -67,6 +108,17 @@ public:
     //! Get sender address.
     const datagram::Address& sender() const;
 
+    //! Get receiver address.
+    const datagram::Address& receiver() const;
+
+    //! Get number of source IDs routed to this session.
+    size_t num_sources() const;
+
+    //! Get source ID routed to this session.
+    //! @pre
+    //!  @p index should be less than num_sources().
+    packet::source_t source(size_t index) const;
+
     //! Check if packet may be routed to this session.
     bool may_route(const datagram::IDatagram&, const packet::IPacketConstPtr&) const;
 
@@ -82,6 +134,17 @@ public:
     //!  false if session is broken and should be terminated.
     bool update();
 
+    //! Render samples in advance.
+    //! @remarks
+    //!  Reads @p num_samples samples of every channel into session buffers,
+    //!  so that subsequent reads from attached readers return them without
+    //!  running session pipeline. Has no effect unless server workers are
+    //!  enabled. May be called from worker thread.
+    void render(size_t num_samples);
+
+    //! Get session statistics.
+    SessionStats stats() const;
+
     //! Attach renderer to audio sink.
     void attach(audio::ISink& sink);
 
@@ -91,36 +154,70 @@ public:
 private:
     enum { MaxChannels = ROC_CONFIG_MAX_CHANNELS };
 
+    enum { LatencyDecayTime = 10000 /* ms */ };
+
+    // Stages which are present regardless of options always read from
+    // readers of known type.
+    typedef audio::BasicDelayer<packet::PacketQueue> Delayer;
+    typedef packet::BasicWatchdog<Delayer> Watchdog;
+    typedef packet::BasicWatchdog<fec::Decoder> FECWatchdog;
+
+    // Stages which depend on options, composed at compile time for given
+    // type of input packet reader.
+    template <class Reader> struct StaticStages {
+        typedef audio::BasicScalerReader<Reader> ScalerReader;
+
+        core::Maybe<ScalerReader> scaler_reader;
+        core::Maybe<audio::BasicStreamer<ScalerReader> > scaled_streamer;
+        core::Maybe<audio::BasicStreamer<Reader> > streamer;
+    };
+
     virtual void free();
 
     void make_pipeline_();
 
-    audio::IStreamReader* make_stream_reader_(packet::IPacketReader&, packet::channel_t);
+    audio::StreamerBase* make_streamer_();
 
-    packet::IPacketReader* make_packet_reader_();
-    packet::IPacketReader* make_fec_decoder_(packet::IPacketReader*);
+    template <class Reader>
+    audio::StreamerBase* make_static_streamer_(Reader&, StaticStages<Reader>&);
+
+    audio::IStreamReader* make_resampler_(audio::IStreamReader*);
+    void make_latency_tuner_();
+    void make_channel_readers_(audio::IStreamReader*);
+    void make_buffered_readers_();
+
+    void make_packet_reader_();
+    void make_fec_decoder_();
+
+    packet::timestamp_t start_latency_() const;
 
     const ServerConfig& config_;
+    core::IPool<Session>& pool_;
     const datagram::Address send_addr_;
     const datagram::Address recv_addr_;
     packet::IPacketParser& packet_parser_;
 
     core::Maybe<packet::PacketQueue> audio_packet_queue_;
+    core::Maybe<packet::JitterMeter> jitter_meter_;
     core::Maybe<packet::PacketQueue> fec_packet_queue_;
 
-    core::Maybe<audio::Delayer> delayer_;
-    core::Maybe<packet::Watchdog> watchdog_;
+    core::Maybe<Delayer> delayer_;
+    core::Maybe<Watchdog> watchdog_;
 
-#ifdef ROC_TARGET_OPENFEC
-    core::Maybe<fec::LDPC_BlockDecoder> fec_ldpc_decoder_;
+    core::Maybe<fec::BlockDecoderFactory> fec_block_decoders_;
     core::Maybe<fec::Decoder> fec_decoder_;
-    core::Maybe<packet::Watchdog> fec_watchdog_;
-#endif
-
-    core::Maybe<audio::Chanalyzer> chanalyzer_;
-    core::Array<core::Maybe<audio::Streamer>, MaxChannels> streamers_;
-    core::Array<core::Maybe<audio::Resampler>, MaxChannels> resamplers_;
+    core::Maybe<FECWatchdog> fec_watchdog_;
+
+    core::Maybe<audio::ScalerReader> scaler_reader_;
+    core::Maybe<audio::Streamer> dynamic_streamer_;
+    StaticStages<Watchdog> static_stages_;
+    StaticStages<FECWatchdog> static_fec_stages_;
+    audio::StreamerBase* streamer_;
+    core::Maybe<audio::Resampler> resampler_;
+    core::Maybe<audio::Unzipper> unzipper_;
     core::Maybe<audio::Scaler> scaler_;
+    core::Maybe<audio::LatencyTuner> latency_tuner_;
+    core::Array<core::Maybe<audio::BufferedReader>, MaxChannels> buffered_readers_;
     packet::PacketRouter router_;
 
     core::List<packet::IMonitor, core::NoOwnership> monitors_;
@@ -17,7 +17,18 @@ namespace pipeline {
 
 SessionManager::SessionManager(const ServerConfig& config, audio::ISink& sink)
     : config_(config)
-    , audio_sink_(sink) {
+    , audio_sink_(sink)
+    , session_pool_(config.session_pool)
+    , port_index_(MaxPorts)
+    , session_index_(config.max_sessions * MaxSessionSources) {
+    if (!session_pool_) {
+        session_pool_ =
+            new (default_session_pool_) core::HeapSlabPool<Session>(config_.max_sessions);
+    }
+
+    if (config_.num_workers != 0) {
+        new (renderer_) SessionRenderer(config_.num_workers);
+    }
 }
 
 SessionManager::~SessionManager() {
@@ -30,15 +41,36 @@ size_t SessionManager::num_sessions() const {
     return sessions_.size();
 }
 
+SessionStats SessionManager::session_stats(size_t index) const {
+    if (index >= sessions_.size()) {
+        roc_panic("session manager: session index out of bounds: index=%lu size=%lu",
+                  (unsigned long)index, (unsigned long)sessions_.size());
+    }
+
+    SessionPtr session = sessions_.front();
+    for (; index != 0; index--) {
+        session = sessions_.next(*session);
+    }
+
+    return session->stats();
+}
+
 void SessionManager::add_port(const datagram::Address& address,
                               packet::IPacketParser& parser) {
     roc_panic_if(&parser == NULL);
 
+    if (port_index_.find(address)) {
+        roc_log(LOG_ERROR, "session manager: port %s is already registered",
+                datagram::address_to_str(address).c_str());
+        return;
+    }
+
     Port port;
     port.address = address;
     port.parser = &parser;
 
     ports_.append(port);
+    port_index_.insert(address, ports_.size() - 1);
 }
 
 bool SessionManager::route(const datagram::IDatagram& dgm) {
@@ -76,8 +108,7 @@ bool SessionManager::update() {
             roc_log(LOG_DEBUG, "session manager: removing session %s",
                     datagram::address_to_str(session->sender()).c_str());
 
-            session->detach(audio_sink_);
-            sessions_.remove(*session);
+            remove_session_(*session);
 
             if ((config_.options & EnableOneshot) && sessions_.size() == 0) {
                 return false;
@@ -88,6 +119,12 @@ bool SessionManager::update() {
     return true;
 }
 
+void SessionManager::render(size_t num_samples) {
+    if (renderer_) {
+        renderer_->render(sessions_, num_samples);
+    }
+}
+
 void SessionManager::destroy_sessions_() {
     roc_log(LOG_DEBUG, "session manager: destroying %u sessions",
             (unsigned)sessions_.size());
@@ -96,26 +133,48 @@ void SessionManager::destroy_sessions_() {
 
     for (SessionPtr session = sessions_.front(); session; session = next_session) {
         next_session = sessions_.next(*session);
-        sessions_.remove(*session);
 
-        session->detach(audio_sink_);
+        remove_session_(*session);
+    }
+}
+
+void SessionManager::remove_session_(Session& session) {
+    for (size_t n = 0; n < session.num_sources(); n++) {
+        session_index_.remove(
+            SessionKey(session.sender(), session.receiver(), session.source(n)));
+    }
+
+    session.detach(audio_sink_);
+    sessions_.remove(session);
+}
+
+void SessionManager::index_session_(Session& session,
+                                    const packet::IPacketConstPtr& packet) {
+    const SessionKey key(session.sender(), session.receiver(), packet->source());
+
+    if (!session_index_.find(key) && !session_index_.insert(key, &session)) {
+        roc_panic("session manager: session index is full");
     }
 }
 
 bool SessionManager::find_session_and_store_(const datagram::IDatagram& dgm,
                                              const packet::IPacketConstPtr& packet) {
-    for (SessionPtr session = sessions_.front(); session;
-         session = sessions_.next(*session)) {
-        if (session->may_route(dgm, packet)) {
-            session->route(packet);
-            return true;
-        }
+    const SessionKey key(dgm.sender(), dgm.receiver(), packet->source());
+
+    if (Session** session = session_index_.find(key)) {
+        roc_panic_if(!(*session)->may_route(dgm, packet));
+
+        (*session)->route(packet);
+        return true;
     }
 
+    // Packet of new source may be routed to existing session which
+    // expects this packet type but didn't get its source ID yet.
     for (SessionPtr session = sessions_.front(); session;
          session = sessions_.next(*session)) {
         if (session->may_autodetect_route(dgm, packet)) {
             session->route(packet);
+            index_session_(*session, packet);
             return true;
         }
     }
@@ -136,8 +195,8 @@ bool SessionManager::create_session_and_store_(const datagram::IDatagram& dgm,
     roc_log(LOG_DEBUG, "session manager: creating session %s",
             datagram::address_to_str(dgm.sender()).c_str());
 
-    SessionPtr session = new (*config_.session_pool)
-        Session(config_, dgm.sender(), dgm.receiver(), parser);
+    SessionPtr session = new (*session_pool_)
+        Session(config_, *session_pool_, dgm.sender(), dgm.receiver(), parser);
 
     if (!session) {
         roc_log(LOG_DEBUG, "session manager: can't get session from pool");
@@ -153,14 +212,14 @@ bool SessionManager::create_session_and_store_(const datagram::IDatagram& dgm,
     session->attach(audio_sink_);
     sessions_.append(*session);
 
+    index_session_(*session, packet);
+
     return true;
 }
 
 const SessionManager::Port* SessionManager::find_port_(const datagram::Address& address) {
-    for (size_t n = 0; n < ports_.size(); n++) {
-        if (ports_[n].address == address) {
-            return &ports_[n];
-        }
+    if (const size_t* index = port_index_.find(address)) {
+        return &ports_[*index];
     }
 
     return NULL;
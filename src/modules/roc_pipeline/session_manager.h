@@ -16,11 +16,15 @@
 #include "roc_core/noncopyable.h"
 #include "roc_core/array.h"
 #include "roc_core/list.h"
+#include "roc_core/maybe.h"
+#include "roc_core/hash_map.h"
+#include "roc_core/heap_slab_pool.h"
 #include "roc_datagram/idatagram.h"
 #include "roc_packet/ipacket_parser.h"
 #include "roc_audio/isink.h"
 
 #include "roc_pipeline/session.h"
+#include "roc_pipeline/session_renderer.h"
 #include "roc_pipeline/config.h"
 
 namespace roc {
@@ -30,6 +34,11 @@ namespace pipeline {
 //! @remarks
 //!  Maintains list of active sessions and routes incoming datagrams
 //!  to them.
+//!
+//!  Sessions are indexed by sender address, receiver address and source
+//!  ID, and ports are indexed by address, so that routing a packet of
+//!  known source takes constant time. Session list is scanned only for
+//!  packets of new sources.
 class SessionManager : public core::NonCopyable<> {
 public:
     //! Initialize session manager.
@@ -40,6 +49,11 @@ public:
     //! Get number of active sessions.
     size_t num_sessions() const;
 
+    //! Get statistics of active session.
+    //! @pre
+    //!  @p index should be less than num_sessions().
+    SessionStats session_stats(size_t index) const;
+
     //! Register port.
     void add_port(const datagram::Address&, packet::IPacketParser&);
 
@@ -51,8 +65,17 @@ public:
     //! @returns false if server should be terminated.
     bool update();
 
+    //! Render sessions in advance.
+    //! @remarks
+    //!  Renders @p num_samples samples of every session in parallel if
+    //!  server workers are enabled, and does nothing otherwise.
+    void render(size_t num_samples);
+
 private:
-    enum { MaxPorts = ROC_CONFIG_MAX_PORTS };
+    enum {
+        MaxPorts = ROC_CONFIG_MAX_PORTS,
+        MaxSessionSources = ROC_CONFIG_MAX_SESSION_QUEUES
+    };
 
     struct Port {
         datagram::Address address;
@@ -63,7 +86,37 @@ private:
         }
     };
 
+    struct SessionKey {
+        datagram::Address sender;
+        datagram::Address receiver;
+        packet::source_t source;
+
+        SessionKey()
+            : source(0) {
+        }
+
+        SessionKey(const datagram::Address& snd,
+                   const datagram::Address& rcv,
+                   packet::source_t src)
+            : sender(snd)
+            , receiver(rcv)
+            , source(src) {
+        }
+
+        bool operator==(const SessionKey& other) const {
+            return source == other.source && sender == other.sender
+                && receiver == other.receiver;
+        }
+
+        size_t hash() const {
+            return core::hash_combine(
+                core::hash_combine(sender.hash(), receiver.hash()), source);
+        }
+    };
+
     void destroy_sessions_();
+    void remove_session_(Session&);
+    void index_session_(Session&, const packet::IPacketConstPtr&);
 
     bool find_session_and_store_(const datagram::IDatagram&,
                                  const packet::IPacketConstPtr&);
@@ -77,8 +130,16 @@ private:
     const ServerConfig config_;
     audio::ISink& audio_sink_;
 
+    core::Maybe<core::HeapSlabPool<Session> > default_session_pool_;
+    core::IPool<Session>* session_pool_;
+
     core::Array<Port, MaxPorts> ports_;
+    core::HashMap<datagram::Address, size_t> port_index_;
+
     core::List<Session> sessions_;
+    core::HashMap<SessionKey, Session*> session_index_;
+
+    core::Maybe<SessionRenderer> renderer_;
 };
 
 } // namespace pipeline
@@ -0,0 +1,106 @@
+/*
+ * Copyright (c) 2015 Mikhail Baranov
+ * Copyright (c) 2015 Victor Gaydov
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "roc_core/panic.h"
+#include "roc_core/log.h"
+
+#include "roc_pipeline/session_renderer.h"
+
+namespace roc {
+namespace pipeline {
+
+SessionRenderer::SessionRenderer(size_t num_workers)
+    : num_samples_(0) {
+    if (num_workers > workers_.max_size()) {
+        roc_panic("session renderer: too many workers: num_workers=%u max=%u",
+                  (unsigned)num_workers, (unsigned)workers_.max_size());
+    }
+
+    roc_log(LOG_DEBUG, "session renderer: starting %u workers", (unsigned)num_workers);
+
+    for (size_t n = 0; n < num_workers; n++) {
+        new (workers_.allocate()) Worker(this);
+        workers_.back().start();
+    }
+}
+
+SessionRenderer::~SessionRenderer() {
+    stop_ = true;
+
+    for (size_t n = 0; n < workers_.size(); n++) {
+        start_sem_.post();
+    }
+
+    for (size_t n = 0; n < workers_.size(); n++) {
+        workers_[n].join();
+    }
+}
+
+void SessionRenderer::render(core::List<Session>& sessions, size_t num_samples) {
+    sessions_.resize(0);
+
+    for (SessionPtr session = sessions.front(); session;
+         session = sessions.next(*session)) {
+        sessions_.append(session.get());
+    }
+
+    if (sessions_.size() == 0) {
+        return;
+    }
+
+    num_samples_ = num_samples;
+    next_session_ = false;
+
+    // There is no point in waking more workers than there are sessions
+    // besides the one rendered by calling thread.
+    size_t num_woken = sessions_.size() - 1;
+    if (num_woken > workers_.size()) {
+        num_woken = workers_.size();
+    }
+
+    for (size_t n = 0; n < num_woken; n++) {
+        start_sem_.post();
+    }
+
+    work_();
+
+    for (size_t n = 0; n < num_woken; n++) {
+        done_sem_.pend();
+    }
+}
+
+void SessionRenderer::Worker::run() {
+    roc_panic_if(!renderer_);
+
+    for (;;) {
+        renderer_->start_sem_.pend();
+
+        if (renderer_->stop_) {
+            break;
+        }
+
+        renderer_->work_();
+
+        renderer_->done_sem_.post();
+    }
+}
+
+void SessionRenderer::work_() {
+    for (;;) {
+        const size_t n = (size_t)++next_session_ - 1;
+        if (n >= sessions_.size()) {
+            break;
+        }
+
+        sessions_[n]->render(num_samples_);
+    }
+}
+
+} // namespace pipeline
+} // namespace roc
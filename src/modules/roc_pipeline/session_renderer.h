@@ -0,0 +1,84 @@
+/*
+ * Copyright (c) 2015 Mikhail Baranov
+ * Copyright (c) 2015 Victor Gaydov
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+//! @file roc_pipeline/session_renderer.h
+//! @brief Session renderer.
+
+#ifndef ROC_PIPELINE_SESSION_RENDERER_H_
+#define ROC_PIPELINE_SESSION_RENDERER_H_
+
+#include "roc_config/config.h"
+
+#include "roc_core/noncopyable.h"
+#include "roc_core/array.h"
+#include "roc_core/list.h"
+#include "roc_core/thread.h"
+#include "roc_core/semaphore.h"
+#include "roc_core/atomic.h"
+
+#include "roc_pipeline/session.h"
+
+namespace roc {
+namespace pipeline {
+
+//! Session renderer.
+//! @remarks
+//!  Renders sessions in parallel using a pool of worker threads. The
+//!  calling thread renders sessions as well and returns when every
+//!  session is rendered.
+//!
+//!  Sessions don't share state, so the result is the same as if sessions
+//!  were rendered one by one.
+class SessionRenderer : public core::NonCopyable<> {
+public:
+    //! Initialize and start @p num_workers worker threads.
+    explicit SessionRenderer(size_t num_workers);
+
+    //! Stop and join worker threads.
+    ~SessionRenderer();
+
+    //! Render @p num_samples samples of every session.
+    void render(core::List<Session>& sessions, size_t num_samples);
+
+private:
+    enum {
+        MaxWorkers = ROC_CONFIG_MAX_SERVER_WORKERS,
+        MaxSessions = ROC_CONFIG_MAX_SESSIONS
+    };
+
+    class Worker : public core::Thread {
+    public:
+        Worker(SessionRenderer* renderer = NULL)
+            : renderer_(renderer) {
+        }
+
+    private:
+        virtual void run();
+
+        SessionRenderer* renderer_;
+    };
+
+    void work_();
+
+    core::Array<Worker, MaxWorkers> workers_;
+
+    core::Array<Session*, MaxSessions> sessions_;
+    size_t num_samples_;
+
+    core::Atomic next_session_;
+    core::Atomic stop_;
+
+    core::Semaphore start_sem_;
+    core::Semaphore done_sem_;
+};
+
+} // namespace pipeline
+} // namespace roc
+
+#endif // ROC_PIPELINE_SESSION_RENDERER_H_
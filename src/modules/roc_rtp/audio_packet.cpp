@@ -68,14 +68,24 @@ void AudioPacket::set_marker(bool m) {
     packet_.header().set_marker(m);
 }
 
+packet::SampleFormat AudioPacket::sample_format() const {
+    if (!format_) {
+        roc_panic("rtp audio packet: audio format isn't set, forgot set_size()?");
+    }
+    return format_->format;
+}
+
 void AudioPacket::set_size(packet::channel_mask_t ch_mask,
                            size_t n_samples,
-                           size_t sample_rate) {
-    if (const RTP_AudioFormat* format = get_audio_format_cr(ch_mask, sample_rate)) {
+                           size_t sample_rate,
+                           packet::SampleFormat sample_format) {
+    if (const RTP_AudioFormat* format =
+            get_audio_format_cr(ch_mask, sample_rate, sample_format)) {
         format_ = format;
     } else {
-        roc_panic("rtp audio packet: no supported format for channel mask 0x%xu",
-                  (unsigned)ch_mask);
+        roc_panic("rtp audio packet: no supported format:"
+                  " channel_mask=0x%x rate=%lu sample_format=%d",
+                  (unsigned)ch_mask, (unsigned long)sample_rate, (int)sample_format);
     }
 
     packet_.header().set_payload_type(format_->pt);
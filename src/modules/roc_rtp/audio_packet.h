@@ -61,8 +61,14 @@ public:
     //! Get number of samples in packet.
     virtual size_t num_samples() const;
 
-    //! Set channel mask, number of samples per channel and sample rate.
-    virtual void set_size(packet::channel_mask_t ch_mask, size_t n_samples, size_t rate);
+    //! Get sample format of packet payload.
+    virtual packet::SampleFormat sample_format() const;
+
+    //! Set channel mask, number of samples per channel, sample rate and format.
+    virtual void set_size(packet::channel_mask_t ch_mask,
+                          size_t n_samples,
+                          size_t rate,
+                          packet::SampleFormat format = packet::Sample_L16);
 
     //! Read samples from packet.
     virtual size_t read_samples(packet::channel_mask_t ch_mask,
@@ -37,7 +37,7 @@ packet::IPacketPtr Composer::compose(packet::PacketType type) {
     }
 
     if (type == packet::IFECPacket::Type) {
-        rtp_packet.header().set_payload_type(123); // FIXME
+        rtp_packet.header().set_payload_type(RTP_PT_FEC_LDPC);
         return new (fec_pool_) FECPacket(fec_pool_, rtp_packet);
     }
 
@@ -0,0 +1,37 @@
+/*
+ * Copyright (c) 2015 Mikhail Baranov
+ * Copyright (c) 2015 Victor Gaydov
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "roc_core/singleton.h"
+
+#include "roc_rtp/default_pcm_kernel.h"
+#include "roc_rtp/generic_pcm_kernel.h"
+
+#ifdef ROC_TARGET_SSE
+#include "roc_rtp/sse_pcm_kernel.h"
+#endif
+
+#ifdef ROC_TARGET_NEON
+#include "roc_rtp/neon_pcm_kernel.h"
+#endif
+
+namespace roc {
+namespace rtp {
+
+IPCMKernel& default_pcm_kernel() {
+#if defined(ROC_TARGET_SSE)
+    return core::Singleton<SSE2PCMKernel>::instance();
+#elif defined(ROC_TARGET_NEON)
+    return core::Singleton<NEONPCMKernel>::instance();
+#else
+    return core::Singleton<GenericPCMKernel>::instance();
+#endif
+}
+
+} // namespace rtp
+} // namespace roc
@@ -0,0 +1,27 @@
+/*
+ * Copyright (c) 2015 Mikhail Baranov
+ * Copyright (c) 2015 Victor Gaydov
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+//! @file roc_rtp/default_pcm_kernel.h
+//! @brief Default PCM kernel.
+
+#ifndef ROC_RTP_DEFAULT_PCM_KERNEL_H_
+#define ROC_RTP_DEFAULT_PCM_KERNEL_H_
+
+#include "roc_rtp/ipcm_kernel.h"
+
+namespace roc {
+namespace rtp {
+
+//! Get fastest PCM kernel enabled at build time.
+IPCMKernel& default_pcm_kernel();
+
+} // namespace rtp
+} // namespace roc
+
+#endif // ROC_RTP_DEFAULT_PCM_KERNEL_H_
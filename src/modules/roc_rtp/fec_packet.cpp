@@ -61,6 +61,25 @@ void FECPacket::set_marker(bool m) {
     packet_.header().set_marker(m);
 }
 
+packet::FECScheme FECPacket::scheme() const {
+    if (packet_.header().payload_type() == RTP_PT_FEC_RS8) {
+        return packet::FEC_ReedSolomon8;
+    } else {
+        return packet::FEC_LDPC_Staircase;
+    }
+}
+
+void FECPacket::set_scheme(packet::FECScheme scheme) {
+    switch (scheme) {
+    case packet::FEC_LDPC_Staircase:
+        packet_.header().set_payload_type(RTP_PT_FEC_LDPC);
+        break;
+    case packet::FEC_ReedSolomon8:
+        packet_.header().set_payload_type(RTP_PT_FEC_RS8);
+        break;
+    }
+}
+
 packet::seqnum_t FECPacket::data_blknum() const {
     // FIXME
     return packet_.header().timestamp() & 0xffff;
@@ -87,8 +106,41 @@ void FECPacket::set_fec_blknum(packet::seqnum_t sn) {
     packet_.header().set_timestamp(ts);
 }
 
+size_t FECPacket::data_blksz() const {
+    if (const RTP_FECHeader* hdr = fec_header_()) {
+        return hdr->data_blksz();
+    } else {
+        return 0;
+    }
+}
+
+void FECPacket::set_data_blksz(size_t sz) {
+    roc_panic_if(sz > (uint16_t)-1);
+    mut_fec_header_().set_data_blksz((uint16_t)sz);
+}
+
+size_t FECPacket::fec_blksz() const {
+    if (const RTP_FECHeader* hdr = fec_header_()) {
+        return hdr->fec_blksz();
+    } else {
+        return 0;
+    }
+}
+
+void FECPacket::set_fec_blksz(size_t sz) {
+    roc_panic_if(sz > (uint16_t)-1);
+    mut_fec_header_().set_fec_blksz((uint16_t)sz);
+}
+
 core::IByteBufferConstSlice FECPacket::payload() const {
-    return packet_.payload();
+    core::IByteBufferConstSlice buff = packet_.payload();
+
+    if (buff.size() <= sizeof(RTP_FECHeader)) {
+        return core::IByteBufferConstSlice();
+    }
+
+    return core::IByteBufferConstSlice(buff, sizeof(RTP_FECHeader),
+                                       buff.size() - sizeof(RTP_FECHeader));
 }
 
 void FECPacket::set_payload(const uint8_t* data, size_t size) {
@@ -96,16 +148,51 @@ void FECPacket::set_payload(const uint8_t* data, size_t size) {
         roc_panic("rtp fec packet: data is null, size is non-null");
     }
 
-    packet_.set_payload_size(size);
+    core::IByteBufferSlice payload = alloc_payload(size);
 
     if (size > 0) {
-        memcpy(packet_.payload().data(), data, size);
+        memcpy(payload.data(), data, size);
     }
 }
 
+core::IByteBufferSlice FECPacket::alloc_payload(size_t size) {
+    const RTP_FECHeader hdr = mut_fec_header_();
+
+    packet_.set_payload_size(sizeof(RTP_FECHeader) + size);
+
+    core::IByteBufferSlice buff = packet_.payload();
+
+    memcpy(buff.data(), &hdr, sizeof(RTP_FECHeader));
+
+    if (size == 0) {
+        return core::IByteBufferSlice();
+    }
+
+    return core::IByteBufferSlice(buff, sizeof(RTP_FECHeader), size);
+}
+
 core::IByteBufferConstSlice FECPacket::raw_data() const {
     return packet_.raw_data();
 }
 
+const RTP_FECHeader* FECPacket::fec_header_() const {
+    core::IByteBufferConstSlice buff = packet_.payload();
+
+    if (buff.size() < sizeof(RTP_FECHeader)) {
+        return NULL;
+    }
+
+    return (const RTP_FECHeader*)buff.data();
+}
+
+RTP_FECHeader& FECPacket::mut_fec_header_() {
+    if (packet_.payload().size() < sizeof(RTP_FECHeader)) {
+        packet_.set_payload_size(sizeof(RTP_FECHeader));
+        memset(packet_.payload().data(), 0, sizeof(RTP_FECHeader));
+    }
+
+    return *(RTP_FECHeader*)packet_.payload().data();
+}
+
 } // namespace rtp
 } // namespace roc
@@ -22,6 +22,8 @@ namespace roc {
 namespace rtp {
 
 //! RTP FEC packet.
+//! @remarks
+//!  RTP payload starts with RTP_FECHeader followed by encoded symbols.
 class FECPacket : public packet::IFECPacket, public core::NonCopyable<> {
 public:
     //! Initialize.
@@ -54,6 +56,12 @@ public:
     //! Set packet marker bit.
     virtual void set_marker(bool);
 
+    //! FEC scheme used to encode payload.
+    virtual packet::FECScheme scheme() const;
+
+    //! Set FEC scheme used to encode payload.
+    virtual void set_scheme(packet::FECScheme);
+
     //! Seqnum of first data packet in block.
     virtual packet::seqnum_t data_blknum() const;
 
@@ -66,18 +74,38 @@ public:
     //! Set seqnum of first FEC packet in block.
     virtual void set_fec_blknum(packet::seqnum_t);
 
+    //! Number of data packets in block.
+    virtual size_t data_blksz() const;
+
+    //! Set number of data packets in block.
+    virtual void set_data_blksz(size_t);
+
+    //! Number of FEC packets in block.
+    virtual size_t fec_blksz() const;
+
+    //! Set number of FEC packets in block.
+    virtual void set_fec_blksz(size_t);
+
     //! Get payload.
+    //! @remarks
+    //!  Doesn't include FEC payload header.
     virtual core::IByteBufferConstSlice payload() const;
 
     //! Set payload data and size.
     virtual void set_payload(const uint8_t* data, size_t size);
 
+    //! Set payload size and get writable payload.
+    virtual core::IByteBufferSlice alloc_payload(size_t size);
+
     //! Get packet data buffer (containing header and payload).
     virtual core::IByteBufferConstSlice raw_data() const;
 
 private:
     virtual void free();
 
+    const RTP_FECHeader* fec_header_() const;
+    RTP_FECHeader& mut_fec_header_();
+
     RTP_Packet packet_;
     core::IPool<FECPacket>& pool_;
 };
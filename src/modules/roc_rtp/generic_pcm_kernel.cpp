@@ -0,0 +1,42 @@
+/*
+ * Copyright (c) 2015 Mikhail Baranov
+ * Copyright (c) 2015 Victor Gaydov
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "roc_core/byte_order.h"
+#include "roc_rtp/generic_pcm_kernel.h"
+
+namespace roc {
+namespace rtp {
+
+using packet::sample_t;
+
+const char* GenericPCMKernel::name() const {
+    return "generic";
+}
+
+void GenericPCMKernel::decode_l16(sample_t* out, const int16_t* in, size_t n) const {
+    for (size_t k = 0; k < n; k++) {
+        const int16_t hs = (int16_t)ROC_NTOH_16(uint16_t(in[k]));
+        out[k] = sample_t(hs) / (1 << 15);
+    }
+}
+
+void GenericPCMKernel::encode_l16(int16_t* out, const sample_t* in, size_t n) const {
+    for (size_t k = 0; k < n; k++) {
+        sample_t fs = in[k] * (1 << 15);
+        if (fs > 32767) {
+            fs = 32767;
+        } else if (fs < -32768) {
+            fs = -32768;
+        }
+        out[k] = (int16_t)ROC_HTON_16(uint16_t(int16_t(fs)));
+    }
+}
+
+} // namespace rtp
+} // namespace roc
@@ -0,0 +1,40 @@
+/*
+ * Copyright (c) 2015 Mikhail Baranov
+ * Copyright (c) 2015 Victor Gaydov
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+//! @file roc_rtp/generic_pcm_kernel.h
+//! @brief Generic PCM kernel.
+
+#ifndef ROC_RTP_GENERIC_PCM_KERNEL_H_
+#define ROC_RTP_GENERIC_PCM_KERNEL_H_
+
+#include "roc_core/noncopyable.h"
+#include "roc_rtp/ipcm_kernel.h"
+
+namespace roc {
+namespace rtp {
+
+//! Generic PCM kernel.
+//! @remarks
+//!  Plain scalar implementation available on every platform.
+class GenericPCMKernel : public IPCMKernel, public core::NonCopyable<> {
+public:
+    //! Get kernel name.
+    virtual const char* name() const;
+
+    //! Decode 16-bit big-endian PCM.
+    virtual void decode_l16(packet::sample_t* out, const int16_t* in, size_t n) const;
+
+    //! Encode 16-bit big-endian PCM.
+    virtual void encode_l16(int16_t* out, const packet::sample_t* in, size_t n) const;
+};
+
+} // namespace rtp
+} // namespace roc
+
+#endif // ROC_RTP_GENERIC_PCM_KERNEL_H_
@@ -0,0 +1,48 @@
+/*
+ * Copyright (c) 2015 Mikhail Baranov
+ * Copyright (c) 2015 Victor Gaydov
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+//! @file roc_rtp/ipcm_kernel.h
+//! @brief PCM kernel interface.
+
+#ifndef ROC_RTP_IPCM_KERNEL_H_
+#define ROC_RTP_IPCM_KERNEL_H_
+
+#include "roc_core/stddefs.h"
+#include "roc_packet/units.h"
+
+namespace roc {
+namespace rtp {
+
+//! PCM kernel interface.
+//! @remarks
+//!  Implements sample loops used to convert contiguous runs of samples
+//!  between payload and host representation.
+class IPCMKernel {
+public:
+    virtual ~IPCMKernel();
+
+    //! Get kernel name.
+    virtual const char* name() const = 0;
+
+    //! Decode 16-bit big-endian PCM.
+    //! @remarks
+    //!  Computes out[k] = ntoh(in[k]) / 2^15 for k in [0; n).
+    virtual void decode_l16(packet::sample_t* out, const int16_t* in, size_t n) const = 0;
+
+    //! Encode 16-bit big-endian PCM.
+    //! @remarks
+    //!  Computes out[k] = hton(in[k] * 2^15) for k in [0; n). Result is
+    //!  truncated towards zero and saturated to 16-bit range.
+    virtual void encode_l16(int16_t* out, const packet::sample_t* in, size_t n) const = 0;
+};
+
+} // namespace rtp
+} // namespace roc
+
+#endif // ROC_RTP_IPCM_KERNEL_H_
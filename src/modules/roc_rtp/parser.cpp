@@ -33,8 +33,7 @@ packet::IPacketConstPtr Parser::parse(const core::IByteBufferConstSlice& buffer)
         return new (audio_pool_) AudioPacket(audio_pool_, rtp_packet, format);
     }
 
-    // FIXME
-    if (pt == 123) {
+    if (pt == RTP_PT_FEC_LDPC || pt == RTP_PT_FEC_RS8) {
         return new (fec_pool_) FECPacket(fec_pool_, rtp_packet);
     }
 
@@ -15,36 +15,56 @@ namespace rtp {
 
 extern const RTP_AudioFormat RTP_AudioFormat_L16_Stereo;
 extern const RTP_AudioFormat RTP_AudioFormat_L16_Mono;
+extern const RTP_AudioFormat RTP_AudioFormat_L24_Stereo;
+extern const RTP_AudioFormat RTP_AudioFormat_L24_Mono;
+extern const RTP_AudioFormat RTP_AudioFormat_F32_Stereo;
+extern const RTP_AudioFormat RTP_AudioFormat_F32_Mono;
+extern const RTP_AudioFormat RTP_AudioFormat_L16_Stereo_48;
+extern const RTP_AudioFormat RTP_AudioFormat_L16_Mono_48;
+extern const RTP_AudioFormat RTP_AudioFormat_L24_Stereo_48;
+extern const RTP_AudioFormat RTP_AudioFormat_L24_Mono_48;
+extern const RTP_AudioFormat RTP_AudioFormat_F32_Stereo_48;
+extern const RTP_AudioFormat RTP_AudioFormat_F32_Mono_48;
 
-const RTP_AudioFormat* get_audio_format_pt(uint8_t pt) {
-    switch (pt) {
-    case RTP_PT_L16_STEREO:
-        return &RTP_AudioFormat_L16_Stereo;
+namespace {
+
+const RTP_AudioFormat* const audio_formats[] = {
+    &RTP_AudioFormat_L16_Stereo,    //
+    &RTP_AudioFormat_L16_Mono,      //
+    &RTP_AudioFormat_L24_Stereo,    //
+    &RTP_AudioFormat_L24_Mono,      //
+    &RTP_AudioFormat_F32_Stereo,    //
+    &RTP_AudioFormat_F32_Mono,      //
+    &RTP_AudioFormat_L16_Stereo_48, //
+    &RTP_AudioFormat_L16_Mono_48,   //
+    &RTP_AudioFormat_L24_Stereo_48, //
+    &RTP_AudioFormat_L24_Mono_48,   //
+    &RTP_AudioFormat_F32_Stereo_48, //
+    &RTP_AudioFormat_F32_Mono_48    //
+};
 
-    case RTP_PT_L16_MONO:
-        return &RTP_AudioFormat_L16_Mono;
+const size_t num_audio_formats = sizeof(audio_formats) / sizeof(audio_formats[0]);
 
-    default:
-        break;
+} // namespace
+
+const RTP_AudioFormat* get_audio_format_pt(uint8_t pt) {
+    for (size_t n = 0; n < num_audio_formats; n++) {
+        if (audio_formats[n]->pt == pt) {
+            return audio_formats[n];
+        }
     }
 
     return NULL;
 }
 
-const RTP_AudioFormat* get_audio_format_cr(packet::channel_mask_t ch, size_t rate) {
-    switch (ch) {
-    case 0x1:
-        if (RTP_AudioFormat_L16_Mono.rate == rate) {
-            return &RTP_AudioFormat_L16_Mono;
-        }
-
-    case 0x3:
-        if (RTP_AudioFormat_L16_Stereo.rate == rate) {
-            return &RTP_AudioFormat_L16_Stereo;
+const RTP_AudioFormat* get_audio_format_cr(packet::channel_mask_t ch,
+                                           size_t rate,
+                                           packet::SampleFormat format) {
+    for (size_t n = 0; n < num_audio_formats; n++) {
+        if (audio_formats[n]->channels == ch && audio_formats[n]->rate == rate
+            && audio_formats[n]->format == format) {
+            return audio_formats[n];
         }
-
-    default:
-        break;
     }
 
     return NULL;
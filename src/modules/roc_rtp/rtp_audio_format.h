@@ -15,6 +15,7 @@
 
 #include "roc_core/stddefs.h"
 #include "roc_packet/units.h"
+#include "roc_packet/iaudio_packet.h"
 #include "roc_rtp/rtp_header.h"
 
 namespace roc {
@@ -25,6 +26,9 @@ struct RTP_AudioFormat {
     //! Payload type.
     RTP_PayloadType pt;
 
+    //! Sample format.
+    packet::SampleFormat format;
+
     //! Bitmask of supported channels.
     packet::channel_mask_t channels;
 
@@ -58,8 +62,10 @@ struct RTP_AudioFormat {
 //! Get audio format from payload type.
 const RTP_AudioFormat* get_audio_format_pt(uint8_t pt);
 
-//! Get audio format from channel mask and sample rate.
-const RTP_AudioFormat* get_audio_format_cr(packet::channel_mask_t ch, size_t rate);
+//! Get audio format from channel mask, sample rate and sample format.
+const RTP_AudioFormat* get_audio_format_cr(packet::channel_mask_t ch,
+                                           size_t rate,
+                                           packet::SampleFormat format);
 
 } // namespace rtp
 } // namespace roc
@@ -28,8 +28,20 @@ enum RTP_Version {
 
 //! RTP payload type.
 enum RTP_PayloadType {
-    RTP_PT_L16_STEREO = 10, //!< Audio, 16-bit samples, 2 channels, 44100 Hz.
-    RTP_PT_L16_MONO = 11    //!< Audio, 16-bit samples, 1 channel, 44100 Hz.
+    RTP_PT_L16_STEREO = 10,     //!< Audio, 16-bit samples, 2 channels, 44100 Hz.
+    RTP_PT_L16_MONO = 11,       //!< Audio, 16-bit samples, 1 channel, 44100 Hz.
+    RTP_PT_L24_STEREO = 96,     //!< Audio, 24-bit samples, 2 channels, 44100 Hz.
+    RTP_PT_L24_MONO = 97,       //!< Audio, 24-bit samples, 1 channel, 44100 Hz.
+    RTP_PT_F32_STEREO = 98,     //!< Audio, float samples, 2 channels, 44100 Hz.
+    RTP_PT_F32_MONO = 99,       //!< Audio, float samples, 1 channel, 44100 Hz.
+    RTP_PT_L16_STEREO_48 = 100, //!< Audio, 16-bit samples, 2 channels, 48000 Hz.
+    RTP_PT_L16_MONO_48 = 101,   //!< Audio, 16-bit samples, 1 channel, 48000 Hz.
+    RTP_PT_L24_STEREO_48 = 102, //!< Audio, 24-bit samples, 2 channels, 48000 Hz.
+    RTP_PT_L24_MONO_48 = 103,   //!< Audio, 24-bit samples, 1 channel, 48000 Hz.
+    RTP_PT_F32_STEREO_48 = 104, //!< Audio, float samples, 2 channels, 48000 Hz.
+    RTP_PT_F32_MONO_48 = 105,   //!< Audio, float samples, 1 channel, 48000 Hz.
+    RTP_PT_FEC_LDPC = 123,      //!< FEC, LDPC-Staircase (dynamic).
+    RTP_PT_FEC_RS8 = 124        //!< FEC, Reed-Solomon over GF(2^8) (dynamic).
 };
 
 //! RTP header.
@@ -247,6 +259,48 @@ public:
     }
 };
 
+//! FEC payload header.
+//! @remarks
+//!  Placed at the beginning of payload of FEC packets. Carries FEC block
+//!  geometry, so that receiver doesn't need to know it in advance.
+//!
+//! @code
+//!    0             1               2               3               4
+//!    0 1 2 3 4 5 6 7 0 1 2 3 4 5 6 7 0 1 2 3 4 5 6 7 0 1 2 3 4 5 6 7
+//!   +-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+
+//!   |     number of data packets    |     number of FEC packets     |
+//!   +-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+
+//! @endcode
+class ROC_ATTR_PACKED RTP_FECHeader {
+private:
+    //! Number of data packets in block.
+    uint16_t data_blksz_;
+
+    //! Number of FEC packets in block.
+    uint16_t fec_blksz_;
+
+public:
+    //! Get number of data packets in block.
+    uint16_t data_blksz() const {
+        return ROC_NTOH_16(data_blksz_);
+    }
+
+    //! Set number of data packets in block.
+    void set_data_blksz(uint16_t sz) {
+        data_blksz_ = ROC_HTON_16(sz);
+    }
+
+    //! Get number of FEC packets in block.
+    uint16_t fec_blksz() const {
+        return ROC_NTOH_16(fec_blksz_);
+    }
+
+    //! Set number of FEC packets in block.
+    void set_fec_blksz(uint16_t sz) {
+        fec_blksz_ = ROC_HTON_16(sz);
+    }
+};
+
 } // namespace rtp
 } // namespace roc
 
@@ -0,0 +1,434 @@
+/*
+ * Copyright (c) 2015 Mikhail Baranov
+ * Copyright (c) 2015 Victor Gaydov
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <string.h>
+
+#include "roc_core/stddefs.h"
+#include "roc_core/panic.h"
+#include "roc_core/log.h"
+#include "roc_core/byte_order.h"
+#include "roc_rtp/rtp_audio_format.h"
+#include "roc_rtp/default_pcm_kernel.h"
+
+namespace roc {
+namespace rtp {
+
+using namespace packet;
+
+namespace {
+
+// 24-bit signed integer sample, big-endian.
+struct pcm_s24_t {
+    uint8_t bytes[3];
+};
+
+// 32-bit IEEE float sample, little-endian.
+//
+// Unlike integer formats, float payload isn't converted to network byte order,
+// so that little-endian hosts can copy it to and from sample buffers as is.
+struct pcm_f32_t {
+    uint8_t bytes[4];
+};
+
+bool host_is_little_endian() {
+    return ROC_HTON_16(uint16_t(1)) != 1;
+}
+
+sample_t pcm_unpack(int16_t ns) {
+    const int16_t hs = (int16_t)ROC_NTOH_16(uint16_t(ns));
+
+    return sample_t(hs) / (1 << 15);
+}
+
+sample_t pcm_unpack(const pcm_s24_t& ns) {
+    const uint32_t bits = uint32_t(ns.bytes[0]) << 24 | uint32_t(ns.bytes[1]) << 16
+        | uint32_t(ns.bytes[2]) << 8;
+
+    // Sample is placed in upper bits, so that shifting it back extends sign.
+    const int32_t hs = int32_t(bits) >> 8;
+
+    return sample_t(hs) / (1 << 23);
+}
+
+sample_t pcm_unpack(const pcm_f32_t& ns) {
+    const uint32_t bits = uint32_t(ns.bytes[0]) | uint32_t(ns.bytes[1]) << 8
+        | uint32_t(ns.bytes[2]) << 16 | uint32_t(ns.bytes[3]) << 24;
+
+    sample_t fs;
+    memcpy(&fs, &bits, sizeof(fs));
+
+    return fs;
+}
+
+template <class T> T pcm_pack(sample_t);
+
+template <> int16_t pcm_pack(sample_t fs) {
+    fs *= (1 << 15);
+
+    if (fs > 32767) {
+        fs = 32767;
+    } else if (fs < -32768) {
+        fs = -32768;
+    }
+
+    const int16_t hs = int16_t(fs);
+
+    return (int16_t)ROC_HTON_16(uint16_t(hs));
+}
+
+template <> pcm_s24_t pcm_pack(sample_t fs) {
+    fs *= (1 << 23);
+
+    if (fs > 8388607) {
+        fs = 8388607;
+    } else if (fs < -8388608) {
+        fs = -8388608;
+    }
+
+    const uint32_t hs = uint32_t(int32_t(fs));
+
+    pcm_s24_t ns;
+    ns.bytes[0] = uint8_t(hs >> 16);
+    ns.bytes[1] = uint8_t(hs >> 8);
+    ns.bytes[2] = uint8_t(hs);
+
+    return ns;
+}
+
+template <> pcm_f32_t pcm_pack(sample_t fs) {
+    uint32_t bits;
+    memcpy(&bits, &fs, sizeof(bits));
+
+    pcm_f32_t ns;
+    ns.bytes[0] = uint8_t(bits);
+    ns.bytes[1] = uint8_t(bits >> 8);
+    ns.bytes[2] = uint8_t(bits >> 16);
+    ns.bytes[3] = uint8_t(bits >> 24);
+
+    return ns;
+}
+
+// Convert contiguous run of samples.
+void pcm_decode(sample_t* samples, const int16_t* pkt_samples, size_t n) {
+    default_pcm_kernel().decode_l16(samples, pkt_samples, n);
+}
+
+void pcm_decode(sample_t* samples, const pcm_s24_t* pkt_samples, size_t n) {
+    for (size_t i = 0; i < n; i++) {
+        samples[i] = pcm_unpack(pkt_samples[i]);
+    }
+}
+
+void pcm_decode(sample_t* samples, const pcm_f32_t* pkt_samples, size_t n) {
+    if (host_is_little_endian()) {
+        memcpy(samples, pkt_samples, n * sizeof(sample_t));
+    } else {
+        for (size_t i = 0; i < n; i++) {
+            samples[i] = pcm_unpack(pkt_samples[i]);
+        }
+    }
+}
+
+void pcm_encode(int16_t* pkt_samples, const sample_t* samples, size_t n) {
+    default_pcm_kernel().encode_l16(pkt_samples, samples, n);
+}
+
+void pcm_encode(pcm_s24_t* pkt_samples, const sample_t* samples, size_t n) {
+    for (size_t i = 0; i < n; i++) {
+        pkt_samples[i] = pcm_pack<pcm_s24_t>(samples[i]);
+    }
+}
+
+void pcm_encode(pcm_f32_t* pkt_samples, const sample_t* samples, size_t n) {
+    if (host_is_little_endian()) {
+        memcpy(pkt_samples, samples, n * sizeof(sample_t));
+    } else {
+        for (size_t i = 0; i < n; i++) {
+            pkt_samples[i] = pcm_pack<pcm_f32_t>(samples[i]);
+        }
+    }
+}
+
+template <class Sample, size_t NumCh> size_t pcm_n_samples(size_t payload_size) {
+    return payload_size / NumCh / sizeof(Sample);
+}
+
+template <class Sample, size_t NumCh> size_t pcm_size(size_t n_samples) {
+    return n_samples * NumCh * sizeof(Sample);
+}
+
+template <size_t NumCh> bool pcm_full_mask(channel_mask_t ch_mask) {
+    return ch_mask == (channel_mask_t(1) << NumCh) - 1;
+}
+
+template <class Sample, size_t NumCh>
+void pcm_read(const void* payload,
+              size_t offset,
+              channel_mask_t ch_mask,
+              sample_t* samples,
+              size_t n_samples) {
+    roc_panic_if_not(payload);
+    roc_panic_if_not(samples);
+
+    const Sample* pkt_samples = (const Sample*)payload + (offset * NumCh);
+
+    // Requested channels match packet layout, convert whole run at once.
+    if (pcm_full_mask<NumCh>(ch_mask)) {
+        pcm_decode(samples, pkt_samples, n_samples * NumCh);
+        return;
+    }
+
+    for (size_t ns = 0; ns < n_samples; ns++) {
+        channel_mask_t mask = ch_mask;
+
+        for (size_t ch = 0; mask; ch++, mask >>= 1) {
+            if (mask & 1) {
+                switch (ch) {
+                case 0:
+                case 1:
+                    *samples = pcm_unpack(pkt_samples[ch % NumCh]);
+                    break;
+
+                default:
+                    *samples = 0;
+                    break;
+                }
+
+                samples++;
+            }
+        }
+
+        pkt_samples += NumCh;
+    }
+}
+
+template <class Sample, size_t NumCh>
+void pcm_write(void* payload,
+               size_t offset,
+               channel_mask_t ch_mask,
+               const sample_t* samples,
+               size_t n_samples) {
+    roc_panic_if_not(payload);
+    roc_panic_if_not(samples);
+
+    Sample* pkt_samples = (Sample*)payload + (offset * NumCh);
+
+    // Provided channels match packet layout, convert whole run at once.
+    if (pcm_full_mask<NumCh>(ch_mask)) {
+        pcm_encode(pkt_samples, samples, n_samples * NumCh);
+        return;
+    }
+
+    for (size_t ns = 0; ns < n_samples; ns++) {
+        channel_mask_t mask = ch_mask;
+
+        for (size_t ch = 0; mask; ch++, mask >>= 1) {
+            if (mask & 1) {
+                if (ch < NumCh) {
+                    pkt_samples[ch] = pcm_pack<Sample>(*samples);
+                }
+
+                samples++;
+            }
+        }
+
+        pkt_samples += NumCh;
+    }
+}
+
+template <class Sample, size_t NumCh> void pcm_clear(void* payload, size_t n_samples) {
+    roc_panic_if_not(payload);
+
+    memset(payload, 0, pcm_size<Sample, NumCh>(n_samples));
+}
+
+} // namespace
+
+extern const RTP_AudioFormat RTP_AudioFormat_L16_Stereo;
+
+const RTP_AudioFormat RTP_AudioFormat_L16_Stereo = {
+    //
+    RTP_PT_L16_STEREO,         //
+    Sample_L16,                //
+    0x3,                       //
+    44100,                     //
+    pcm_n_samples<int16_t, 2>, //
+    pcm_size<int16_t, 2>,      //
+    pcm_read<int16_t, 2>,      //
+    pcm_write<int16_t, 2>,     //
+    pcm_clear<int16_t, 2>      //
+};
+
+extern const RTP_AudioFormat RTP_AudioFormat_L16_Mono;
+
+const RTP_AudioFormat RTP_AudioFormat_L16_Mono = {
+    //
+    RTP_PT_L16_MONO,           //
+    Sample_L16,                //
+    0x1,                       //
+    44100,                     //
+    pcm_n_samples<int16_t, 1>, //
+    pcm_size<int16_t, 1>,      //
+    pcm_read<int16_t, 1>,      //
+    pcm_write<int16_t, 1>,     //
+    pcm_clear<int16_t, 1>      //
+};
+
+extern const RTP_AudioFormat RTP_AudioFormat_L24_Stereo;
+
+const RTP_AudioFormat RTP_AudioFormat_L24_Stereo = {
+    //
+    RTP_PT_L24_STEREO,           //
+    Sample_L24,                  //
+    0x3,                         //
+    44100,                       //
+    pcm_n_samples<pcm_s24_t, 2>, //
+    pcm_size<pcm_s24_t, 2>,      //
+    pcm_read<pcm_s24_t, 2>,      //
+    pcm_write<pcm_s24_t, 2>,     //
+    pcm_clear<pcm_s24_t, 2>      //
+};
+
+extern const RTP_AudioFormat RTP_AudioFormat_L24_Mono;
+
+const RTP_AudioFormat RTP_AudioFormat_L24_Mono = {
+    //
+    RTP_PT_L24_MONO,             //
+    Sample_L24,                  //
+    0x1,                         //
+    44100,                       //
+    pcm_n_samples<pcm_s24_t, 1>, //
+    pcm_size<pcm_s24_t, 1>,      //
+    pcm_read<pcm_s24_t, 1>,      //
+    pcm_write<pcm_s24_t, 1>,     //
+    pcm_clear<pcm_s24_t, 1>      //
+};
+
+extern const RTP_AudioFormat RTP_AudioFormat_F32_Stereo;
+
+const RTP_AudioFormat RTP_AudioFormat_F32_Stereo = {
+    //
+    RTP_PT_F32_STEREO,           //
+    Sample_Float32,              //
+    0x3,                         //
+    44100,                       //
+    pcm_n_samples<pcm_f32_t, 2>, //
+    pcm_size<pcm_f32_t, 2>,      //
+    pcm_read<pcm_f32_t, 2>,      //
+    pcm_write<pcm_f32_t, 2>,     //
+    pcm_clear<pcm_f32_t, 2>      //
+};
+
+extern const RTP_AudioFormat RTP_AudioFormat_F32_Mono;
+
+const RTP_AudioFormat RTP_AudioFormat_F32_Mono = {
+    //
+    RTP_PT_F32_MONO,             //
+    Sample_Float32,              //
+    0x1,                         //
+    44100,                       //
+    pcm_n_samples<pcm_f32_t, 1>, //
+    pcm_size<pcm_f32_t, 1>,      //
+    pcm_read<pcm_f32_t, 1>,      //
+    pcm_write<pcm_f32_t, 1>,     //
+    pcm_clear<pcm_f32_t, 1>      //
+};
+
+extern const RTP_AudioFormat RTP_AudioFormat_L16_Stereo_48;
+
+const RTP_AudioFormat RTP_AudioFormat_L16_Stereo_48 = {
+    //
+    RTP_PT_L16_STEREO_48,      //
+    Sample_L16,                //
+    0x3,                       //
+    48000,                     //
+    pcm_n_samples<int16_t, 2>, //
+    pcm_size<int16_t, 2>,      //
+    pcm_read<int16_t, 2>,      //
+    pcm_write<int16_t, 2>,     //
+    pcm_clear<int16_t, 2>      //
+};
+
+extern const RTP_AudioFormat RTP_AudioFormat_L16_Mono_48;
+
+const RTP_AudioFormat RTP_AudioFormat_L16_Mono_48 = {
+    //
+    RTP_PT_L16_MONO_48,        //
+    Sample_L16,                //
+    0x1,                       //
+    48000,                     //
+    pcm_n_samples<int16_t, 1>, //
+    pcm_size<int16_t, 1>,      //
+    pcm_read<int16_t, 1>,      //
+    pcm_write<int16_t, 1>,     //
+    pcm_clear<int16_t, 1>      //
+};
+
+extern const RTP_AudioFormat RTP_AudioFormat_L24_Stereo_48;
+
+const RTP_AudioFormat RTP_AudioFormat_L24_Stereo_48 = {
+    //
+    RTP_PT_L24_STEREO_48,        //
+    Sample_L24,                  //
+    0x3,                         //
+    48000,                       //
+    pcm_n_samples<pcm_s24_t, 2>, //
+    pcm_size<pcm_s24_t, 2>,      //
+    pcm_read<pcm_s24_t, 2>,      //
+    pcm_write<pcm_s24_t, 2>,     //
+    pcm_clear<pcm_s24_t, 2>      //
+};
+
+extern const RTP_AudioFormat RTP_AudioFormat_L24_Mono_48;
+
+const RTP_AudioFormat RTP_AudioFormat_L24_Mono_48 = {
+    //
+    RTP_PT_L24_MONO_48,          //
+    Sample_L24,                  //
+    0x1,                         //
+    48000,                       //
+    pcm_n_samples<pcm_s24_t, 1>, //
+    pcm_size<pcm_s24_t, 1>,      //
+    pcm_read<pcm_s24_t, 1>,      //
+    pcm_write<pcm_s24_t, 1>,     //
+    pcm_clear<pcm_s24_t, 1>      //
+};
+
+extern const RTP_AudioFormat RTP_AudioFormat_F32_Stereo_48;
+
+const RTP_AudioFormat RTP_AudioFormat_F32_Stereo_48 = {
+    //
+    RTP_PT_F32_STEREO_48,        //
+    Sample_Float32,              //
+    0x3,                         //
+    48000,                       //
+    pcm_n_samples<pcm_f32_t, 2>, //
+    pcm_size<pcm_f32_t, 2>,      //
+    pcm_read<pcm_f32_t, 2>,      //
+    pcm_write<pcm_f32_t, 2>,     //
+    pcm_clear<pcm_f32_t, 2>      //
+};
+
+extern const RTP_AudioFormat RTP_AudioFormat_F32_Mono_48;
+
+const RTP_AudioFormat RTP_AudioFormat_F32_Mono_48 = {
+    //
+    RTP_PT_F32_MONO_48,          //
+    Sample_Float32,              //
+    0x1,                         //
+    48000,                       //
+    pcm_n_samples<pcm_f32_t, 1>, //
+    pcm_size<pcm_f32_t, 1>,      //
+    pcm_read<pcm_f32_t, 1>,      //
+    pcm_write<pcm_f32_t, 1>,     //
+    pcm_clear<pcm_f32_t, 1>      //
+};
+
+} // namespace rtp
+} // namespace roc
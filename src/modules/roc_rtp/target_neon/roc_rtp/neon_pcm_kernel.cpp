@@ -0,0 +1,82 @@
+/*
+ * Copyright (c) 2015 Mikhail Baranov
+ * Copyright (c) 2015 Victor Gaydov
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <arm_neon.h>
+
+#include "roc_core/byte_order.h"
+#include "roc_rtp/neon_pcm_kernel.h"
+
+namespace roc {
+namespace rtp {
+
+using packet::sample_t;
+
+namespace {
+
+// Swap bytes in every 16-bit lane.
+inline int16x8_t swap16(int16x8_t v) {
+    return vreinterpretq_s16_u8(vrev16q_u8(vreinterpretq_u8_s16(v)));
+}
+
+} // namespace
+
+const char* NEONPCMKernel::name() const {
+    return "neon";
+}
+
+void NEONPCMKernel::decode_l16(sample_t* out, const int16_t* in, size_t n) const {
+    const float scale = 1.0f / (1 << 15);
+
+    size_t k = 0;
+
+    for (; k + 8 <= n; k += 8) {
+        const int16x8_t v = swap16(vld1q_s16(in + k));
+
+        const int32x4_t lo = vmovl_s16(vget_low_s16(v));
+        const int32x4_t hi = vmovl_s16(vget_high_s16(v));
+
+        vst1q_f32(out + k, vmulq_n_f32(vcvtq_f32_s32(lo), scale));
+        vst1q_f32(out + k + 4, vmulq_n_f32(vcvtq_f32_s32(hi), scale));
+    }
+
+    for (; k < n; k++) {
+        const int16_t hs = (int16_t)ROC_NTOH_16(uint16_t(in[k]));
+        out[k] = sample_t(hs) / (1 << 15);
+    }
+}
+
+void NEONPCMKernel::encode_l16(int16_t* out, const sample_t* in, size_t n) const {
+    const float32x4_t vmax = vdupq_n_f32(32767);
+    const float32x4_t vmin = vdupq_n_f32(-32768);
+
+    size_t k = 0;
+
+    for (; k + 8 <= n; k += 8) {
+        const float32x4_t a = vmulq_n_f32(vld1q_f32(in + k), 1 << 15);
+        const float32x4_t b = vmulq_n_f32(vld1q_f32(in + k + 4), 1 << 15);
+
+        const int32x4_t ia = vcvtq_s32_f32(vmaxq_f32(vminq_f32(a, vmax), vmin));
+        const int32x4_t ib = vcvtq_s32_f32(vmaxq_f32(vminq_f32(b, vmax), vmin));
+
+        vst1q_s16(out + k, swap16(vcombine_s16(vqmovn_s32(ia), vqmovn_s32(ib))));
+    }
+
+    for (; k < n; k++) {
+        sample_t fs = in[k] * (1 << 15);
+        if (fs > 32767) {
+            fs = 32767;
+        } else if (fs < -32768) {
+            fs = -32768;
+        }
+        out[k] = (int16_t)ROC_HTON_16(uint16_t(int16_t(fs)));
+    }
+}
+
+} // namespace rtp
+} // namespace roc
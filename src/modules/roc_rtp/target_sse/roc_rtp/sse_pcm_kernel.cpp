@@ -0,0 +1,84 @@
+/*
+ * Copyright (c) 2015 Mikhail Baranov
+ * Copyright (c) 2015 Victor Gaydov
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <emmintrin.h>
+
+#include "roc_core/byte_order.h"
+#include "roc_rtp/sse_pcm_kernel.h"
+
+namespace roc {
+namespace rtp {
+
+using packet::sample_t;
+
+namespace {
+
+// Swap bytes in every 16-bit lane.
+inline __m128i swap16(__m128i v) {
+    return _mm_or_si128(_mm_slli_epi16(v, 8), _mm_srli_epi16(v, 8));
+}
+
+} // namespace
+
+const char* SSE2PCMKernel::name() const {
+    return "sse2";
+}
+
+void SSE2PCMKernel::decode_l16(sample_t* out, const int16_t* in, size_t n) const {
+    const __m128 scale = _mm_set1_ps(1.0f / (1 << 15));
+
+    size_t k = 0;
+
+    for (; k + 8 <= n; k += 8) {
+        const __m128i v = swap16(_mm_loadu_si128((const __m128i*)(in + k)));
+
+        // Sign-extend to 32 bits by placing each sample in high half of lane.
+        const __m128i lo = _mm_srai_epi32(_mm_unpacklo_epi16(v, v), 16);
+        const __m128i hi = _mm_srai_epi32(_mm_unpackhi_epi16(v, v), 16);
+
+        _mm_storeu_ps(out + k, _mm_mul_ps(_mm_cvtepi32_ps(lo), scale));
+        _mm_storeu_ps(out + k + 4, _mm_mul_ps(_mm_cvtepi32_ps(hi), scale));
+    }
+
+    for (; k < n; k++) {
+        const int16_t hs = (int16_t)ROC_NTOH_16(uint16_t(in[k]));
+        out[k] = sample_t(hs) / (1 << 15);
+    }
+}
+
+void SSE2PCMKernel::encode_l16(int16_t* out, const sample_t* in, size_t n) const {
+    const __m128 scale = _mm_set1_ps(1 << 15);
+    const __m128 vmax = _mm_set1_ps(32767);
+    const __m128 vmin = _mm_set1_ps(-32768);
+
+    size_t k = 0;
+
+    for (; k + 8 <= n; k += 8) {
+        const __m128 a = _mm_mul_ps(_mm_loadu_ps(in + k), scale);
+        const __m128 b = _mm_mul_ps(_mm_loadu_ps(in + k + 4), scale);
+
+        const __m128i ia = _mm_cvttps_epi32(_mm_max_ps(_mm_min_ps(a, vmax), vmin));
+        const __m128i ib = _mm_cvttps_epi32(_mm_max_ps(_mm_min_ps(b, vmax), vmin));
+
+        _mm_storeu_si128((__m128i*)(out + k), swap16(_mm_packs_epi32(ia, ib)));
+    }
+
+    for (; k < n; k++) {
+        sample_t fs = in[k] * (1 << 15);
+        if (fs > 32767) {
+            fs = 32767;
+        } else if (fs < -32768) {
+            fs = -32768;
+        }
+        out[k] = (int16_t)ROC_HTON_16(uint16_t(int16_t(fs)));
+    }
+}
+
+} // namespace rtp
+} // namespace roc
@@ -0,0 +1,19 @@
+/*
+ * Copyright (c) 2015 Mikhail Baranov
+ * Copyright (c) 2015 Victor Gaydov
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "roc_rtp/ipcm_kernel.h"
+
+namespace roc {
+namespace rtp {
+
+IPCMKernel::~IPCMKernel() {
+}
+
+} // namespace rtp
+} // namespace roc
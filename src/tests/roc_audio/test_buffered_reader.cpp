@@ -0,0 +1,93 @@
+/*
+ * Copyright (c) 2015 Mikhail Baranov
+ * Copyright (c) 2015 Victor Gaydov
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <CppUTest/TestHarness.h>
+
+#include "roc_core/scoped_ptr.h"
+
+#include "roc_audio/buffered_reader.h"
+
+#include "test_stream_reader.h"
+#include "test_helpers.h"
+
+namespace roc {
+namespace test {
+
+using namespace audio;
+
+namespace {
+
+enum { BufSz = 100, MaxSamples = 1000 };
+
+} // namespace
+
+TEST_GROUP(buffered_reader) {
+    TestStreamReader<MaxSamples> input;
+
+    core::ScopedPtr<BufferedReader> reader;
+
+    void setup() {
+        reader.reset(new BufferedReader(input));
+    }
+};
+
+TEST(buffered_reader, no_fill) {
+    input.add(BufSz, 11);
+    input.add(BufSz, 22);
+
+    read_buffers<MaxSamples>(*reader, 1, BufSz, 11);
+    read_buffers<MaxSamples>(*reader, 1, BufSz, 22);
+}
+
+TEST(buffered_reader, fill) {
+    input.add(BufSz, 11);
+
+    reader->fill(BufSz);
+
+    // Input is already read, so adding more samples doesn't affect output.
+    input.add(BufSz, 22);
+
+    read_buffers<MaxSamples>(*reader, 1, BufSz, 11);
+    read_buffers<MaxSamples>(*reader, 1, BufSz, 22);
+}
+
+TEST(buffered_reader, fill_and_read_in_parts) {
+    input.add(BufSz, 11);
+
+    reader->fill(BufSz);
+
+    read_buffers<MaxSamples>(*reader, 4, BufSz / 4, 11);
+}
+
+TEST(buffered_reader, read_more_than_filled) {
+    input.add(BufSz / 2, 11);
+    input.add(BufSz / 2, 22);
+
+    reader->fill(BufSz / 2);
+
+    ISampleBufferPtr buf = new_buffer<MaxSamples>(BufSz);
+    reader->read(*buf);
+
+    expect_data(buf->data(), BufSz / 2, 11);
+    expect_data(buf->data() + BufSz / 2, BufSz / 2, 22);
+}
+
+TEST(buffered_reader, refill) {
+    input.add(BufSz, 11);
+    input.add(BufSz, 22);
+
+    reader->fill(BufSz);
+    read_buffers<MaxSamples>(*reader, 1, BufSz, 11);
+
+    reader->fill(BufSz);
+    read_buffers<MaxSamples>(*reader, 1, BufSz, 22);
+}
+
+} // namespace test
+} // namespace roc
@@ -28,6 +28,7 @@ enum { BufSz = 100, MaxSamples = 1000 };
 TEST_GROUP(mixer) {
     TestStreamReader<MaxSamples> reader1;
     TestStreamReader<MaxSamples> reader2;
+    TestStreamReader<MaxSamples> reader3;
 
     Mixer mixer;
 
@@ -36,6 +37,18 @@ TEST_GROUP(mixer) {
     }
 };
 
+TEST(mixer, three_readers) {
+    mixer.add(reader1);
+    mixer.add(reader2);
+    mixer.add(reader3);
+
+    reader1.add(BufSz, 111);
+    reader2.add(BufSz, 222);
+    reader3.add(BufSz, 333);
+
+    expect_output(BufSz, 666);
+}
+
 TEST(mixer, no_readers) {
     expect_output(BufSz, 0);
 }
@@ -79,5 +92,37 @@ TEST(mixer, remove_reader) {
     expect_output(BufSz, 0);
 }
 
+TEST(mixer, clipping_disabled) {
+    mixer.add(reader1);
+    mixer.add(reader2);
+
+    reader1.add(BufSz, 1);
+    reader2.add(BufSz, 1);
+    expect_output(BufSz, 2);
+
+    reader1.add(BufSz, -1);
+    reader2.add(BufSz, -1);
+    expect_output(BufSz, -2);
+}
+
+TEST(mixer, clipping_enabled) {
+    Mixer clipping_mixer(default_buffer_composer(), true);
+
+    clipping_mixer.add(reader1);
+    clipping_mixer.add(reader2);
+
+    reader1.add(BufSz, 1);
+    reader2.add(BufSz, 1);
+    read_buffers<MaxSamples>(clipping_mixer, 1, BufSz, 1);
+
+    reader1.add(BufSz, -1);
+    reader2.add(BufSz, -1);
+    read_buffers<MaxSamples>(clipping_mixer, 1, BufSz, -1);
+
+    reader1.add(BufSz, 1);
+    reader2.add(BufSz, -1);
+    read_buffers<MaxSamples>(clipping_mixer, 1, BufSz, 0);
+}
+
 } // namespace test
 } // namespace roc
@@ -0,0 +1,113 @@
+/*
+ * Copyright (c) 2015 Mikhail Baranov
+ * Copyright (c) 2015 Victor Gaydov
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <CppUTest/TestHarness.h>
+
+#include "roc_core/random.h"
+
+#include "roc_audio/generic_mixer_kernel.h"
+#include "roc_audio/default_mixer_kernel.h"
+
+namespace roc {
+namespace test {
+
+using namespace audio;
+
+using packet::sample_t;
+
+namespace {
+
+// Not multiple of vector width, to cover tail loops.
+enum { NumSamples = 259, MaxChannels = 8 };
+
+sample_t random_sample() {
+    return (sample_t)core::random(0, 40000) / 10000.0f - 2.0f;
+}
+
+} // namespace
+
+TEST_GROUP(mixer_kernel) {
+    sample_t in[NumSamples * MaxChannels];
+    sample_t out[NumSamples * MaxChannels];
+
+    void setup() {
+        for (size_t n = 0; n < NumSamples * MaxChannels; n++) {
+            in[n] = random_sample();
+            out[n] = random_sample();
+        }
+    }
+
+    void check_mix(IMixerKernel & kernel) {
+        sample_t expected[NumSamples];
+        for (size_t n = 0; n < NumSamples; n++) {
+            expected[n] = out[n] + in[n];
+        }
+
+        kernel.mix(out, in, NumSamples);
+
+        for (size_t n = 0; n < NumSamples; n++) {
+            DOUBLES_EQUAL(expected[n], out[n], 0);
+        }
+    }
+
+    void check_clip(IMixerKernel & kernel) {
+        sample_t expected[NumSamples];
+        for (size_t n = 0; n < NumSamples; n++) {
+            expected[n] = out[n] > 1 ? 1 : out[n] < -1 ? -1 : out[n];
+        }
+
+        kernel.clip(out, NumSamples);
+
+        for (size_t n = 0; n < NumSamples; n++) {
+            DOUBLES_EQUAL(expected[n], out[n], 0);
+        }
+    }
+
+    void check_interleave(IMixerKernel & kernel) {
+        for (size_t num_ch = 1; num_ch <= MaxChannels; num_ch++) {
+            kernel.interleave(out, in, num_ch, NumSamples);
+
+            for (size_t ch = 0; ch < num_ch; ch++) {
+                for (size_t n = 0; n < NumSamples; n++) {
+                    DOUBLES_EQUAL(in[ch * NumSamples + n], out[n * num_ch + ch], 0);
+                }
+            }
+        }
+    }
+};
+
+TEST(mixer_kernel, generic_mix) {
+    GenericMixerKernel kernel;
+    check_mix(kernel);
+}
+
+TEST(mixer_kernel, generic_clip) {
+    GenericMixerKernel kernel;
+    check_clip(kernel);
+}
+
+TEST(mixer_kernel, generic_interleave) {
+    GenericMixerKernel kernel;
+    check_interleave(kernel);
+}
+
+TEST(mixer_kernel, default_mix) {
+    check_mix(default_mixer_kernel());
+}
+
+TEST(mixer_kernel, default_clip) {
+    check_clip(default_mixer_kernel());
+}
+
+TEST(mixer_kernel, default_interleave) {
+    check_interleave(default_mixer_kernel());
+}
+
+} // namespace test
+} // namespace roc
@@ -0,0 +1,114 @@
+/*
+ * Copyright (c) 2015 Mikhail Baranov
+ * Copyright (c) 2015 Victor Gaydov
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <CppUTest/TestHarness.h>
+
+#include "roc_config/config.h"
+#include "roc_core/log.h"
+#include "roc_core/time.h"
+#include "roc_core/random.h"
+
+#include "roc_audio/mixer.h"
+#include "roc_audio/generic_mixer_kernel.h"
+#include "roc_audio/default_mixer_kernel.h"
+
+namespace roc {
+namespace test {
+
+using namespace audio;
+
+using packet::sample_t;
+
+namespace {
+
+enum {
+    // Number of samples in mixed buffer, same as server tick.
+    BufSz = ROC_CONFIG_DEFAULT_SERVER_TICK_SAMPLES,
+
+    // Number of mixed buffers.
+    NumIterations = 20000,
+
+    // Maximum number of mixed sessions.
+    MaxSessions = 64
+};
+
+// Reads same samples every time.
+class ConstReader : public IStreamReader {
+public:
+    ConstReader() {
+        for (size_t n = 0; n < BufSz; n++) {
+            samples_[n] = (sample_t)core::random(0, 20000) / 10000.0f - 1.0f;
+        }
+    }
+
+    virtual void read(const ISampleBufferSlice& buffer) {
+        CHECK(buffer.size() <= BufSz);
+
+        memcpy(buffer.data(), samples_, buffer.size() * sizeof(sample_t));
+    }
+
+private:
+    sample_t samples_[BufSz];
+};
+
+} // namespace
+
+TEST_GROUP(mixer_load) {
+    ConstReader readers[MaxSessions];
+
+    // Mixes given number of sessions NumIterations times and returns time per
+    // mixed buffer, in microseconds.
+    double run(IMixerKernel & kernel, size_t n_sessions, bool clipping) {
+        Mixer mixer(default_buffer_composer(), clipping, kernel);
+
+        for (size_t n = 0; n < n_sessions; n++) {
+            mixer.add(readers[n]);
+        }
+
+        ISampleBufferPtr buffer = default_buffer_composer().compose();
+        CHECK(buffer);
+
+        buffer->set_size(BufSz);
+
+        const uint64_t start = core::timestamp_us();
+
+        for (size_t n = 0; n < NumIterations; n++) {
+            mixer.read(*buffer);
+        }
+
+        return double(core::timestamp_us() - start) / NumIterations;
+    }
+
+    void report(bool clipping) {
+        GenericMixerKernel generic_kernel;
+        IMixerKernel& kernel = default_mixer_kernel();
+
+        for (size_t n_sessions = 1; n_sessions <= MaxSessions; n_sessions *= 2) {
+            const double generic_us = run(generic_kernel, n_sessions, clipping);
+            const double kernel_us = run(kernel, n_sessions, clipping);
+
+            roc_log(LOG_DEBUG,
+                    "mixer load: sessions=%u clipping=%d"
+                    " generic=%.2fus %s=%.2fus per %u samples",
+                    (unsigned)n_sessions, (int)clipping, generic_us, kernel.name(),
+                    kernel_us, (unsigned)BufSz);
+        }
+    }
+};
+
+TEST(mixer_load, sessions) {
+    report(false);
+}
+
+TEST(mixer_load, sessions_clipping) {
+    report(true);
+}
+
+} // namespace test
+} // namespace roc
@@ -0,0 +1,78 @@
+/*
+ * Copyright (c) 2015 Mikhail Baranov
+ * Copyright (c) 2015 Victor Gaydov
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <CppUTest/TestHarness.h>
+
+#include "roc_audio/polyphase_bank.h"
+#include "roc_audio/sinc_table.h"
+
+namespace roc {
+namespace test {
+
+using namespace audio;
+
+TEST_GROUP(polyphase_bank) {};
+
+TEST(polyphase_bank, valid_num_phases) {
+    CHECK(!PolyphaseBank::valid_num_phases(0));
+    CHECK(!PolyphaseBank::valid_num_phases(PolyphaseBank::MinPhases / 2));
+    CHECK(!PolyphaseBank::valid_num_phases(PolyphaseBank::MaxPhases * 2));
+    CHECK(!PolyphaseBank::valid_num_phases(1000));
+
+    CHECK(PolyphaseBank::valid_num_phases(PolyphaseBank::MinPhases));
+    CHECK(PolyphaseBank::valid_num_phases(PolyphaseBank::MaxPhases));
+    CHECK(PolyphaseBank::valid_num_phases(256));
+    CHECK(PolyphaseBank::valid_num_phases(1024));
+}
+
+TEST(polyphase_bank, shared_instance) {
+    const PolyphaseBank& bank1 = PolyphaseBank::instance(256);
+    const PolyphaseBank& bank2 = PolyphaseBank::instance(256);
+    const PolyphaseBank& bank3 = PolyphaseBank::instance(1024);
+
+    CHECK(&bank1 == &bank2);
+    CHECK(&bank1 != &bank3);
+
+    LONGS_EQUAL(256, bank1.num_phases());
+    LONGS_EQUAL(1024, bank3.num_phases());
+}
+
+TEST(polyphase_bank, zero_phase) {
+    PolyphaseBank bank(PolyphaseBank::MinPhases);
+
+    const float* taps = bank.taps(0);
+
+    for (size_t j = 0; j < PolyphaseBank::HalfWindow; j++) {
+        const size_t distance = PolyphaseBank::HalfWindow - 1 - j;
+        DOUBLES_EQUAL(sinc_table[distance * st_Nwindow_interp], taps[j], 1e-6);
+    }
+
+    for (size_t j = 0; j < PolyphaseBank::HalfWindow; j++) {
+        const size_t distance = j + 1;
+        const float expected = distance * st_Nwindow_interp < 4098
+            ? sinc_table[distance * st_Nwindow_interp]
+            : 0;
+        DOUBLES_EQUAL(expected, taps[PolyphaseBank::HalfWindow + j], 1e-6);
+    }
+}
+
+TEST(polyphase_bank, half_phase) {
+    PolyphaseBank bank(PolyphaseBank::MinPhases);
+
+    const float* taps = bank.taps(PolyphaseBank::MinPhases / 2);
+
+    // Output sample is exactly between two input samples, so taps are symmetric.
+    for (size_t j = 0; j < PolyphaseBank::HalfWindow; j++) {
+        DOUBLES_EQUAL(taps[PolyphaseBank::HalfWindow - 1 - j],
+                      taps[PolyphaseBank::HalfWindow + j], 1e-6);
+    }
+}
+
+} // namespace test
+} // namespace roc
@@ -12,6 +12,8 @@
 #include "roc_config/config.h"
 #include "roc_core/scoped_ptr.h"
 #include "roc_audio/resampler.h"
+#include "roc_audio/generic_resampler_kernel.h"
+#include "roc_audio/polyphase_bank.h"
 
 #include "test_stream_reader.h"
 
@@ -26,6 +28,89 @@ enum { FrameSize = ROC_CONFIG_DEFAULT_RESAMPLER_FRAME_SAMPLES * 2 - 1 };
 
 enum { OutSamples = FrameSize * 100 + 1, InSamples = OutSamples + (FrameSize * 3) };
 
+// Generates sine with frequency (freq * (ch + 1)) for every channel ch.
+class SineReader : public IStreamReader {
+public:
+    SineReader(double freq = 0.05, size_t num_channels = 1)
+        : freq_(freq)
+        , num_channels_(num_channels)
+        , pos_(0) {
+    }
+
+    virtual void read(const ISampleBufferSlice& out) {
+        for (size_t n = 0; n < out.size(); n++) {
+            const size_t ch = n % num_channels_;
+            out.data()[n] =
+                (packet::sample_t)sin(freq_ * double(ch + 1) * double(pos_));
+            if (ch == num_channels_ - 1) {
+                pos_++;
+            }
+        }
+    }
+
+private:
+    const double freq_;
+    const size_t num_channels_;
+    size_t pos_;
+};
+
+void compare_kernels(float scaling) {
+    SineReader generic_reader;
+    SineReader default_reader;
+
+    GenericResamplerKernel generic_kernel;
+
+    Resampler generic_resampler(generic_reader, default_buffer_composer(), FrameSize,
+                                generic_kernel);
+
+    Resampler default_resampler(default_reader, default_buffer_composer(), FrameSize);
+
+    CHECK(generic_resampler.set_scaling(scaling));
+    CHECK(default_resampler.set_scaling(scaling));
+
+    enum { BufSz = FrameSize + 1, NumBufs = OutSamples / BufSz };
+
+    for (size_t n = 0; n < NumBufs; n++) {
+        ISampleBufferPtr generic_buf = new_buffer<BufSz>(BufSz);
+        ISampleBufferPtr default_buf = new_buffer<BufSz>(BufSz);
+
+        generic_resampler.read(*generic_buf);
+        default_resampler.read(*default_buf);
+
+        for (size_t i = 0; i < BufSz; i++) {
+            DOUBLES_EQUAL(generic_buf->data()[i], default_buf->data()[i], 0.0001);
+        }
+    }
+}
+
+void compare_polyphase(float scaling, size_t num_phases, double epsilon) {
+    SineReader sinc_reader;
+    SineReader polyphase_reader;
+
+    Resampler sinc_resampler(sinc_reader, default_buffer_composer(), FrameSize);
+
+    Resampler polyphase_resampler(polyphase_reader, default_buffer_composer(),
+                                  FrameSize, default_resampler_kernel(),
+                                  &PolyphaseBank::instance(num_phases));
+
+    CHECK(sinc_resampler.set_scaling(scaling));
+    CHECK(polyphase_resampler.set_scaling(scaling));
+
+    enum { BufSz = FrameSize + 1, NumBufs = OutSamples / BufSz };
+
+    for (size_t n = 0; n < NumBufs; n++) {
+        ISampleBufferPtr sinc_buf = new_buffer<BufSz>(BufSz);
+        ISampleBufferPtr polyphase_buf = new_buffer<BufSz>(BufSz);
+
+        sinc_resampler.read(*sinc_buf);
+        polyphase_resampler.read(*polyphase_buf);
+
+        for (size_t i = 0; i < BufSz; i++) {
+            DOUBLES_EQUAL(sinc_buf->data()[i], polyphase_buf->data()[i], epsilon);
+        }
+    }
+}
+
 } // namespace
 
 TEST_GROUP(resampler) {
@@ -68,5 +153,129 @@ TEST(resampler, no_scaling_multiple_reads) {
     }
 }
 
+TEST(resampler, default_kernel_no_scaling) {
+    compare_kernels(1.0f);
+}
+
+TEST(resampler, default_kernel_upscaling) {
+    compare_kernels(0.97f);
+}
+
+TEST(resampler, default_kernel_downscaling) {
+    compare_kernels(1.03f);
+}
+
+TEST(resampler, polyphase_no_scaling) {
+    compare_polyphase(1.0f, 1024, 0.0001);
+}
+
+TEST(resampler, polyphase_upscaling) {
+    compare_polyphase(0.97f, 1024, 0.0001);
+}
+
+TEST(resampler, polyphase_downscaling) {
+    compare_polyphase(1.03f, 1024, 0.0001);
+}
+
+TEST(resampler, polyphase_min_phases) {
+    compare_polyphase(0.99f, PolyphaseBank::MinPhases, 0.005);
+}
+
+TEST(resampler, read_size_independent) {
+    enum { SmallBufSz = 1, LargeBufSz = FrameSize * 2 + 3 };
+
+    SineReader small_reader;
+    SineReader large_reader;
+
+    Resampler small_resampler(small_reader, default_buffer_composer(), FrameSize);
+    Resampler large_resampler(large_reader, default_buffer_composer(), FrameSize);
+
+    CHECK(small_resampler.set_scaling(0.98f));
+    CHECK(large_resampler.set_scaling(0.98f));
+
+    for (size_t n = 0; n < OutSamples / LargeBufSz; n++) {
+        ISampleBufferPtr large_buf = new_buffer<LargeBufSz>(LargeBufSz);
+        large_resampler.read(*large_buf);
+
+        for (size_t i = 0; i < LargeBufSz; i++) {
+            ISampleBufferPtr small_buf = new_buffer<SmallBufSz>(SmallBufSz);
+            small_resampler.read(*small_buf);
+
+            DOUBLES_EQUAL(large_buf->data()[i], small_buf->data()[0], 0);
+        }
+    }
+}
+
+TEST(resampler, multichannel) {
+    enum { NumCh = 2, BufSz = FrameSize + 1 };
+
+    SineReader mono_reader0(0.05);
+    SineReader mono_reader1(0.10);
+    SineReader stereo_reader(0.05, NumCh);
+
+    Resampler mono_resampler0(mono_reader0, default_buffer_composer(), FrameSize);
+    Resampler mono_resampler1(mono_reader1, default_buffer_composer(), FrameSize);
+
+    Resampler stereo_resampler(stereo_reader, default_buffer_composer(), FrameSize,
+                               default_resampler_kernel(), NULL, NumCh);
+
+    CHECK(mono_resampler0.set_scaling(0.97f));
+    CHECK(mono_resampler1.set_scaling(0.97f));
+    CHECK(stereo_resampler.set_scaling(0.97f));
+
+    for (size_t n = 0; n < OutSamples / BufSz; n++) {
+        ISampleBufferPtr mono_buf0 = new_buffer<BufSz>(BufSz);
+        ISampleBufferPtr mono_buf1 = new_buffer<BufSz>(BufSz);
+        ISampleBufferPtr stereo_buf = new_buffer<BufSz * NumCh>(BufSz * NumCh);
+
+        mono_resampler0.read(*mono_buf0);
+        mono_resampler1.read(*mono_buf1);
+        stereo_resampler.read(*stereo_buf);
+
+        for (size_t i = 0; i < BufSz; i++) {
+            DOUBLES_EQUAL(mono_buf0->data()[i], stereo_buf->data()[i * NumCh], 0.0001);
+            DOUBLES_EQUAL(mono_buf1->data()[i], stereo_buf->data()[i * NumCh + 1],
+                          0.0001);
+        }
+    }
+}
+
+TEST(resampler, multichannel_polyphase) {
+    enum { NumCh = 2, BufSz = FrameSize + 1 };
+
+    const PolyphaseBank& bank = PolyphaseBank::instance(256);
+
+    SineReader mono_reader0(0.05);
+    SineReader mono_reader1(0.10);
+    SineReader stereo_reader(0.05, NumCh);
+
+    Resampler mono_resampler0(mono_reader0, default_buffer_composer(), FrameSize,
+                              default_resampler_kernel(), &bank);
+    Resampler mono_resampler1(mono_reader1, default_buffer_composer(), FrameSize,
+                              default_resampler_kernel(), &bank);
+
+    Resampler stereo_resampler(stereo_reader, default_buffer_composer(), FrameSize,
+                               default_resampler_kernel(), &bank, NumCh);
+
+    CHECK(mono_resampler0.set_scaling(1.03f));
+    CHECK(mono_resampler1.set_scaling(1.03f));
+    CHECK(stereo_resampler.set_scaling(1.03f));
+
+    for (size_t n = 0; n < OutSamples / BufSz; n++) {
+        ISampleBufferPtr mono_buf0 = new_buffer<BufSz>(BufSz);
+        ISampleBufferPtr mono_buf1 = new_buffer<BufSz>(BufSz);
+        ISampleBufferPtr stereo_buf = new_buffer<BufSz * NumCh>(BufSz * NumCh);
+
+        mono_resampler0.read(*mono_buf0);
+        mono_resampler1.read(*mono_buf1);
+        stereo_resampler.read(*stereo_buf);
+
+        for (size_t i = 0; i < BufSz; i++) {
+            DOUBLES_EQUAL(mono_buf0->data()[i], stereo_buf->data()[i * NumCh], 0);
+            DOUBLES_EQUAL(mono_buf1->data()[i], stereo_buf->data()[i * NumCh + 1], 0);
+        }
+    }
+}
+
 } // namespace test
 } // namespace roc
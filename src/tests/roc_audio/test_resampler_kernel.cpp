@@ -0,0 +1,179 @@
+/*
+ * Copyright (c) 2015 Mikhail Baranov
+ * Copyright (c) 2015 Victor Gaydov
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <CppUTest/TestHarness.h>
+
+#include "roc_core/random.h"
+
+#include "roc_audio/sinc_table.h"
+#include "roc_audio/sinc_phase_table.h"
+#include "roc_audio/generic_resampler_kernel.h"
+#include "roc_audio/default_resampler_kernel.h"
+
+namespace roc {
+namespace test {
+
+using namespace audio;
+
+using packet::sample_t;
+
+namespace {
+
+enum { MaxTaps = SincPhaseTable::NumTaps };
+
+const float Epsilon = 0.00001f;
+
+sample_t random_sample() {
+    return (sample_t)core::random(0, 20000) / 10000.0f - 1.0f;
+}
+
+} // namespace
+
+TEST_GROUP(resampler_kernel) {
+    const SincPhaseTable* table;
+
+    sample_t samples[MaxTaps];
+
+    void setup() {
+        table = &SincPhaseTable::instance();
+
+        for (size_t n = 0; n < MaxTaps; n++) {
+            samples[n] = random_sample();
+        }
+    }
+};
+
+TEST(resampler_kernel, phase_table) {
+    for (size_t p = 0; p < SincPhaseTable::NumPhases; p++) {
+        for (size_t t = 0; t < SincPhaseTable::NumTaps - 1; t++) {
+            DOUBLES_EQUAL(sinc_table[t * st_Nwindow_interp + p], table->lo(p)[t], 0);
+            DOUBLES_EQUAL(sinc_table[t * st_Nwindow_interp + p + 1], table->hi(p)[t], 0);
+        }
+    }
+}
+
+TEST(resampler_kernel, generic_forward) {
+    GenericResamplerKernel kernel;
+
+    for (size_t p = 0; p < SincPhaseTable::NumPhases; p++) {
+        const float fract = (float)p / SincPhaseTable::NumPhases;
+
+        sample_t expected = 0;
+        for (size_t t = 0; t < MaxTaps - 1; t++) {
+            const float lo = sinc_table[t * st_Nwindow_interp + p];
+            const float hi = sinc_table[t * st_Nwindow_interp + p + 1];
+            expected += samples[t] * (lo + fract * (hi - lo));
+        }
+
+        const sample_t actual =
+            kernel.forward(0, samples, table->lo(p), table->hi(p), fract, MaxTaps - 1);
+
+        DOUBLES_EQUAL(expected, actual, 0);
+    }
+}
+
+TEST(resampler_kernel, generic_backward) {
+    GenericResamplerKernel kernel;
+
+    for (size_t p = 0; p < SincPhaseTable::NumPhases; p++) {
+        const float fract = (float)p / SincPhaseTable::NumPhases;
+
+        sample_t expected = 0;
+        for (size_t t = MaxTaps - 1; t > 0; t--) {
+            const float lo = sinc_table[(t - 1) * st_Nwindow_interp + p];
+            const float hi = sinc_table[(t - 1) * st_Nwindow_interp + p + 1];
+            expected += samples[MaxTaps - 1 - t] * (lo + fract * (hi - lo));
+        }
+
+        const sample_t actual =
+            kernel.backward(0, samples, table->lo(p), table->hi(p), fract, MaxTaps - 1);
+
+        DOUBLES_EQUAL(expected, actual, 0);
+    }
+}
+
+TEST(resampler_kernel, generic_dot) {
+    GenericResamplerKernel kernel;
+
+    for (size_t p = 0; p < SincPhaseTable::NumPhases; p++) {
+        sample_t expected = 0;
+        for (size_t t = 0; t < MaxTaps; t++) {
+            expected += samples[t] * table->lo(p)[t];
+        }
+
+        DOUBLES_EQUAL(expected, kernel.dot(0, samples, table->lo(p), MaxTaps), 0);
+    }
+}
+
+TEST(resampler_kernel, generic_interpolate) {
+    GenericResamplerKernel kernel;
+
+    for (size_t p = 0; p < SincPhaseTable::NumPhases; p++) {
+        const float fract = (float)p / SincPhaseTable::NumPhases;
+
+        float taps[MaxTaps];
+
+        kernel.interpolate_forward(taps, table->lo(p), table->hi(p), fract, MaxTaps);
+
+        DOUBLES_EQUAL(kernel.forward(0, samples, table->lo(p), table->hi(p), fract,
+                                     MaxTaps),
+                      kernel.dot(0, samples, taps, MaxTaps), 0);
+
+        kernel.interpolate_backward(taps, table->lo(p), table->hi(p), fract, MaxTaps);
+
+        DOUBLES_EQUAL(kernel.backward(0, samples, table->lo(p), table->hi(p), fract,
+                                      MaxTaps),
+                      kernel.dot(0, samples, taps, MaxTaps), 0);
+    }
+}
+
+TEST(resampler_kernel, default_vs_generic) {
+    GenericResamplerKernel generic;
+    IResamplerKernel& kernel = default_resampler_kernel();
+
+    for (size_t p = 0; p < SincPhaseTable::NumPhases; p++) {
+        const float fract = (float)core::random(0, 1000) / 1000.0f;
+
+        for (size_t off = 0; off < MaxTaps; off++) {
+            for (size_t n = 0; off + n <= MaxTaps; n++) {
+                const float* lo = table->lo(p) + off;
+                const float* hi = table->hi(p) + off;
+
+                DOUBLES_EQUAL(generic.forward(1, samples, lo, hi, fract, n),
+                              kernel.forward(1, samples, lo, hi, fract, n), Epsilon);
+
+                DOUBLES_EQUAL(generic.backward(1, samples, lo, hi, fract, n),
+                              kernel.backward(1, samples, lo, hi, fract, n), Epsilon);
+
+                DOUBLES_EQUAL(generic.dot(1, samples, lo, n),
+                              kernel.dot(1, samples, lo, n), Epsilon);
+
+                float generic_taps[MaxTaps];
+                float kernel_taps[MaxTaps];
+
+                generic.interpolate_forward(generic_taps, lo, hi, fract, n);
+                kernel.interpolate_forward(kernel_taps, lo, hi, fract, n);
+
+                for (size_t k = 0; k < n; k++) {
+                    DOUBLES_EQUAL(generic_taps[k], kernel_taps[k], Epsilon);
+                }
+
+                generic.interpolate_backward(generic_taps, lo, hi, fract, n);
+                kernel.interpolate_backward(kernel_taps, lo, hi, fract, n);
+
+                for (size_t k = 0; k < n; k++) {
+                    DOUBLES_EQUAL(generic_taps[k], kernel_taps[k], Epsilon);
+                }
+            }
+        }
+    }
+}
+
+} // namespace test
+} // namespace roc
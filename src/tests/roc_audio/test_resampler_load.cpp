@@ -0,0 +1,162 @@
+/*
+ * Copyright (c) 2015 Mikhail Baranov
+ * Copyright (c) 2015 Victor Gaydov
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <CppUTest/TestHarness.h>
+
+#include "roc_config/config.h"
+#include "roc_core/log.h"
+#include "roc_core/math.h"
+#include "roc_core/time.h"
+
+#include "roc_audio/resampler.h"
+#include "roc_audio/polyphase_bank.h"
+#include "roc_audio/default_resampler_kernel.h"
+
+namespace roc {
+namespace test {
+
+using namespace audio;
+
+using packet::sample_t;
+
+namespace {
+
+enum {
+    // Number of samples per read, same as server tick.
+    BufSz = ROC_CONFIG_DEFAULT_SERVER_TICK_SAMPLES,
+
+    // Number of reads to measure time.
+    NumIterations = 20000,
+
+    // Number of reads to measure error.
+    NumErrorIterations = 200,
+
+    // Period of input sine, in samples.
+    SinePeriod = 100
+};
+
+// Typical scaling applied to session stream.
+const float Scaling = 0.99f;
+
+// Reads sine from precomputed table.
+class SineReader : public IStreamReader {
+public:
+    SineReader()
+        : pos_(0) {
+        for (size_t n = 0; n < SinePeriod; n++) {
+            table_[n] = (sample_t)sin(2 * M_PI * double(n) / SinePeriod);
+        }
+    }
+
+    virtual void read(const ISampleBufferSlice& out) {
+        for (size_t n = 0; n < out.size(); n++) {
+            out.data()[n] = table_[pos_];
+            pos_ = (pos_ + 1) % SinePeriod;
+        }
+    }
+
+private:
+    sample_t table_[SinePeriod];
+    size_t pos_;
+};
+
+} // namespace
+
+TEST_GROUP(resampler_load) {
+    ISampleBufferPtr new_buffer() {
+        ISampleBufferPtr buffer = default_buffer_composer().compose();
+        CHECK(buffer);
+
+        buffer->set_size(BufSz);
+
+        return buffer;
+    }
+
+    // Returns time per read, in microseconds.
+    double measure_time(const PolyphaseBank* bank) {
+        SineReader reader;
+
+        Resampler resampler(reader, default_buffer_composer(),
+                            ROC_CONFIG_DEFAULT_RESAMPLER_FRAME_SAMPLES,
+                            default_resampler_kernel(), bank);
+
+        CHECK(resampler.set_scaling(Scaling));
+
+        ISampleBufferPtr buffer = new_buffer();
+
+        const uint64_t start = core::timestamp_us();
+
+        for (size_t n = 0; n < NumIterations; n++) {
+            resampler.read(*buffer);
+        }
+
+        return double(core::timestamp_us() - start) / NumIterations;
+    }
+
+    // Returns maximum deviation of polyphase output from sinc output.
+    double measure_error(const PolyphaseBank& bank) {
+        SineReader sinc_reader;
+        SineReader polyphase_reader;
+
+        Resampler sinc_resampler(sinc_reader);
+
+        Resampler polyphase_resampler(polyphase_reader, default_buffer_composer(),
+                                      ROC_CONFIG_DEFAULT_RESAMPLER_FRAME_SAMPLES,
+                                      default_resampler_kernel(), &bank);
+
+        CHECK(sinc_resampler.set_scaling(Scaling));
+        CHECK(polyphase_resampler.set_scaling(Scaling));
+
+        ISampleBufferPtr sinc_buffer = new_buffer();
+        ISampleBufferPtr polyphase_buffer = new_buffer();
+
+        double max_error = 0;
+
+        for (size_t n = 0; n < NumErrorIterations; n++) {
+            sinc_resampler.read(*sinc_buffer);
+            polyphase_resampler.read(*polyphase_buffer);
+
+            for (size_t i = 0; i < BufSz; i++) {
+                const double error =
+                    fabs(double(sinc_buffer->data()[i] - polyphase_buffer->data()[i]));
+                if (error > max_error) {
+                    max_error = error;
+                }
+            }
+        }
+
+        return max_error;
+    }
+};
+
+TEST(resampler_load, sinc) {
+    const double us = measure_time(NULL);
+
+    roc_log(LOG_DEBUG, "resampler load: sinc: kernel=%s %.2fus per %u samples",
+            default_resampler_kernel().name(), us, (unsigned)BufSz);
+}
+
+TEST(resampler_load, polyphase) {
+    for (size_t num_phases = PolyphaseBank::MinPhases;
+         num_phases <= PolyphaseBank::MaxPhases; num_phases *= 4) {
+        const PolyphaseBank& bank = PolyphaseBank::instance(num_phases);
+
+        const double us = measure_time(&bank);
+        const double error = measure_error(bank);
+
+        roc_log(LOG_DEBUG,
+                "resampler load: polyphase: phases=%u kernel=%s %.2fus per %u samples,"
+                " max_error=%.6f",
+                (unsigned)num_phases, default_resampler_kernel().name(), us,
+                (unsigned)BufSz, error);
+    }
+}
+
+} // namespace test
+} // namespace roc
@@ -0,0 +1,175 @@
+/*
+ * Copyright (c) 2015 Mikhail Baranov
+ * Copyright (c) 2015 Victor Gaydov
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <CppUTest/TestHarness.h>
+
+#include "roc_config/config.h"
+#include "roc_core/log.h"
+#include "roc_core/thread.h"
+#include "roc_core/time.h"
+#include "roc_audio/sample_buffer_queue.h"
+
+#include "test_helpers.h"
+
+namespace roc {
+namespace test {
+
+using namespace audio;
+
+namespace {
+
+enum { BufSz = 10, MaxBuffers = ROC_CONFIG_MAX_SAMPLE_BUFFERS, NumBuffers = 20000 };
+
+// Number of latency histogram buckets; bucket N counts handoffs that took
+// less than 2^N microseconds.
+enum { NumBuckets = 12 };
+
+class Producer : public core::Thread {
+public:
+    Producer(SampleBufferQueue& queue, size_t num_buffers, uint64_t* timestamps)
+        : queue_(queue)
+        , num_buffers_(num_buffers)
+        , timestamps_(timestamps) {
+    }
+
+private:
+    virtual void run() {
+        for (size_t n = 0; n < num_buffers_; n++) {
+            ISampleBufferPtr buf = new_buffer<BufSz>(1);
+            buf->data()[0] = packet::sample_t(n);
+
+            if (timestamps_) {
+                timestamps_[n] = core::timestamp_us();
+            }
+
+            queue_.write(*buf);
+        }
+    }
+
+    SampleBufferQueue& queue_;
+    size_t num_buffers_;
+    uint64_t* timestamps_;
+};
+
+} // namespace
+
+TEST_GROUP(sample_buffer_queue){};
+
+TEST(sample_buffer_queue, write_read) {
+    SampleBufferQueue queue;
+
+    LONGS_EQUAL(0, queue.size());
+
+    ISampleBufferPtr buf = new_buffer<BufSz>(BufSz);
+    queue.write(*buf);
+
+    LONGS_EQUAL(1, queue.size());
+
+    CHECK(queue.read().container() == buf);
+
+    LONGS_EQUAL(0, queue.size());
+}
+
+TEST(sample_buffer_queue, fifo_wrap_around) {
+    SampleBufferQueue queue;
+
+    ISampleBufferPtr bufs[MaxBuffers];
+
+    for (size_t i = 0; i < 3; i++) {
+        for (size_t n = 0; n < MaxBuffers; n++) {
+            bufs[n] = new_buffer<BufSz>(BufSz);
+            queue.write(*bufs[n]);
+        }
+
+        LONGS_EQUAL(MaxBuffers, queue.size());
+
+        for (size_t n = 0; n < MaxBuffers; n++) {
+            CHECK(queue.read().container() == bufs[n]);
+        }
+
+        LONGS_EQUAL(0, queue.size());
+    }
+}
+
+TEST(sample_buffer_queue, writer_blocks_when_full) {
+    SampleBufferQueue queue;
+
+    for (size_t n = 0; n < MaxBuffers; n++) {
+        queue.write(*new_buffer<BufSz>(BufSz));
+    }
+
+    Producer producer(queue, 1, NULL);
+    producer.start();
+
+    core::sleep_for_ms(20);
+
+    LONGS_EQUAL(MaxBuffers, queue.size());
+
+    CHECK(queue.read());
+
+    producer.join();
+
+    LONGS_EQUAL(MaxBuffers, queue.size());
+}
+
+TEST(sample_buffer_queue, separate_threads) {
+    SampleBufferQueue queue;
+
+    Producer producer(queue, NumBuffers, NULL);
+    producer.start();
+
+    for (size_t n = 0; n < NumBuffers; n++) {
+        ISampleBufferConstSlice buf = queue.read();
+        CHECK(buf);
+        LONGS_EQUAL(n, (size_t)buf.data()[0]);
+    }
+
+    producer.join();
+
+    LONGS_EQUAL(0, queue.size());
+}
+
+TEST(sample_buffer_queue, handoff_latency) {
+    uint64_t* timestamps = new uint64_t[NumBuffers];
+
+    size_t histogram[NumBuckets] = {};
+
+    SampleBufferQueue queue;
+
+    Producer producer(queue, NumBuffers, timestamps);
+    producer.start();
+
+    for (size_t n = 0; n < NumBuffers; n++) {
+        ISampleBufferConstSlice buf = queue.read();
+        CHECK(buf);
+
+        const size_t index = (size_t)buf.data()[0];
+        const uint64_t latency = core::timestamp_us() - timestamps[index];
+
+        size_t bucket = 0;
+        while (bucket < NumBuckets - 1 && latency >= (1u << bucket)) {
+            bucket++;
+        }
+
+        histogram[bucket]++;
+    }
+
+    producer.join();
+
+    for (size_t n = 0; n < NumBuckets; n++) {
+        roc_log(LOG_DEBUG, "sample buffer queue: handoff latency %s %5uus: %u",
+                n < NumBuckets - 1 ? "< " : ">=", 1u << (n < NumBuckets - 1 ? n : n - 1),
+                (unsigned)histogram[n]);
+    }
+
+    delete[] timestamps;
+}
+
+} // namespace test
+} // namespace roc
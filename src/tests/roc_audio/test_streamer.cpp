@@ -23,7 +23,7 @@ using packet::timestamp_t;
 
 namespace {
 
-enum { ChNum = 1, ChMask = 0x3 };
+enum { ChNum = 1, ChMask = 0x3, NumCh = 2 };
 
 enum { NumSamples = 20, NumPackets = 100, BufSz = NumSamples * NumPackets };
 
@@ -37,7 +37,7 @@ TEST_GROUP(streamer) {
     core::ScopedPtr<Streamer> streamer;
 
     void setup() {
-        streamer.reset(new Streamer(reader, ChNum));
+        streamer.reset(new Streamer(reader, (1 << ChNum)));
     }
 
     void add_packet(packet::timestamp_t timestamp, packet::sample_t value) {
@@ -56,6 +56,41 @@ TEST_GROUP(streamer) {
         reader.add(packet);
     }
 
+    void add_stereo_packet(packet::timestamp_t timestamp,
+                           packet::sample_t value0,
+                           packet::sample_t value1) {
+        packet::IAudioPacketPtr packet = new_audio_packet();
+
+        packet::sample_t samples[NumSamples * NumCh];
+
+        for (size_t n = 0; n < NumSamples; n++) {
+            samples[n * NumCh] = value0;
+            samples[n * NumCh + 1] = value1;
+        }
+
+        packet->set_timestamp(timestamp);
+        packet->set_size(ChMask, NumSamples, Rate);
+        packet->write_samples(ChMask, 0, samples, NumSamples);
+
+        reader.add(packet);
+    }
+
+    void expect_stereo_buffers(size_t num_buffers,
+                               size_t sz,
+                               packet::sample_t value0,
+                               packet::sample_t value1) {
+        for (size_t n = 0; n < num_buffers; n++) {
+            ISampleBufferPtr buf = new_buffer<BufSz * NumCh>(sz * NumCh);
+
+            streamer->read(*buf);
+
+            for (size_t i = 0; i < sz; i++) {
+                DOUBLES_EQUAL(value0, buf->data()[i * NumCh], 0.0001);
+                DOUBLES_EQUAL(value1, buf->data()[i * NumCh + 1], 0.0001);
+            }
+        }
+    }
+
     void expect_buffers(size_t num_buffers, size_t sz, packet::sample_t value) {
         read_buffers<BufSz>(*streamer, num_buffers, sz, value);
     }
@@ -208,5 +243,44 @@ TEST(streamer, overlapping_packets) {
     expect_buffers(N / 2, 1, 0.333f);
 }
 
+TEST(streamer, multiple_channels) {
+    streamer.reset(new Streamer(reader, ChMask));
+
+    add_stereo_packet(NumSamples * 1, 0.111f, -0.111f);
+    add_stereo_packet(NumSamples * 2, 0.222f, -0.222f);
+
+    expect_stereo_buffers(NumSamples, 1, 0.111f, -0.111f);
+    expect_stereo_buffers(1, NumSamples, 0.222f, -0.222f);
+}
+
+TEST(streamer, multiple_channels_zeros_between_packets) {
+    CHECK(NumSamples % 2 == 0);
+
+    streamer.reset(new Streamer(reader, ChMask));
+
+    add_stereo_packet(NumSamples * 1, 0.111f, -0.111f);
+    add_stereo_packet(NumSamples * 3, 0.333f, -0.333f);
+
+    expect_stereo_buffers(2, NumSamples / 2, 0.111f, -0.111f);
+    expect_stereo_buffers(2, NumSamples / 2, 0.000f, 0.000f);
+    expect_stereo_buffers(2, NumSamples / 2, 0.333f, -0.333f);
+}
+
+TEST(streamer, multiple_channels_overlapping_packets) {
+    const size_t N = NumSamples;
+
+    CHECK(N % 2 == 0);
+
+    streamer.reset(new Streamer(reader, ChMask));
+
+    add_stereo_packet(0, 0.111f, -0.111f);
+    add_stereo_packet(N / 2, 0.222f, -0.222f);
+    add_stereo_packet(N, 0.333f, -0.333f);
+
+    expect_stereo_buffers(1, N, 0.111f, -0.111f);
+    expect_stereo_buffers(1, N / 2, 0.222f, -0.222f);
+    expect_stereo_buffers(1, N / 2, 0.333f, -0.333f);
+}
+
 } // namespace test
 } // namespace roc
@@ -0,0 +1,82 @@
+/*
+ * Copyright (c) 2015 Mikhail Baranov
+ * Copyright (c) 2015 Victor Gaydov
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <CppUTest/TestHarness.h>
+
+#include "roc_audio/unzipper.h"
+
+#include "test_stream_reader.h"
+
+namespace roc {
+namespace test {
+
+using namespace audio;
+
+namespace {
+
+enum { BufSz = 100, MaxSamples = 1000 };
+
+typedef TestStreamReader<MaxSamples> TestReader;
+
+} // namespace
+
+TEST_GROUP(unzipper) {
+    TestReader reader;
+
+    void add_input(size_t total) {
+        for (size_t n = 0; n < BufSz; n++) {
+            for (size_t ch = 0; ch < total; ch++) {
+                reader.add(1, int(n * (ch + 1)));
+            }
+        }
+    }
+
+    void expect_output(IStreamReader & ch_reader, size_t bufsz, size_t off, size_t number) {
+        ISampleBufferPtr buf = new_buffer<MaxSamples>(bufsz);
+
+        ch_reader.read(*buf);
+
+        for (size_t n = 0; n < bufsz; n++) {
+            LONGS_EQUAL(long((off + n) * number), (long)buf->data()[n]);
+        }
+    }
+};
+
+TEST(unzipper, one_channel) {
+    Unzipper unzipper(reader, 0x1);
+
+    add_input(1);
+
+    expect_output(unzipper.reader(0), BufSz, 0, 1);
+}
+
+TEST(unzipper, two_channels) {
+    Unzipper unzipper(reader, 0x3);
+
+    add_input(2);
+
+    expect_output(unzipper.reader(0), BufSz, 0, 1);
+    expect_output(unzipper.reader(1), BufSz, 0, 2);
+}
+
+TEST(unzipper, multiple_reads) {
+    enum { NumReads = 4 };
+
+    Unzipper unzipper(reader, 0x3);
+
+    add_input(2);
+
+    for (size_t n = 0; n < NumReads; n++) {
+        expect_output(unzipper.reader(0), BufSz / NumReads, BufSz / NumReads * n, 1);
+        expect_output(unzipper.reader(1), BufSz / NumReads, BufSz / NumReads * n, 2);
+    }
+}
+
+} // namespace test
+} // namespace roc
@@ -20,7 +20,7 @@ using namespace audio;
 
 namespace {
 
-enum { BufSz = 100, MaxSamples = 1000 };
+enum { BufSz = 100, MaxSamples = 2000 };
 
 typedef TestStreamReader<MaxSamples> TestReader;
 
@@ -84,6 +84,26 @@ TEST(zipper, two_readers) {
     expect_output(*buf, 2, 2);
 }
 
+TEST(zipper, large_buffer) {
+    enum { NumReaders = 2, LargeSz = 700 };
+
+    zipper.add(reader1);
+    zipper.add(reader2);
+
+    for (size_t n = 0; n < LargeSz; n++) {
+        reader1.add(1, int(n));
+        reader2.add(1, -int(n));
+    }
+
+    // Output is larger than temporary buffer and is read in several chunks.
+    ISampleBufferPtr buf = read_buffer(LargeSz * NumReaders);
+
+    for (size_t n = 0; n < LargeSz; n++) {
+        LONGS_EQUAL((long)n, (long)buf->data()[n * NumReaders]);
+        LONGS_EQUAL(-(long)n, (long)buf->data()[n * NumReaders + 1]);
+    }
+}
+
 TEST(zipper, remove_reader) {
     zipper.add(reader1);
     zipper.add(reader2);
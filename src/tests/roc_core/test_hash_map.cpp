@@ -0,0 +1,131 @@
+/*
+ * Copyright (c) 2015 Mikhail Baranov
+ * Copyright (c) 2015 Victor Gaydov
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <CppUTest/TestHarness.h>
+
+#include "roc_core/hash_map.h"
+
+namespace roc {
+namespace test {
+
+using namespace core;
+
+namespace {
+
+const size_t TEST_MAX_SIZE = 100;
+
+struct Key {
+    size_t value;
+
+    // Few distinct hashes, to produce long collision chains.
+    size_t hash() const {
+        return value % 7;
+    }
+
+    bool operator==(const Key& other) const {
+        return value == other.value;
+    }
+
+    Key(size_t v = 0)
+        : value(v) {
+    }
+};
+
+typedef HashMap<Key, size_t> TestMap;
+
+} // namespace
+
+TEST_GROUP(hash_map) {};
+
+TEST(hash_map, empty) {
+    TestMap map(TEST_MAX_SIZE);
+
+    LONGS_EQUAL(0, map.size());
+    LONGS_EQUAL(TEST_MAX_SIZE, map.max_size());
+
+    CHECK(map.find(Key(1)) == NULL);
+    CHECK(!map.remove(Key(1)));
+}
+
+TEST(hash_map, insert_find) {
+    TestMap map(TEST_MAX_SIZE);
+
+    for (size_t n = 0; n < TEST_MAX_SIZE; n++) {
+        CHECK(map.insert(Key(n), n * 10));
+        LONGS_EQUAL(n + 1, map.size());
+    }
+
+    for (size_t n = 0; n < TEST_MAX_SIZE; n++) {
+        size_t* value = map.find(Key(n));
+        CHECK(value);
+        LONGS_EQUAL(n * 10, *value);
+    }
+
+    CHECK(map.find(Key(TEST_MAX_SIZE)) == NULL);
+}
+
+TEST(hash_map, full) {
+    TestMap map(TEST_MAX_SIZE);
+
+    for (size_t n = 0; n < TEST_MAX_SIZE; n++) {
+        CHECK(map.insert(Key(n), n));
+    }
+
+    CHECK(!map.insert(Key(TEST_MAX_SIZE), TEST_MAX_SIZE));
+    LONGS_EQUAL(TEST_MAX_SIZE, map.size());
+
+    CHECK(map.remove(Key(0)));
+    CHECK(map.insert(Key(TEST_MAX_SIZE), TEST_MAX_SIZE));
+}
+
+TEST(hash_map, remove) {
+    TestMap map(TEST_MAX_SIZE);
+
+    for (size_t n = 0; n < TEST_MAX_SIZE; n++) {
+        CHECK(map.insert(Key(n), n));
+    }
+
+    // Remove every third key, including keys in the middle of collision chains.
+    for (size_t n = 0; n < TEST_MAX_SIZE; n += 3) {
+        CHECK(map.remove(Key(n)));
+        CHECK(!map.remove(Key(n)));
+    }
+
+    for (size_t n = 0; n < TEST_MAX_SIZE; n++) {
+        size_t* value = map.find(Key(n));
+
+        if (n % 3 == 0) {
+            CHECK(value == NULL);
+        } else {
+            CHECK(value);
+            LONGS_EQUAL(n, *value);
+        }
+    }
+}
+
+TEST(hash_map, reinsert) {
+    TestMap map(TEST_MAX_SIZE);
+
+    for (size_t i = 0; i < 10; i++) {
+        for (size_t n = 0; n < TEST_MAX_SIZE; n++) {
+            CHECK(map.insert(Key(n + i), n));
+        }
+
+        for (size_t n = 0; n < TEST_MAX_SIZE; n++) {
+            CHECK(map.remove(Key(n + i)));
+        }
+
+        LONGS_EQUAL(0, map.size());
+    }
+
+    CHECK(map.find(Key(0)) == NULL);
+}
+
+} // namespace test
+} // namespace roc
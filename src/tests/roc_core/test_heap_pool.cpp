@@ -0,0 +1,95 @@
+/*
+ * Copyright (c) 2015 Mikhail Baranov
+ * Copyright (c) 2015 Victor Gaydov
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <CppUTest/TestHarness.h>
+
+#include "roc_core/noncopyable.h"
+#include "roc_core/heap_pool.h"
+
+namespace roc {
+namespace test {
+
+using namespace core;
+
+namespace {
+
+const size_t NumObjects = 5;
+
+struct Object : NonCopyable<> {
+    char data[17];
+};
+
+} // namespace
+
+TEST_GROUP(heap_pool) {};
+
+TEST(heap_pool, empty) {
+    HeapPool<Object> pool;
+
+    LONGS_EQUAL(0, pool.num_allocated());
+    LONGS_EQUAL(0, pool.num_free());
+}
+
+TEST(heap_pool, new_destroy) {
+    HeapPool<Object> pool;
+
+    Object* obj = new (pool) Object;
+    CHECK(obj);
+
+    LONGS_EQUAL(1, pool.num_allocated());
+    LONGS_EQUAL(0, pool.num_free());
+
+    pool.destroy(*obj);
+
+    LONGS_EQUAL(0, pool.num_allocated());
+    LONGS_EQUAL(1, pool.num_free());
+}
+
+TEST(heap_pool, reuse) {
+    HeapPool<Object> pool;
+
+    Object* objs[NumObjects];
+    Object* reused_objs[NumObjects];
+
+    for (size_t n = 0; n < NumObjects; n++) {
+        objs[n] = new (pool) Object;
+        CHECK(objs[n]);
+    }
+
+    for (size_t n = 0; n < NumObjects; n++) {
+        pool.destroy(*objs[n]);
+    }
+
+    LONGS_EQUAL(0, pool.num_allocated());
+    LONGS_EQUAL(NumObjects, pool.num_free());
+
+    for (size_t n = 0; n < NumObjects; n++) {
+        Object* obj = new (pool) Object;
+
+        bool reused = false;
+        for (size_t i = 0; i < NumObjects; i++) {
+            if (obj == objs[i]) {
+                reused = true;
+            }
+        }
+        CHECK(reused);
+
+        reused_objs[n] = obj;
+    }
+
+    LONGS_EQUAL(NumObjects, pool.num_allocated());
+    LONGS_EQUAL(0, pool.num_free());
+
+    for (size_t n = 0; n < NumObjects; n++) {
+        pool.destroy(*reused_objs[n]);
+    }
+}
+
+} // namespace test
+} // namespace roc
@@ -0,0 +1,249 @@
+/*
+ * Copyright (c) 2015 Mikhail Baranov
+ * Copyright (c) 2015 Victor Gaydov
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <CppUTest/TestHarness.h>
+
+#include "roc_core/log.h"
+#include "roc_core/thread.h"
+#include "roc_core/time.h"
+#include "roc_datagram/datagram_queue.h"
+#include "roc_datagram/datagram_ring.h"
+
+#include "test_datagram.h"
+
+namespace roc {
+namespace test {
+
+using namespace datagram;
+
+namespace {
+
+enum { RingSize = 8, NumDatagrams = 100000 };
+
+class Producer : public core::Thread {
+public:
+    Producer(IDatagramWriter& writer, IDatagramPtr* dgms, size_t n_dgms)
+        : writer_(writer)
+        , dgms_(dgms)
+        , n_dgms_(n_dgms) {
+    }
+
+private:
+    virtual void run() {
+        for (size_t n = 0; n < n_dgms_; n++) {
+            writer_.write(dgms_[n]);
+        }
+    }
+
+    IDatagramWriter& writer_;
+    IDatagramPtr* dgms_;
+    size_t n_dgms_;
+};
+
+// Passes datagrams from producer thread to current thread through given
+// queue and returns time spent per datagram, in nanoseconds.
+double run_threads(IDatagramReader& reader, IDatagramWriter& writer) {
+    IDatagramPtr* dgms = new IDatagramPtr[NumDatagrams];
+
+    for (size_t n = 0; n < NumDatagrams; n++) {
+        dgms[n] = new TestDatagram;
+    }
+
+    Producer producer(writer, dgms, NumDatagrams);
+
+    const uint64_t start = core::timestamp_ms();
+
+    producer.start();
+
+    for (size_t n = 0; n < NumDatagrams;) {
+        if (IDatagramConstPtr dgm = reader.read()) {
+            CHECK(dgm == dgms[n]);
+            n++;
+        }
+    }
+
+    producer.join();
+
+    const uint64_t elapsed = core::timestamp_ms() - start;
+
+    delete[] dgms;
+
+    return double(elapsed) * 1000000 / NumDatagrams;
+}
+
+} // namespace
+
+TEST_GROUP(datagram_ring) {
+    IDatagramPtr new_datagram() {
+        return new TestDatagram;
+    }
+};
+
+TEST(datagram_ring, empty) {
+    DatagramRing ring(RingSize);
+
+    LONGS_EQUAL(0, ring.size());
+    LONGS_EQUAL(RingSize, ring.max_size());
+
+    CHECK(!ring.read());
+}
+
+TEST(datagram_ring, round_up_size) {
+    DatagramRing ring(RingSize - 1);
+
+    LONGS_EQUAL(RingSize, ring.max_size());
+}
+
+TEST(datagram_ring, write_read) {
+    DatagramRing ring(RingSize);
+
+    IDatagramPtr dgm = new_datagram();
+
+    ring.write(dgm);
+    LONGS_EQUAL(1, ring.size());
+
+    CHECK(ring.read() == dgm);
+    LONGS_EQUAL(0, ring.size());
+
+    CHECK(!ring.read());
+}
+
+TEST(datagram_ring, fifo_wrap_around) {
+    DatagramRing ring(RingSize);
+
+    IDatagramPtr dgms[RingSize];
+
+    for (size_t i = 0; i < RingSize * 5; i++) {
+        for (size_t n = 0; n < RingSize / 2 + 1; n++) {
+            dgms[n] = new_datagram();
+            ring.write(dgms[n]);
+        }
+
+        LONGS_EQUAL(RingSize / 2 + 1, ring.size());
+
+        for (size_t n = 0; n < RingSize / 2 + 1; n++) {
+            CHECK(ring.read() == dgms[n]);
+        }
+
+        CHECK(!ring.read());
+    }
+}
+
+TEST(datagram_ring, full) {
+    DatagramRing ring(RingSize);
+
+    IDatagramPtr dgms[RingSize];
+
+    for (size_t n = 0; n < RingSize; n++) {
+        dgms[n] = new_datagram();
+        ring.write(dgms[n]);
+    }
+
+    LONGS_EQUAL(RingSize, ring.size());
+    LONGS_EQUAL(0, ring.num_dropped());
+
+    IDatagramPtr extra = new_datagram();
+    ring.write(extra);
+
+    LONGS_EQUAL(RingSize, ring.size());
+    LONGS_EQUAL(1, ring.num_dropped());
+    LONGS_EQUAL(1, extra->getref());
+
+    for (size_t n = 0; n < RingSize; n++) {
+        CHECK(ring.read() == dgms[n]);
+    }
+
+    CHECK(!ring.read());
+}
+
+TEST(datagram_ring, read_batch) {
+    DatagramRing ring(RingSize);
+
+    IDatagramPtr dgms[RingSize];
+    IDatagramConstPtr batch[RingSize];
+
+    for (size_t n = 0; n < RingSize; n++) {
+        dgms[n] = new_datagram();
+        ring.write(dgms[n]);
+    }
+
+    LONGS_EQUAL(3, ring.read_batch(batch, 3));
+    LONGS_EQUAL(RingSize - 3, ring.size());
+
+    for (size_t n = 0; n < 3; n++) {
+        CHECK(batch[n] == dgms[n]);
+    }
+
+    LONGS_EQUAL(RingSize - 3, ring.read_batch(batch, RingSize));
+    LONGS_EQUAL(0, ring.size());
+
+    for (size_t n = 0; n < RingSize - 3; n++) {
+        CHECK(batch[n] == dgms[n + 3]);
+    }
+
+    LONGS_EQUAL(0, ring.read_batch(batch, RingSize));
+}
+
+TEST(datagram_ring, write_batch) {
+    DatagramRing ring(RingSize);
+
+    IDatagramPtr dgms[RingSize + 3];
+
+    for (size_t n = 0; n < RingSize + 3; n++) {
+        dgms[n] = new_datagram();
+    }
+
+    ring.write_batch(dgms, 3);
+    LONGS_EQUAL(3, ring.size());
+
+    // Datagrams that don't fit are dropped.
+    ring.write_batch(dgms + 3, RingSize);
+    LONGS_EQUAL(RingSize, ring.size());
+    LONGS_EQUAL(3, ring.num_dropped());
+
+    for (size_t n = 0; n < RingSize; n++) {
+        CHECK(ring.read() == dgms[n]);
+    }
+
+    CHECK(!ring.read());
+
+    for (size_t n = RingSize; n < RingSize + 3; n++) {
+        LONGS_EQUAL(1, dgms[n]->getref());
+    }
+}
+
+TEST(datagram_ring, release_datagrams) {
+    IDatagramPtr dgm = new_datagram();
+
+    {
+        DatagramRing ring(RingSize);
+
+        ring.write(dgm);
+        LONGS_EQUAL(2, dgm->getref());
+    }
+
+    LONGS_EQUAL(1, dgm->getref());
+}
+
+TEST(datagram_ring, contention) {
+    DatagramQueue queue(0);
+    const double queue_ns = run_threads(queue, queue);
+
+    DatagramRing ring(NumDatagrams);
+    const double ring_ns = run_threads(ring, ring);
+
+    LONGS_EQUAL(0, ring.num_dropped());
+
+    roc_log(LOG_DEBUG,
+            "datagram ring: time_per_datagram: queue=%.1fns ring=%.1fns (%u datagrams)",
+            queue_ns, ring_ns, (unsigned)NumDatagrams);
+}
+
+} // namespace test
+} // namespace roc
@@ -108,6 +108,47 @@ TEST(block_codecs, loss_1) {
     CHECK(decode());
 }
 
+TEST(block_codecs, incremental) {
+    encode();
+
+    for (size_t i = 0; i < N_DATA_PACKETS; ++i) {
+        if (i != 5) {
+            decoder.write(i, buffers[i]);
+        }
+    }
+
+    // Codec isn't needed until loss is detected.
+    LONGS_EQUAL(0, decoder.num_codecs());
+
+    for (size_t i = N_DATA_PACKETS; i < N_DATA_PACKETS + N_FEC_PACKETS; ++i) {
+        decoder.write(i, buffers[i]);
+        LONGS_EQUAL(1, decoder.num_codecs());
+    }
+
+    CHECK(decode());
+
+    // Late buffer is ignored since it's already repaired.
+    decoder.write(5, buffers[5]);
+    CHECK(decode());
+
+    LONGS_EQUAL(1, decoder.num_codecs());
+}
+
+TEST(block_codecs, unexpected_size) {
+    encode();
+
+    for (size_t i = 0; i < N_DATA_PACKETS + N_FEC_PACKETS; ++i) {
+        if (i == 5) {
+            // Buffer of unexpected size is dropped.
+            decoder.write(i, core::IByteBufferConstSlice(buffers[i], 0, SYMB_SZ / 2));
+            continue;
+        }
+        decoder.write(i, buffers[i]);
+    }
+
+    CHECK(decode());
+}
+
 TEST(block_codecs, load_test) {
     enum { NumIterations = 20, LossPercent = 10, MaxLoss = 3 };
 
@@ -0,0 +1,305 @@
+/*
+ * Copyright (c) 2015 Mikhail Baranov
+ * Copyright (c) 2015 Victor Gaydov
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <CppUTest/TestHarness.h>
+
+#include "roc_config/config.h"
+
+#include "roc_core/byte_buffer.h"
+#include "roc_core/stddefs.h"
+#include "roc_core/log.h"
+#include "roc_core/random.h"
+#include "roc_core/time.h"
+#include "roc_core/math.h"
+#include "roc_core/array.h"
+
+#include "roc_fec/ldpc_block_encoder.h"
+#include "roc_fec/ldpc_block_decoder.h"
+#include "roc_fec/rs_block_encoder.h"
+#include "roc_fec/rs_block_decoder.h"
+
+namespace roc {
+namespace test {
+
+using namespace fec;
+
+namespace {
+
+const size_t N_DATA_PACKETS = ROC_CONFIG_DEFAULT_FEC_BLOCK_DATA_PACKETS;
+const size_t N_FEC_PACKETS = ROC_CONFIG_DEFAULT_FEC_BLOCK_REDUNDANT_PACKETS;
+
+const size_t SYMB_SZ = ROC_CONFIG_DEFAULT_PACKET_SIZE;
+
+enum { NumBlocks = 2000 };
+
+} // namespace
+
+TEST_GROUP(block_codecs_load) {
+    LDPC_BlockEncoder encoder;
+    LDPC_BlockDecoder decoder;
+
+    RS_BlockEncoder rs_encoder;
+    RS_BlockDecoder rs_decoder;
+
+    core::Array<core::IByteBufferConstSlice, N_DATA_PACKETS + N_FEC_PACKETS> buffers;
+
+    void setup() {
+        buffers.resize(N_DATA_PACKETS + N_FEC_PACKETS);
+
+        for (size_t i = 0; i < N_DATA_PACKETS; ++i) {
+            core::IByteBufferPtr buffer =
+                core::ByteBufferTraits::default_composer<SYMB_SZ>().compose();
+
+            buffer->set_size(SYMB_SZ);
+
+            for (size_t j = 0; j < buffer->size(); ++j) {
+                buffer->data()[j] = (uint8_t)core::random(0, 0xff);
+            }
+
+            buffers[i] = *buffer;
+        }
+    }
+
+    void encode() {
+        encode(encoder);
+    }
+
+    void encode(IBlockEncoder & enc) {
+        for (size_t i = 0; i < N_DATA_PACKETS; ++i) {
+            enc.write(i, buffers[i]);
+        }
+        enc.commit();
+        for (size_t i = 0; i < N_FEC_PACKETS; ++i) {
+            buffers[N_DATA_PACKETS + i] = enc.read(i);
+        }
+        enc.reset();
+    }
+
+    size_t decode(size_t n_lost) {
+        return decode(decoder, n_lost);
+    }
+
+    size_t decode(IBlockDecoder & dec, size_t n_lost) {
+        for (size_t i = 0; i < N_DATA_PACKETS + N_FEC_PACKETS; ++i) {
+            if (i < n_lost) {
+                continue;
+            }
+            dec.write(i, buffers[i]);
+        }
+
+        size_t n_repaired = 0;
+
+        for (size_t i = 0; i < N_DATA_PACKETS; ++i) {
+            core::IByteBufferConstSlice decoded = dec.repair(i);
+            if (!decoded) {
+                continue;
+            }
+            if (i < n_lost) {
+                CHECK(memcmp(buffers[i].data(), decoded.data(), SYMB_SZ) == 0);
+                n_repaired++;
+            }
+        }
+
+        dec.reset();
+
+        return n_repaired;
+    }
+
+    // Returns true if all data buffers were restored after losing random
+    // n_lost buffers of block.
+    bool decode_random(IBlockDecoder & dec, size_t n_lost) {
+        bool lost[N_DATA_PACKETS + N_FEC_PACKETS] = {};
+
+        for (size_t n = 0; n < n_lost;) {
+            const size_t i = core::random(N_DATA_PACKETS + N_FEC_PACKETS);
+            if (!lost[i]) {
+                lost[i] = true;
+                n++;
+            }
+        }
+
+        for (size_t i = 0; i < N_DATA_PACKETS + N_FEC_PACKETS; ++i) {
+            if (!lost[i]) {
+                dec.write(i, buffers[i]);
+            }
+        }
+
+        bool ok = true;
+
+        for (size_t i = 0; i < N_DATA_PACKETS; ++i) {
+            if (!dec.repair(i)) {
+                ok = false;
+            }
+        }
+
+        dec.reset();
+
+        return ok;
+    }
+
+    void report(const char* name, uint64_t elapsed_us) {
+        roc_log(LOG_DEBUG, "%s: %u blocks in %u us, %u blocks/sec", name,
+                (unsigned)NumBlocks, //
+                (unsigned)elapsed_us, //
+                (unsigned)(elapsed_us ? (uint64_t)NumBlocks * 1000000 / elapsed_us : 0));
+    }
+};
+
+TEST(block_codecs_load, encode) {
+    const uint64_t start = core::timestamp_us();
+
+    for (size_t n = 0; n < NumBlocks; n++) {
+        encode();
+    }
+
+    report("encode", core::timestamp_us() - start);
+}
+
+TEST(block_codecs_load, decode_without_loss) {
+    encode();
+
+    const uint64_t start = core::timestamp_us();
+
+    for (size_t n = 0; n < NumBlocks; n++) {
+        LONGS_EQUAL(0, decode(0));
+    }
+
+    report("decode without loss", core::timestamp_us() - start);
+
+    LONGS_EQUAL(0, decoder.num_codecs());
+}
+
+TEST(block_codecs_load, decode_with_loss) {
+    encode();
+
+    size_t total_repaired = 0;
+
+    const uint64_t start = core::timestamp_us();
+
+    for (size_t n = 0; n < NumBlocks; n++) {
+        total_repaired += decode(1);
+    }
+
+    report("decode with loss", core::timestamp_us() - start);
+
+    LONGS_EQUAL(NumBlocks, decoder.num_codecs());
+    LONGS_EQUAL(NumBlocks, total_repaired);
+}
+
+TEST(block_codecs_load, rs_encode) {
+    const uint64_t start = core::timestamp_us();
+
+    for (size_t n = 0; n < NumBlocks; n++) {
+        encode(rs_encoder);
+    }
+
+    report("rs encode", core::timestamp_us() - start);
+}
+
+TEST(block_codecs_load, rs_decode_with_loss) {
+    encode(rs_encoder);
+
+    size_t total_repaired = 0;
+
+    const uint64_t start = core::timestamp_us();
+
+    for (size_t n = 0; n < NumBlocks; n++) {
+        total_repaired += decode(rs_decoder, N_FEC_PACKETS);
+    }
+
+    report("rs decode with loss", core::timestamp_us() - start);
+
+    LONGS_EQUAL(NumBlocks * N_FEC_PACKETS, total_repaired);
+}
+
+TEST(block_codecs_load, recovery_rate) {
+    enum { NumIterations = 200 };
+
+    encode(encoder);
+
+    // LDPC-Staircase and Reed-Solomon use different FEC buffers, so encode
+    // separate copy of block for each codec.
+    core::Array<core::IByteBufferConstSlice, N_FEC_PACKETS> ldpc_fec;
+    ldpc_fec.resize(N_FEC_PACKETS);
+    for (size_t i = 0; i < N_FEC_PACKETS; ++i) {
+        ldpc_fec[i] = buffers[N_DATA_PACKETS + i];
+    }
+
+    encode(rs_encoder);
+
+    core::Array<core::IByteBufferConstSlice, N_FEC_PACKETS> rs_fec;
+    rs_fec.resize(N_FEC_PACKETS);
+    for (size_t i = 0; i < N_FEC_PACKETS; ++i) {
+        rs_fec[i] = buffers[N_DATA_PACKETS + i];
+    }
+
+    for (size_t n_lost = 1; n_lost <= N_FEC_PACKETS; n_lost++) {
+        size_t ldpc_ok = 0, rs_ok = 0;
+
+        for (size_t n = 0; n < NumIterations; n++) {
+            for (size_t i = 0; i < N_FEC_PACKETS; ++i) {
+                buffers[N_DATA_PACKETS + i] = ldpc_fec[i];
+            }
+            if (decode_random(decoder, n_lost)) {
+                ldpc_ok++;
+            }
+
+            for (size_t i = 0; i < N_FEC_PACKETS; ++i) {
+                buffers[N_DATA_PACKETS + i] = rs_fec[i];
+            }
+            if (decode_random(rs_decoder, n_lost)) {
+                rs_ok++;
+            }
+        }
+
+        roc_log(LOG_DEBUG, "recovery rate: lost %u/%u, ldpc %u%%, rs %u%%",
+                (unsigned)n_lost, (unsigned)(N_DATA_PACKETS + N_FEC_PACKETS),
+                (unsigned)(ldpc_ok * 100 / NumIterations),
+                (unsigned)(rs_ok * 100 / NumIterations));
+
+        // Reed-Solomon is MDS code, any N_DATA_PACKETS buffers are enough.
+        LONGS_EQUAL(NumIterations, rs_ok);
+    }
+}
+
+TEST(block_codecs_load, decode_latency) {
+    enum { NumLost = 3 };
+
+    encode();
+
+    uint64_t max_write_us = 0, max_repair_us = 0;
+    size_t total_repaired = 0;
+
+    for (size_t n = 0; n < NumBlocks; n++) {
+        // Buffers are written one per tick, as they arrive from network.
+        for (size_t i = NumLost; i < N_DATA_PACKETS + N_FEC_PACKETS; ++i) {
+            const uint64_t start = core::timestamp_us();
+            decoder.write(i, buffers[i]);
+            max_write_us = ROC_MAX(max_write_us, core::timestamp_us() - start);
+        }
+
+        for (size_t i = 0; i < NumLost; ++i) {
+            const uint64_t start = core::timestamp_us();
+            if (decoder.repair(i)) {
+                total_repaired++;
+            }
+            max_repair_us = ROC_MAX(max_repair_us, core::timestamp_us() - start);
+        }
+
+        decoder.reset();
+    }
+
+    roc_log(LOG_DEBUG, "decode latency: max write %u us, max repair %u us",
+            (unsigned)max_write_us, (unsigned)max_repair_us);
+
+    CHECK(total_repaired > 0);
+}
+
+} // namespace test
+} // namespace roc
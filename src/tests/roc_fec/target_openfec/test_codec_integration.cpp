@@ -19,6 +19,8 @@
 #include "roc_fec/ldpc_block_encoder.h"
 #include "roc_fec/ldpc_block_decoder.h"
 
+#include "roc_datagram/default_buffer_composer.h"
+
 #include "roc_packet/iaudio_packet.h"
 #include "roc_packet/packet_queue.h"
 #include "roc_packet/interleaver.h"
@@ -516,6 +518,10 @@ TEST(fec_codec_integration, encode_source_id_and_seqnum) {
                 LONGS_EQUAL(fec_source, p->source());
                 LONGS_EQUAL(fec_seqnum, p->seqnum());
                 fec_seqnum++;
+
+                const IFECPacket* fp = static_cast<const IFECPacket*>(p.get());
+                LONGS_EQUAL(N_DATA_PACKETS, fp->data_blksz());
+                LONGS_EQUAL(N_FEC_PACKETS, fp->fec_blksz());
             }
         }
 
@@ -675,5 +681,87 @@ TEST(fec_codec_integration, delayed_packets) {
     }
 }
 
+TEST(fec_codec_integration, custom_block_geometry) {
+    // 1. Encode packets using block geometry different from decoder's default.
+    // 2. Check that decoder takes geometry from FEC packets and repairs losses.
+
+    enum { N_DATA = 10, N_FEC = 5, N_BLKS = 4, N_PACKETS = N_DATA * N_BLKS };
+
+    BlockEncoder block_encoder(datagram::default_buffer_composer(), N_DATA, N_FEC);
+    BlockDecoder block_decoder;
+    rtp::Parser parser;
+
+    Encoder encoder(block_encoder, pckt_disp, composer);
+    Decoder decoder(block_decoder, pckt_disp.get_data_reader(),
+                    pckt_disp.get_fec_reader(), parser);
+
+    // Loses seqnum 12 and 32 (dispatcher counts packets modulo 30).
+    pckt_disp.lose(N_DATA + N_FEC + 2);
+
+    IPacketPtr many_packets[N_PACKETS];
+
+    for (size_t i = 0; i < N_PACKETS; ++i) {
+        many_packets[i] = fill_one_packet(i, N_PACKETS);
+        encoder.write(many_packets[i]);
+    }
+    pckt_disp.release_all();
+
+    LONGS_EQUAL(N_PACKETS - 2, pckt_disp.get_data_size());
+    LONGS_EQUAL(N_FEC * N_BLKS, pckt_disp.get_fec_size());
+
+    for (size_t i = 0; i < N_PACKETS; ++i) {
+        IPacketConstPtr p = decoder.read();
+        CHECK(p);
+        check_audio_packet(p, i, N_PACKETS);
+    }
+
+    CHECK(decoder.is_started());
+}
+
+TEST(fec_codec_integration, block_geometry_after_start) {
+    // 1. Deliver data packets of two blocks, holding FEC packets.
+    // 2. Start decoding using default geometry.
+    // 3. Deliver FEC packets with different geometry.
+    // 4. Check that decoder restarts from next block and repairs loss there.
+
+    enum { N_DATA = 10, N_FEC = 5, N_BLKS = 2, N_PACKETS = N_DATA * N_BLKS };
+
+    BlockEncoder block_encoder(datagram::default_buffer_composer(), N_DATA, N_FEC);
+    BlockDecoder block_decoder;
+    rtp::Parser parser;
+
+    Encoder encoder(block_encoder, pckt_disp, composer);
+    Decoder decoder(block_decoder, pckt_disp.get_data_reader(),
+                    pckt_disp.get_fec_reader(), parser);
+
+    // Loses seqnum 12.
+    pckt_disp.lose(N_DATA + N_FEC + 2);
+
+    IPacketPtr many_packets[N_PACKETS];
+
+    for (size_t i = 0; i < N_PACKETS; ++i) {
+        many_packets[i] = fill_one_packet(i, N_PACKETS);
+        encoder.write(many_packets[i]);
+    }
+
+    while (pckt_disp.pop_data()) {
+    }
+
+    for (size_t i = 0; i < 5; ++i) {
+        check_audio_packet(decoder.read(), i, N_PACKETS);
+    }
+
+    CHECK(decoder.is_started());
+
+    pckt_disp.release_all();
+
+    for (size_t i = 5; i < N_PACKETS; ++i) {
+        check_audio_packet(decoder.read(), i, N_PACKETS);
+    }
+
+    CHECK(decoder.is_started());
+    LONGS_EQUAL(0, pckt_disp.get_data_size());
+}
+
 } // namespace test
 } // namespace roc
@@ -0,0 +1,109 @@
+/*
+ * Copyright (c) 2015 Mikhail Baranov
+ * Copyright (c) 2015 Victor Gaydov
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <CppUTest/TestHarness.h>
+
+#include "roc_core/random.h"
+#include "roc_core/singleton.h"
+
+#include "roc_fec/gf256.h"
+#include "roc_fec/generic_gf256_kernel.h"
+#include "roc_fec/default_gf256_kernel.h"
+
+namespace roc {
+namespace test {
+
+using namespace fec;
+
+namespace {
+
+// Not multiple of vector width, to cover tail loops.
+enum { NumBytes = 259 };
+
+// Multiply using shift-and-add, independently of tables.
+uint8_t slow_mul(uint8_t a, uint8_t b) {
+    unsigned r = 0, x = a;
+    for (; b; b >>= 1) {
+        if (b & 1) {
+            r ^= x;
+        }
+        x <<= 1;
+        if (x & 0x100) {
+            x ^= 0x11d;
+        }
+    }
+    return (uint8_t)r;
+}
+
+} // namespace
+
+TEST_GROUP(gf256_kernel) {
+    uint8_t src[NumBytes];
+    uint8_t dst[NumBytes];
+
+    void setup() {
+        for (size_t n = 0; n < NumBytes; n++) {
+            src[n] = (uint8_t)core::random(0, 0xff);
+            dst[n] = (uint8_t)core::random(0, 0xff);
+        }
+    }
+
+    void check_mul_add(IGF256Kernel & kernel, uint8_t c) {
+        for (size_t off = 0; off < 4; off++) {
+            uint8_t expected[NumBytes];
+            for (size_t n = 0; n < NumBytes; n++) {
+                expected[n] = dst[n];
+            }
+            for (size_t n = off; n < NumBytes; n++) {
+                expected[n] ^= slow_mul(c, src[n - off]);
+            }
+
+            kernel.mul_add(dst + off, src, c, NumBytes - off);
+
+            for (size_t n = 0; n < NumBytes; n++) {
+                LONGS_EQUAL(expected[n], dst[n]);
+            }
+        }
+    }
+};
+
+TEST(gf256_kernel, field) {
+    const GF256& gf = core::Singleton<GF256>::instance();
+
+    for (unsigned a = 0; a < 256; a++) {
+        for (unsigned b = 0; b < 256; b++) {
+            LONGS_EQUAL(slow_mul((uint8_t)a, (uint8_t)b), gf.mul((uint8_t)a, (uint8_t)b));
+            if (b != 0) {
+                LONGS_EQUAL(a, gf.mul(gf.div((uint8_t)a, (uint8_t)b), (uint8_t)b));
+            }
+        }
+        if (a != 0) {
+            LONGS_EQUAL(1, gf.mul((uint8_t)a, gf.inv((uint8_t)a)));
+        }
+    }
+}
+
+TEST(gf256_kernel, generic) {
+    GenericGF256Kernel kernel;
+
+    for (unsigned c = 0; c < 256; c++) {
+        check_mul_add(kernel, (uint8_t)c);
+    }
+}
+
+TEST(gf256_kernel, default) {
+    IGF256Kernel& kernel = default_gf256_kernel();
+
+    for (unsigned c = 0; c < 256; c++) {
+        check_mul_add(kernel, (uint8_t)c);
+    }
+}
+
+} // namespace test
+} // namespace roc
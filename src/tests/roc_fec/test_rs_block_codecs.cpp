@@ -0,0 +1,255 @@
+/*
+ * Copyright (c) 2015 Mikhail Baranov
+ * Copyright (c) 2015 Victor Gaydov
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <CppUTest/TestHarness.h>
+
+#include "roc_config/config.h"
+
+#include "roc_core/byte_buffer.h"
+#include "roc_core/stddefs.h"
+#include "roc_core/random.h"
+#include "roc_core/array.h"
+
+#include "roc_fec/rs_block_encoder.h"
+#include "roc_fec/rs_block_decoder.h"
+#include "roc_fec/generic_gf256_kernel.h"
+
+namespace roc {
+namespace test {
+
+using namespace fec;
+
+namespace {
+
+const size_t N_DATA_PACKETS = ROC_CONFIG_DEFAULT_FEC_BLOCK_DATA_PACKETS;
+const size_t N_FEC_PACKETS = ROC_CONFIG_DEFAULT_FEC_BLOCK_REDUNDANT_PACKETS;
+
+const size_t MAX_DATA_PACKETS = ROC_CONFIG_MAX_FEC_BLOCK_DATA_PACKETS;
+const size_t MAX_FEC_PACKETS = ROC_CONFIG_MAX_FEC_BLOCK_REDUNDANT_PACKETS;
+
+const size_t SYMB_SZ = ROC_CONFIG_DEFAULT_PACKET_SIZE;
+
+} // namespace
+
+TEST_GROUP(rs_block_codecs) {
+    core::Array<core::IByteBufferConstSlice, MAX_DATA_PACKETS + MAX_FEC_PACKETS> buffers;
+    core::Array<bool, MAX_DATA_PACKETS + MAX_FEC_PACKETS> lost;
+
+    core::IByteBufferConstSlice make_buffer(size_t size) {
+        core::IByteBufferPtr buffer =
+            core::ByteBufferTraits::default_composer<SYMB_SZ>().compose();
+
+        buffer->set_size(size);
+
+        for (size_t j = 0; j < buffer->size(); ++j) {
+            buffer->data()[j] = (uint8_t)core::random(0, 0xff);
+        }
+
+        return *buffer;
+    }
+
+    void encode(IBlockEncoder & encoder, size_t size = SYMB_SZ) {
+        const size_t n_data = encoder.n_data_packets();
+        const size_t n_fec = encoder.n_fec_packets();
+
+        buffers.resize(n_data + n_fec);
+        lost.resize(n_data + n_fec);
+
+        for (size_t i = 0; i < n_data; ++i) {
+            buffers[i] = make_buffer(size);
+            encoder.write(i, buffers[i]);
+        }
+        encoder.commit();
+        for (size_t i = 0; i < n_fec; ++i) {
+            buffers[n_data + i] = encoder.read(i);
+            CHECK(buffers[n_data + i]);
+            LONGS_EQUAL(size, buffers[n_data + i].size());
+        }
+        encoder.reset();
+
+        for (size_t i = 0; i < lost.size(); ++i) {
+            lost[i] = false;
+        }
+    }
+
+    void lose_random(size_t n_lost) {
+        for (size_t i = 0; i < lost.size(); ++i) {
+            lost[i] = false;
+        }
+        for (size_t n = 0; n < n_lost;) {
+            const size_t i = core::random((unsigned)lost.size());
+            if (!lost[i]) {
+                lost[i] = true;
+                n++;
+            }
+        }
+    }
+
+    size_t decode(IBlockDecoder & decoder, size_t n_data) {
+        for (size_t i = 0; i < buffers.size(); ++i) {
+            if (!lost[i]) {
+                decoder.write(i, buffers[i]);
+            }
+        }
+
+        size_t n_failed = 0;
+
+        for (size_t i = 0; i < n_data; ++i) {
+            core::IByteBufferConstSlice decoded = decoder.repair(i);
+            if (!decoded) {
+                CHECK(lost[i]);
+                n_failed++;
+                continue;
+            }
+
+            LONGS_EQUAL(buffers[i].size(), decoded.size());
+            CHECK(memcmp(buffers[i].data(), decoded.data(), decoded.size()) == 0);
+        }
+
+        decoder.reset();
+
+        return n_failed;
+    }
+};
+
+TEST(rs_block_codecs, without_loss) {
+    RS_BlockEncoder encoder;
+    RS_BlockDecoder decoder;
+
+    encode(encoder);
+    LONGS_EQUAL(0, decode(decoder, N_DATA_PACKETS));
+}
+
+TEST(rs_block_codecs, every_single_loss) {
+    RS_BlockEncoder encoder;
+    RS_BlockDecoder decoder;
+
+    encode(encoder);
+
+    for (size_t i = 0; i < N_DATA_PACKETS + N_FEC_PACKETS; ++i) {
+        lost[i] = true;
+        LONGS_EQUAL(0, decode(decoder, N_DATA_PACKETS));
+        lost[i] = false;
+    }
+}
+
+TEST(rs_block_codecs, max_loss) {
+    enum { NumIterations = 100 };
+
+    RS_BlockEncoder encoder;
+    RS_BlockDecoder decoder;
+
+    // Any N_DATA_PACKETS received packets are enough.
+    for (size_t n = 0; n < NumIterations; ++n) {
+        encode(encoder);
+        lose_random(N_FEC_PACKETS);
+        LONGS_EQUAL(0, decode(decoder, N_DATA_PACKETS));
+    }
+
+    // Only FEC packets are used for lost data packets.
+    encode(encoder);
+    for (size_t i = 0; i < N_FEC_PACKETS; ++i) {
+        lost[i] = true;
+    }
+    LONGS_EQUAL(0, decode(decoder, N_DATA_PACKETS));
+}
+
+TEST(rs_block_codecs, too_many_losses) {
+    RS_BlockEncoder encoder;
+    RS_BlockDecoder decoder;
+
+    encode(encoder);
+    for (size_t i = 0; i <= N_FEC_PACKETS; ++i) {
+        lost[i] = true;
+    }
+    LONGS_EQUAL(N_FEC_PACKETS + 1, decode(decoder, N_DATA_PACKETS));
+}
+
+TEST(rs_block_codecs, write_after_repair) {
+    RS_BlockEncoder encoder;
+    RS_BlockDecoder decoder;
+
+    encode(encoder);
+
+    for (size_t i = 0; i < buffers.size(); ++i) {
+        if (i != 3) {
+            decoder.write(i, buffers[i]);
+        }
+    }
+
+    core::IByteBufferConstSlice decoded = decoder.repair(3);
+    CHECK(decoded);
+    CHECK(memcmp(buffers[3].data(), decoded.data(), SYMB_SZ) == 0);
+
+    // Late buffer is ignored since it's already repaired.
+    decoder.write(3, buffers[3]);
+    CHECK(decoder.repair(3).data() == decoded.data());
+
+    decoder.reset();
+}
+
+TEST(rs_block_codecs, custom_geometry) {
+    enum { NumData = 5, NumFec = 3, NumIterations = 20 };
+
+    RS_BlockEncoder encoder(datagram::default_buffer_composer(), NumData, NumFec);
+    RS_BlockDecoder decoder;
+
+    CHECK(decoder.resize(NumData, NumFec));
+
+    for (size_t n = 0; n < NumIterations; ++n) {
+        encode(encoder);
+        lose_random(NumFec);
+        LONGS_EQUAL(0, decode(decoder, NumData));
+    }
+
+    CHECK(!decoder.resize(0, NumFec));
+    CHECK(!decoder.resize(NumData, MAX_FEC_PACKETS + 1));
+}
+
+TEST(rs_block_codecs, max_geometry) {
+    RS_BlockEncoder encoder(datagram::default_buffer_composer(), MAX_DATA_PACKETS,
+                            MAX_FEC_PACKETS);
+    RS_BlockDecoder decoder;
+
+    CHECK(decoder.resize(MAX_DATA_PACKETS, MAX_FEC_PACKETS));
+
+    encode(encoder, 100);
+    for (size_t i = 0; i < MAX_DATA_PACKETS; ++i) {
+        lost[i] = true;
+    }
+    LONGS_EQUAL(0, decode(decoder, MAX_DATA_PACKETS));
+}
+
+TEST(rs_block_codecs, symbol_size) {
+    RS_BlockEncoder encoder;
+    RS_BlockDecoder decoder;
+
+    const size_t sizes[] = { 1, 15, 16, 17, 31, 33, 100, SYMB_SZ };
+
+    for (size_t n = 0; n < sizeof(sizes) / sizeof(sizes[0]); ++n) {
+        encode(encoder, sizes[n]);
+        lose_random(N_FEC_PACKETS);
+        LONGS_EQUAL(0, decode(decoder, N_DATA_PACKETS));
+    }
+}
+
+TEST(rs_block_codecs, generic_kernel) {
+    GenericGF256Kernel kernel;
+
+    RS_BlockEncoder encoder(datagram::default_buffer_composer(), N_DATA_PACKETS,
+                            N_FEC_PACKETS, &kernel);
+    RS_BlockDecoder decoder;
+
+    encode(encoder);
+    lose_random(N_FEC_PACKETS);
+    LONGS_EQUAL(0, decode(decoder, N_DATA_PACKETS));
+}
+
+} // namespace test
+} // namespace roc
@@ -0,0 +1,137 @@
+/*
+ * Copyright (c) 2015 Mikhail Baranov
+ * Copyright (c) 2015 Victor Gaydov
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <CppUTest/TestHarness.h>
+
+#include "roc_config/config.h"
+
+#include "roc_core/byte_buffer.h"
+#include "roc_core/stddefs.h"
+#include "roc_core/log.h"
+#include "roc_core/random.h"
+#include "roc_core/time.h"
+#include "roc_core/array.h"
+
+#include "roc_fec/rs_block_encoder.h"
+#include "roc_fec/rs_block_decoder.h"
+#include "roc_fec/generic_gf256_kernel.h"
+#include "roc_fec/default_gf256_kernel.h"
+
+namespace roc {
+namespace test {
+
+using namespace fec;
+
+namespace {
+
+const size_t N_DATA_PACKETS = ROC_CONFIG_DEFAULT_FEC_BLOCK_DATA_PACKETS;
+const size_t N_FEC_PACKETS = ROC_CONFIG_DEFAULT_FEC_BLOCK_REDUNDANT_PACKETS;
+
+const size_t SYMB_SZ = ROC_CONFIG_DEFAULT_PACKET_SIZE;
+
+enum { NumBlocks = 500 };
+
+} // namespace
+
+TEST_GROUP(rs_block_codecs_load) {
+    core::Array<core::IByteBufferConstSlice, N_DATA_PACKETS + N_FEC_PACKETS> buffers;
+
+    void setup() {
+        buffers.resize(N_DATA_PACKETS + N_FEC_PACKETS);
+
+        for (size_t i = 0; i < N_DATA_PACKETS; ++i) {
+            core::IByteBufferPtr buffer =
+                core::ByteBufferTraits::default_composer<SYMB_SZ>().compose();
+
+            buffer->set_size(SYMB_SZ);
+
+            for (size_t j = 0; j < buffer->size(); ++j) {
+                buffer->data()[j] = (uint8_t)core::random(0, 0xff);
+            }
+
+            buffers[i] = *buffer;
+        }
+    }
+
+    void encode(IBlockEncoder & encoder) {
+        for (size_t i = 0; i < N_DATA_PACKETS; ++i) {
+            encoder.write(i, buffers[i]);
+        }
+        encoder.commit();
+        for (size_t i = 0; i < N_FEC_PACKETS; ++i) {
+            buffers[N_DATA_PACKETS + i] = encoder.read(i);
+        }
+        encoder.reset();
+    }
+
+    // Loses first n_lost data buffers and returns number of restored ones.
+    size_t decode(IBlockDecoder & decoder, size_t n_lost) {
+        for (size_t i = n_lost; i < N_DATA_PACKETS + N_FEC_PACKETS; ++i) {
+            decoder.write(i, buffers[i]);
+        }
+
+        size_t n_repaired = 0;
+
+        for (size_t i = 0; i < n_lost; ++i) {
+            core::IByteBufferConstSlice decoded = decoder.repair(i);
+            if (decoded) {
+                CHECK(memcmp(buffers[i].data(), decoded.data(), SYMB_SZ) == 0);
+                n_repaired++;
+            }
+        }
+
+        decoder.reset();
+
+        return n_repaired;
+    }
+
+    void run(const IGF256Kernel& kernel) {
+        RS_BlockEncoder encoder(datagram::default_buffer_composer(), N_DATA_PACKETS,
+                                N_FEC_PACKETS, &kernel);
+        RS_BlockDecoder decoder(datagram::default_buffer_composer(), &kernel);
+
+        uint64_t start = core::timestamp_us();
+
+        for (size_t n = 0; n < NumBlocks; n++) {
+            encode(encoder);
+        }
+
+        report(kernel.name(), "encode", core::timestamp_us() - start);
+
+        size_t total_repaired = 0;
+
+        start = core::timestamp_us();
+
+        for (size_t n = 0; n < NumBlocks; n++) {
+            total_repaired += decode(decoder, N_FEC_PACKETS);
+        }
+
+        report(kernel.name(), "decode with max loss", core::timestamp_us() - start);
+
+        LONGS_EQUAL(NumBlocks * N_FEC_PACKETS, total_repaired);
+    }
+
+    void report(const char* kernel, const char* name, uint64_t elapsed_us) {
+        roc_log(LOG_DEBUG, "rs %s (%s): %u blocks in %u us, %u blocks/sec", name,
+                kernel, (unsigned)NumBlocks, (unsigned)elapsed_us,
+                (unsigned)(elapsed_us ? (uint64_t)NumBlocks * 1000000 / elapsed_us : 0));
+    }
+};
+
+TEST(rs_block_codecs_load, generic_kernel) {
+    GenericGF256Kernel kernel;
+    run(kernel);
+}
+
+TEST(rs_block_codecs_load, default_kernel) {
+    run(default_gf256_kernel());
+}
+
+} // namespace test
+} // namespace roc
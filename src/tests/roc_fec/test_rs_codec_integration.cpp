@@ -0,0 +1,340 @@
+/*
+ * Copyright (c) 2015 Mikhail Baranov
+ * Copyright (c) 2015 Victor Gaydov
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <CppUTest/TestHarness.h>
+
+#include "roc_core/random.h"
+#include "roc_core/heap_pool.h"
+
+#include "roc_fec/encoder.h"
+#include "roc_fec/decoder.h"
+#include "roc_fec/rs_block_encoder.h"
+#include "roc_fec/rs_block_decoder.h"
+#include "roc_fec/block_decoder_factory.h"
+
+#include "roc_datagram/default_buffer_composer.h"
+
+#include "roc_packet/iaudio_packet.h"
+#include "roc_packet/packet_queue.h"
+
+#include "roc_rtp/parser.h"
+#include "roc_rtp/composer.h"
+
+#include "roc_config/config.h"
+
+namespace roc {
+namespace test {
+
+using namespace fec;
+using namespace packet;
+
+namespace {
+
+const size_t N_DATA_PACKETS = ROC_CONFIG_DEFAULT_FEC_BLOCK_DATA_PACKETS;
+const size_t N_FEC_PACKETS = ROC_CONFIG_DEFAULT_FEC_BLOCK_REDUNDANT_PACKETS;
+
+const size_t N_SAMPLES = ROC_CONFIG_DEFAULT_PACKET_SAMPLES;
+
+const int LEFT = (1 << 0);
+const int RIGHT = (1 << 1);
+
+const size_t RATE = ROC_CONFIG_DEFAULT_SAMPLE_RATE;
+
+enum { MaxPackets = N_DATA_PACKETS + N_FEC_PACKETS };
+
+// Divides packets from Encoder into data and FEC queues, dropping packets
+// at given positions within block.
+class PacketDispatcher : public IPacketWriter {
+public:
+    PacketDispatcher()
+        : packet_num_(0)
+        , block_size_(MaxPackets)
+        , scheme_(FEC_ReedSolomon8) {
+        clear_losses();
+    }
+
+    virtual void write(const IPacketPtr& p) {
+        const bool is_lost = lost_[packet_num_];
+
+        if (++packet_num_ == block_size_) {
+            packet_num_ = 0;
+        }
+
+        if (is_lost) {
+            return;
+        }
+
+        if (p->type() == IAudioPacket::Type) {
+            data_queue_.write(p);
+        } else {
+            static_cast<IFECPacket*>(p.get())->set_scheme(scheme_);
+            fec_queue_.write(p);
+        }
+    }
+
+    IPacketReader& data_reader() {
+        return data_queue_;
+    }
+
+    IPacketReader& fec_reader() {
+        return fec_queue_;
+    }
+
+    size_t data_size() const {
+        return data_queue_.size();
+    }
+
+    void set_block_size(size_t n) {
+        block_size_ = n;
+    }
+
+    void lose(size_t n) {
+        lost_[n] = true;
+    }
+
+    bool is_lost(size_t n) const {
+        return lost_[n];
+    }
+
+    void clear_losses() {
+        for (size_t n = 0; n < MaxPackets; n++) {
+            lost_[n] = false;
+        }
+    }
+
+    void override_scheme(FECScheme scheme) {
+        scheme_ = scheme;
+    }
+
+private:
+    size_t packet_num_;
+    size_t block_size_;
+    bool lost_[MaxPackets];
+    FECScheme scheme_;
+
+    PacketQueue data_queue_;
+    PacketQueue fec_queue_;
+};
+
+// Counts allocated byte buffers.
+class CountingComposer : public core::IByteBufferComposer {
+public:
+    CountingComposer()
+        : composer_(datagram::default_buffer_composer())
+        , n_buffers_(0) {
+    }
+
+    virtual core::IByteBufferPtr compose() {
+        n_buffers_++;
+        return composer_.compose();
+    }
+
+    virtual core::IByteBufferPtr container_of(uint8_t* data) {
+        return composer_.container_of(data);
+    }
+
+    size_t num_buffers() const {
+        return n_buffers_;
+    }
+
+private:
+    core::IByteBufferComposer& composer_;
+    size_t n_buffers_;
+};
+
+} // namespace
+
+TEST_GROUP(rs_codec_integration) {
+    rtp::Composer composer;
+    rtp::Parser parser;
+
+    PacketDispatcher dispatcher;
+
+    IPacketPtr make_packet(size_t sn) {
+        IPacketPtr packet = composer.compose(IAudioPacket::Type);
+        CHECK(packet);
+
+        sample_t samples[N_SAMPLES * 2] = {};
+        for (size_t n = 0; n < N_SAMPLES * 2; n++) {
+            samples[n] = sample_t(sn % 100) / 100 + sample_t(n) / (N_SAMPLES * 4);
+        }
+
+        IAudioPacket* audio_packet = static_cast<IAudioPacket*>(packet.get());
+        audio_packet->set_seqnum((seqnum_t)sn);
+        audio_packet->set_size(LEFT | RIGHT, N_SAMPLES, RATE);
+        audio_packet->write_samples(LEFT | RIGHT, 0, samples, N_SAMPLES);
+
+        return packet;
+    }
+
+    void check_packet(const IPacketConstPtr& packet, size_t sn) {
+        CHECK(packet);
+        LONGS_EQUAL((seqnum_t)sn, packet->seqnum());
+
+        IPacketPtr expected = make_packet(sn);
+
+        const core::IByteBufferConstSlice actual_data = packet->raw_data();
+        const core::IByteBufferConstSlice expected_data = expected->raw_data();
+
+        LONGS_EQUAL(expected_data.size(), actual_data.size());
+
+        // Skip first two bytes, since marker bit is set by encoder.
+        CHECK(memcmp(expected_data.data() + 2, actual_data.data() + 2,
+                     actual_data.size() - 2)
+              == 0);
+    }
+};
+
+TEST(rs_codec_integration, max_loss_per_block) {
+    enum { NumBlocks = 20 };
+
+    RS_BlockEncoder block_encoder;
+    RS_BlockDecoder block_decoder;
+
+    Encoder encoder(block_encoder, dispatcher, composer);
+    Decoder decoder(block_decoder, dispatcher.data_reader(), dispatcher.fec_reader(),
+                    parser);
+
+    for (size_t blk = 0; blk < NumBlocks; blk++) {
+        dispatcher.clear_losses();
+
+        // Lose as many data packets as there are FEC packets, but keep first
+        // packet of first block, since decoding starts from marker bit.
+        for (size_t n = 0; n < N_FEC_PACKETS;) {
+            const size_t i = core::random(blk == 0 ? 1 : 0, N_DATA_PACKETS - 1);
+            if (!dispatcher.is_lost(i)) {
+                dispatcher.lose(i);
+                n++;
+            }
+        }
+
+        for (size_t i = 0; i < N_DATA_PACKETS; ++i) {
+            encoder.write(make_packet(blk * N_DATA_PACKETS + i));
+        }
+
+        for (size_t i = 0; i < N_DATA_PACKETS; ++i) {
+            check_packet(decoder.read(), blk * N_DATA_PACKETS + i);
+        }
+    }
+
+    LONGS_EQUAL(0, dispatcher.data_size());
+}
+
+TEST(rs_codec_integration, custom_block_geometry) {
+    enum { NumData = 6, NumFec = 3, NumBlocks = 10 };
+
+    RS_BlockEncoder block_encoder(datagram::default_buffer_composer(), NumData, NumFec);
+    RS_BlockDecoder block_decoder;
+
+    Encoder encoder(block_encoder, dispatcher, composer);
+    Decoder decoder(block_decoder, dispatcher.data_reader(), dispatcher.fec_reader(),
+                    parser, NumData, NumFec);
+
+    dispatcher.set_block_size(NumData + NumFec);
+
+    for (size_t blk = 0; blk < NumBlocks; blk++) {
+        if (blk == 1) {
+            dispatcher.lose(0);
+            dispatcher.lose(2);
+            dispatcher.lose(4);
+        }
+
+        for (size_t i = 0; i < NumData; ++i) {
+            encoder.write(make_packet(blk * NumData + i));
+        }
+    }
+
+    for (size_t sn = 0; sn < NumData * NumBlocks; sn++) {
+        check_packet(decoder.read(), sn);
+    }
+}
+
+TEST(rs_codec_integration, zero_copy) {
+    enum { NumBlocks = 10 };
+
+    CountingComposer buffer_composer;
+
+    rtp::Composer fec_composer(core::HeapPool<rtp::AudioPacket>::instance(),
+                               core::HeapPool<rtp::FECPacket>::instance(),
+                               buffer_composer);
+
+    RS_BlockEncoder block_encoder(buffer_composer);
+    RS_BlockDecoder block_decoder;
+
+    Encoder encoder(block_encoder, dispatcher, fec_composer);
+    Decoder decoder(block_decoder, dispatcher.data_reader(), dispatcher.fec_reader(),
+                    parser);
+
+    dispatcher.lose(3);
+    dispatcher.lose(7);
+
+    for (size_t blk = 0; blk < NumBlocks; blk++) {
+        for (size_t i = 0; i < N_DATA_PACKETS; ++i) {
+            encoder.write(make_packet(blk * N_DATA_PACKETS + i));
+        }
+
+        // One buffer per FEC packet; FEC symbols are encoded right into them.
+        LONGS_EQUAL((blk + 1) * N_FEC_PACKETS, buffer_composer.num_buffers());
+
+        for (size_t i = 0; i < N_DATA_PACKETS; ++i) {
+            check_packet(decoder.read(), blk * N_DATA_PACKETS + i);
+        }
+    }
+}
+
+TEST(rs_codec_integration, scheme_mismatch) {
+    RS_BlockEncoder block_encoder;
+    RS_BlockDecoder block_decoder;
+
+    Encoder encoder(block_encoder, dispatcher, composer);
+    Decoder decoder(block_decoder, dispatcher.data_reader(), dispatcher.fec_reader(),
+                    parser);
+
+    // FEC packets of other scheme can't be used for repair.
+    dispatcher.override_scheme(FEC_LDPC_Staircase);
+    dispatcher.lose(5);
+
+    for (size_t i = 0; i < N_DATA_PACKETS; ++i) {
+        encoder.write(make_packet(i));
+    }
+
+    for (size_t i = 0; i < N_DATA_PACKETS; ++i) {
+        if (i == 5) {
+            continue;
+        }
+        check_packet(decoder.read(), i);
+    }
+
+    CHECK(!decoder.read());
+}
+
+TEST(rs_codec_integration, block_decoder_factory) {
+    RS_BlockEncoder block_encoder;
+    BlockDecoderFactory block_decoder_factory;
+
+    Encoder encoder(block_encoder, dispatcher, composer);
+    Decoder decoder(block_decoder_factory, dispatcher.data_reader(),
+                    dispatcher.fec_reader(), parser);
+
+    // Block decoder is created for the scheme of the first FEC packet.
+    dispatcher.lose(5);
+
+    for (size_t i = 0; i < N_DATA_PACKETS; ++i) {
+        encoder.write(make_packet(i));
+    }
+
+    for (size_t i = 0; i < N_DATA_PACKETS; ++i) {
+        check_packet(decoder.read(), i);
+    }
+
+    CHECK(!decoder.read());
+}
+
+} // namespace test
+} // namespace roc
@@ -162,6 +162,100 @@ TEST(udp, one_sender_one_receiver_separate_threads) {
     rx.join();
 }
 
+TEST(udp, one_sender_one_receiver_unbatched) {
+    DatagramBlockingQueue queue;
+
+    Address tx_addr = make_address(1);
+    Address rx_addr = make_address(2);
+
+    UDPReceiverConfig config;
+    config.batch_size = 1;
+
+    Transceiver tx;
+    CHECK(tx.add_udp_sender(tx_addr));
+
+    Transceiver rx;
+    CHECK(rx.add_udp_receiver(rx_addr, queue, config));
+
+    tx.start();
+    rx.start();
+
+    for (int i = 0; i < NumIterations; i++) {
+        for (int p = 0; p < NumPackets; p++) {
+            send_datagram(tx, tx_addr, rx_addr, p, 66);
+        }
+        for (int p = 0; p < NumPackets; p++) {
+            wait_datagram(queue, tx_addr, rx_addr, p, 66);
+        }
+    }
+
+    tx.stop();
+    tx.join();
+
+    rx.stop();
+    rx.join();
+}
+
+TEST(udp, one_sender_one_receiver_socket_buffer_size) {
+    DatagramBlockingQueue queue;
+
+    Address tx_addr = make_address(1);
+    Address rx_addr = make_address(2);
+
+    UDPReceiverConfig config;
+    config.socket_buffer_size = NumPackets * BufferSize * 4;
+
+    Transceiver tx;
+    CHECK(tx.add_udp_sender(tx_addr));
+
+    Transceiver rx;
+    CHECK(rx.add_udp_receiver(rx_addr, queue, config));
+
+    tx.start();
+    rx.start();
+
+    for (int i = 0; i < NumIterations; i++) {
+        for (int p = 0; p < NumPackets; p++) {
+            send_datagram(tx, tx_addr, rx_addr, p, 44);
+        }
+        for (int p = 0; p < NumPackets; p++) {
+            wait_datagram(queue, tx_addr, rx_addr, p, 44);
+        }
+    }
+
+    tx.stop();
+    tx.join();
+
+    rx.stop();
+    rx.join();
+}
+
+#ifdef ROC_TARGET_LINUX
+TEST(udp, reuse_port) {
+    DatagramBlockingQueue queue;
+
+    Address rx_addr = make_address(1);
+
+    UDPReceiverConfig config;
+    config.reuse_port = true;
+
+    Transceiver rx1;
+    CHECK(rx1.add_udp_receiver(rx_addr, queue, config));
+
+    Transceiver rx2;
+    CHECK(rx2.add_udp_receiver(rx_addr, queue, config));
+
+    rx1.start();
+    rx2.start();
+
+    rx1.stop();
+    rx1.join();
+
+    rx2.stop();
+    rx2.join();
+}
+#endif // ROC_TARGET_LINUX
+
 TEST(udp, one_sender_multiple_receivers) {
     DatagramBlockingQueue queue1;
     DatagramBlockingQueue queue2;
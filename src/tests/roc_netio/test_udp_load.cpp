@@ -0,0 +1,233 @@
+/*
+ * Copyright (c) 2015 Mikhail Baranov
+ * Copyright (c) 2015 Victor Gaydov
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <CppUTest/TestHarness.h>
+
+#include "roc_core/log.h"
+#include "roc_core/helpers.h"
+#include "roc_core/time.h"
+#include "roc_core/heap_pool.h"
+#include "roc_netio/transceiver.h"
+#include "roc_netio/udp_sender.h"
+#include "roc_netio/udp_receiver.h"
+
+#include "test_datagram_blocking_queue.h"
+
+namespace roc {
+namespace test {
+
+using namespace netio;
+using namespace datagram;
+
+namespace {
+
+class CountingWriter : public IDatagramWriter {
+public:
+    CountingWriter()
+        : n_datagrams_(0) {
+    }
+
+    virtual void write(const IDatagramPtr& dgm) {
+        CHECK(dgm);
+        n_datagrams_++;
+    }
+
+    size_t num_datagrams() const {
+        return n_datagrams_;
+    }
+
+private:
+    size_t n_datagrams_;
+};
+
+} // namespace
+
+TEST_GROUP(udp_load) {
+    enum {
+        // Number of datagrams sent before waiting for them.
+        BurstSize = 50,
+
+        // Number of measured bursts.
+        NumBursts = 400,
+
+        // Number of datagrams in FEC block.
+        BlockSize = ROC_CONFIG_DEFAULT_FEC_BLOCK_DATA_PACKETS
+            + ROC_CONFIG_DEFAULT_FEC_BLOCK_REDUNDANT_PACKETS,
+
+        // Datagram payload size.
+        BufferSize = ROC_CONFIG_DEFAULT_PACKET_SIZE
+    };
+
+    Address make_address(int number) {
+        Address addr;
+        addr.ip[0] = 127;
+        addr.ip[1] = 0;
+        addr.ip[2] = 0;
+        addr.ip[3] = 1;
+        addr.port = port_t(11000 + number);
+        return addr;
+    }
+
+    // Sends datagrams through loopback to receiver with given parameters and
+    // returns number of datagrams received per second.
+    double run(const UDPReceiverConfig& config) {
+        DatagramBlockingQueue queue;
+
+        Address tx_addr = make_address(1);
+        Address rx_addr = make_address(2);
+
+        Transceiver tx;
+        CHECK(tx.add_udp_sender(tx_addr));
+
+        Transceiver rx;
+        CHECK(rx.add_udp_receiver(rx_addr, queue, config));
+
+        tx.start();
+        rx.start();
+
+        core::IByteBufferPtr buff = default_buffer_composer().compose();
+        CHECK(buff);
+
+        buff->set_size(BufferSize);
+        memset(buff->data(), 0, BufferSize);
+
+        const uint64_t start = core::timestamp_ms();
+
+        for (size_t b = 0; b < NumBursts; b++) {
+            for (size_t p = 0; p < BurstSize; p++) {
+                IDatagramPtr dgm = tx.udp_composer().compose();
+                CHECK(dgm);
+
+                dgm->set_sender(tx_addr);
+                dgm->set_receiver(rx_addr);
+                dgm->set_buffer(*buff);
+
+                tx.udp_sender().write(dgm);
+            }
+            for (size_t p = 0; p < BurstSize; p++) {
+                IDatagramConstPtr dgm = queue.read();
+                CHECK(dgm);
+                LONGS_EQUAL(BufferSize, dgm->buffer().size());
+            }
+        }
+
+        const uint64_t elapsed = core::timestamp_ms() - start;
+
+        tx.stop();
+        tx.join();
+
+        rx.stop();
+        rx.join();
+
+        return double(NumBursts * BurstSize) * 1000 / double(elapsed ? elapsed : 1);
+    }
+
+    // Sends datagrams in blocks through loopback using sender with given batch
+    // size, running sender and receiver in single event loop. Returns number
+    // of system calls per datagram used by sender.
+    double run_sender(size_t batch_size) {
+        uv_loop_t loop;
+        LONGS_EQUAL(0, uv_loop_init(&loop));
+
+        uv_async_t eof;
+        LONGS_EQUAL(0, uv_async_init(&loop, &eof, NULL));
+
+        UDPComposer composer(core::HeapPool<UDPDatagram>::instance());
+        CountingWriter writer;
+
+        Address tx_addr = make_address(3);
+        Address rx_addr = make_address(4);
+
+        UDPReceiver receiver(default_buffer_composer(), composer);
+        receiver.attach(loop);
+        CHECK(receiver.add_port(rx_addr, writer));
+
+        UDPSender sender(batch_size);
+        sender.attach(loop, eof);
+        CHECK(sender.add_port(tx_addr));
+
+        core::IByteBufferPtr buff = default_buffer_composer().compose();
+        CHECK(buff);
+
+        buff->set_size(BufferSize);
+        memset(buff->data(), 0, BufferSize);
+
+        for (size_t b = 0; b < NumBursts; b++) {
+            for (size_t p = 0; p < BlockSize; p++) {
+                IDatagramPtr dgm = composer.compose();
+                CHECK(dgm);
+
+                dgm->set_sender(tx_addr);
+                dgm->set_receiver(rx_addr);
+                dgm->set_buffer(*buff);
+
+                sender.write(dgm);
+            }
+            while (writer.num_datagrams() < (b + 1) * BlockSize) {
+                uv_run(&loop, UV_RUN_ONCE);
+            }
+        }
+
+        LONGS_EQUAL(NumBursts * BlockSize, sender.num_sent());
+
+        const double syscalls_per_datagram =
+            double(sender.num_syscalls()) / double(sender.num_sent());
+
+        receiver.detach(loop);
+        sender.detach(loop);
+
+        uv_close((uv_handle_t*)&eof, NULL);
+        uv_run(&loop, UV_RUN_DEFAULT);
+
+        LONGS_EQUAL(0, uv_loop_close(&loop));
+
+        return syscalls_per_datagram;
+    }
+};
+
+TEST(udp_load, batch_size) {
+    const size_t batch_sizes[] = { 1, 8, ROC_CONFIG_DEFAULT_UDP_BATCH,
+                                   ROC_CONFIG_MAX_UDP_BATCH };
+
+    for (size_t n = 0; n < ROC_ARRAY_SIZE(batch_sizes); n++) {
+        UDPReceiverConfig config;
+        config.batch_size = batch_sizes[n];
+
+        const double pps = run(config);
+
+        roc_log(LOG_DEBUG, "udp load: batch_size=%u datagrams_per_second=%.0f",
+                (unsigned)batch_sizes[n], pps);
+    }
+}
+
+TEST(udp_load, socket_buffer_size) {
+    UDPReceiverConfig config;
+    config.socket_buffer_size = BurstSize * BufferSize * 4;
+
+    const double pps = run(config);
+
+    roc_log(LOG_DEBUG,
+            "udp load: batch_size=%u socket_buffer_size=%u datagrams_per_second=%.0f",
+            (unsigned)config.batch_size, (unsigned)config.socket_buffer_size, pps);
+}
+
+TEST(udp_load, sender_batch_size) {
+    const size_t batch_sizes[] = { 1, 8, ROC_CONFIG_DEFAULT_UDP_BATCH,
+                                   ROC_CONFIG_MAX_UDP_BATCH };
+
+    for (size_t n = 0; n < ROC_ARRAY_SIZE(batch_sizes); n++) {
+        const double syscalls = run_sender(batch_sizes[n]);
+
+        roc_log(LOG_DEBUG, "udp load: sender_batch_size=%u syscalls_per_datagram=%.3f",
+                (unsigned)batch_sizes[n], syscalls);
+    }
+}
+
+} // namespace test
+} // namespace roc
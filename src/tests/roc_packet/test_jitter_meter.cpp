@@ -0,0 +1,153 @@
+/*
+ * Copyright (c) 2015 Mikhail Baranov
+ * Copyright (c) 2015 Victor Gaydov
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <CppUTest/TestHarness.h>
+
+#include "roc_config/config.h"
+#include "roc_core/scoped_ptr.h"
+
+#include "roc_packet/packet_queue.h"
+#include "roc_packet/jitter_meter.h"
+
+#include "test_packet.h"
+
+namespace roc {
+namespace test {
+
+using namespace packet;
+
+TEST_GROUP(jitter_meter) {
+    enum {
+        TickSamples = 100,
+        PktSamples = TickSamples * 2,
+        Rate = ROC_CONFIG_DEFAULT_SAMPLE_RATE
+    };
+
+    PacketQueue queue;
+
+    core::ScopedPtr<JitterMeter> meter;
+
+    void setup() {
+        meter.reset(new JitterMeter(queue, TickSamples));
+    }
+
+    void add_packet(seqnum_t sn, timestamp_t ts) {
+        IAudioPacketPtr pkt = new_audio_packet(0, sn, ts);
+        pkt->set_size(0x1, PktSamples, Rate);
+        meter->write(pkt);
+    }
+
+    void tick(size_t n_ticks) {
+        for (size_t n = 0; n < n_ticks; n++) {
+            CHECK(meter->update());
+        }
+    }
+};
+
+TEST(jitter_meter, no_packets) {
+    tick(10);
+
+    DOUBLES_EQUAL(0, meter->jitter(), 0);
+    LONGS_EQUAL(0, meter->num_received());
+    LONGS_EQUAL(0, meter->num_lost());
+    LONGS_EQUAL(0, meter->packet_samples());
+}
+
+TEST(jitter_meter, write) {
+    add_packet(1, PktSamples);
+    add_packet(2, PktSamples * 2);
+
+    LONGS_EQUAL(2, queue.size());
+    LONGS_EQUAL(1, queue.read()->seqnum());
+    LONGS_EQUAL(2, queue.read()->seqnum());
+
+    LONGS_EQUAL(2, meter->num_received());
+    LONGS_EQUAL(PktSamples, meter->packet_samples());
+}
+
+TEST(jitter_meter, no_jitter) {
+    enum { NumPackets = 100 };
+
+    for (seqnum_t sn = 0; sn < NumPackets; sn++) {
+        add_packet(sn, sn * PktSamples);
+        tick(PktSamples / TickSamples);
+    }
+
+    DOUBLES_EQUAL(0, meter->jitter(), 0);
+    LONGS_EQUAL(NumPackets, meter->num_received());
+    LONGS_EQUAL(0, meter->num_lost());
+}
+
+TEST(jitter_meter, constant_jitter) {
+    enum { NumPackets = 1000, Delay = TickSamples };
+
+    // Every second packet is delayed by one tick, so that transit time
+    // differs by Delay samples between every two consecutive packets.
+    for (seqnum_t sn = 0; sn < NumPackets; sn += 2) {
+        add_packet(sn, sn * PktSamples);
+        tick(Delay / TickSamples);
+        add_packet(seqnum_t(sn + 1), (sn + 1) * PktSamples);
+        tick(PktSamples * 2 / TickSamples - Delay / TickSamples);
+    }
+
+    DOUBLES_EQUAL(Delay, meter->jitter(), 0.1);
+    LONGS_EQUAL(0, meter->num_lost());
+}
+
+TEST(jitter_meter, jitter_decays) {
+    enum { NumPackets = 200, Delay = TickSamples * 10 };
+
+    add_packet(0, 0);
+    tick(Delay / TickSamples);
+    add_packet(1, PktSamples);
+
+    DOUBLES_EQUAL(Delay - PktSamples, meter->jitter() * 16, 0.1);
+
+    for (seqnum_t sn = 2; sn < NumPackets; sn++) {
+        tick(PktSamples / TickSamples);
+        add_packet(sn, sn * PktSamples);
+    }
+
+    CHECK(meter->jitter() < 1);
+}
+
+TEST(jitter_meter, losses) {
+    add_packet(1, PktSamples);
+    add_packet(2, PktSamples * 2);
+    add_packet(5, PktSamples * 5);
+    add_packet(4, PktSamples * 4);
+    add_packet(9, PktSamples * 9);
+
+    LONGS_EQUAL(5, meter->num_received());
+    LONGS_EQUAL(4, meter->num_lost());
+}
+
+TEST(jitter_meter, losses_seqnum_overflow) {
+    const seqnum_t sn = seqnum_t(-3);
+
+    add_packet(sn, 0);
+    add_packet(seqnum_t(sn + 1), PktSamples);
+    add_packet(seqnum_t(sn + 4), PktSamples * 4);
+    add_packet(seqnum_t(sn + 5), PktSamples * 5);
+
+    LONGS_EQUAL(4, meter->num_received());
+    LONGS_EQUAL(2, meter->num_lost());
+}
+
+TEST(jitter_meter, duplicates) {
+    add_packet(1, PktSamples);
+    add_packet(2, PktSamples * 2);
+    add_packet(2, PktSamples * 2);
+
+    LONGS_EQUAL(3, meter->num_received());
+    LONGS_EQUAL(0, meter->num_lost());
+}
+
+} // namespace test
+} // namespace roc
@@ -9,6 +9,8 @@
 
 #include <CppUTest/TestHarness.h>
 
+#include "roc_config/config.h"
+#include "roc_core/helpers.h"
 #include "roc_packet/packet_queue.h"
 
 #include "test_packet.h"
@@ -203,6 +205,87 @@ TEST(packet_queue, max_size) {
     CHECK(queue.tail() == p3);
 }
 
+TEST(packet_queue, max_size_with_gaps) {
+    PacketQueue queue(2);
+
+    IPacketPtr p1 = new_packet(1);
+    IPacketPtr p2 = new_packet(1 + ROC_CONFIG_MAX_SN_JUMP);
+
+    queue.write(p2);
+    queue.write(p1);
+
+    LONGS_EQUAL(2, queue.size());
+
+    CHECK(queue.head() == p1);
+    CHECK(queue.tail() == p2);
+
+    CHECK(queue.read() == p1);
+    CHECK(queue.read() == p2);
+
+    CHECK(!queue.read());
+}
+
+TEST(packet_queue, max_size_too_large_jump) {
+    PacketQueue queue(2);
+
+    IPacketPtr p1 = new_packet(1);
+    IPacketPtr p2 = new_packet(1 + 2 + ROC_CONFIG_MAX_SN_JUMP);
+
+    queue.write(p1);
+    queue.write(p2);
+
+    LONGS_EQUAL(1, queue.size());
+
+    queue.write(new_packet(1 + 1 + ROC_CONFIG_MAX_SN_JUMP));
+
+    LONGS_EQUAL(2, queue.size());
+
+    CHECK(queue.head() == p1);
+    LONGS_EQUAL(1 + 1 + ROC_CONFIG_MAX_SN_JUMP, queue.tail()->seqnum());
+}
+
+TEST(packet_queue, large_gaps) {
+    const seqnum_t seqnums[] = { 5000, 10, 20000, 300, 4999, 20001 };
+    const size_t num_packets = ROC_ARRAY_SIZE(seqnums);
+
+    PacketQueue queue;
+
+    for (size_t n = 0; n < num_packets; n++) {
+        queue.write(new_packet(seqnums[n]));
+    }
+
+    LONGS_EQUAL(num_packets, queue.size());
+
+    LONGS_EQUAL(10, queue.head()->seqnum());
+    LONGS_EQUAL(20001, queue.tail()->seqnum());
+
+    const seqnum_t sorted[] = { 10, 300, 4999, 5000, 20000, 20001 };
+
+    for (size_t n = 0; n < num_packets; n++) {
+        LONGS_EQUAL(sorted[n], queue.read()->seqnum());
+    }
+
+    LONGS_EQUAL(0, queue.size());
+
+    CHECK(!queue.read());
+}
+
+TEST(packet_queue, duplicate_after_gap) {
+    PacketQueue queue;
+
+    queue.write(new_packet(1));
+    queue.write(new_packet(3000));
+    queue.write(new_packet(3000));
+    queue.write(new_packet(1));
+
+    LONGS_EQUAL(2, queue.size());
+
+    LONGS_EQUAL(1, queue.read()->seqnum());
+    LONGS_EQUAL(3000, queue.read()->seqnum());
+
+    CHECK(!queue.read());
+}
+
 TEST(packet_queue, overflow_ordered1) {
     const seqnum_t sn = seqnum_t(-1);
 
@@ -0,0 +1,153 @@
+/*
+ * Copyright (c) 2015 Mikhail Baranov
+ * Copyright (c) 2015 Victor Gaydov
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <CppUTest/TestHarness.h>
+
+#include "roc_config/config.h"
+#include "roc_core/log.h"
+#include "roc_core/time.h"
+#include "roc_packet/packet_queue.h"
+#include "roc_packet/spoiler.h"
+#include "roc_packet/interleaver.h"
+
+#include "test_packet.h"
+
+namespace roc {
+namespace test {
+
+using namespace packet;
+
+namespace {
+
+enum {
+    // Number of packets written to queue.
+    NumPackets = 50000,
+
+    // Number of packets kept in queue.
+    QueueSize = ROC_CONFIG_MAX_SESSION_PACKETS - 100,
+
+    // Every LatePeriod-th packet arrives LateDelay packets later.
+    LatePeriod = 10,
+    LateDelay = 200,
+
+    // Percentage of lost packets.
+    LossRate = 5
+};
+
+// Writes packets to queue and reads oldest ones when queue grows
+// above QueueSize.
+class QueueWriter : public IPacketWriter {
+public:
+    QueueWriter(PacketQueue& queue)
+        : queue_(queue) {
+    }
+
+    virtual void write(const IPacketPtr& packet) {
+        queue_.write(packet);
+
+        while (queue_.size() > QueueSize) {
+            CHECK(queue_.read());
+        }
+    }
+
+private:
+    PacketQueue& queue_;
+};
+
+// Delays some packets.
+class LateWriter : public IPacketWriter {
+public:
+    LateWriter(IPacketWriter& writer)
+        : writer_(writer)
+        , n_packets_(0) {
+    }
+
+    virtual void write(const IPacketPtr& packet) {
+        IPacketPtr& delayed = delayed_[n_packets_ % LateDelay];
+
+        if (delayed) {
+            writer_.write(delayed);
+            delayed = NULL;
+        }
+
+        if (n_packets_ % LatePeriod == 0) {
+            delayed = packet;
+        } else {
+            writer_.write(packet);
+        }
+
+        n_packets_++;
+    }
+
+private:
+    IPacketWriter& writer_;
+    IPacketPtr delayed_[LateDelay];
+    size_t n_packets_;
+};
+
+} // namespace
+
+TEST_GROUP(packet_queue_load) {
+    IPacketPtr packets[NumPackets];
+
+    void setup() {
+        // Start near seqnum overflow.
+        const seqnum_t first_sn = seqnum_t(-1) - NumPackets / 2;
+
+        for (size_t n = 0; n < NumPackets; n++) {
+            packets[n] = new_audio_packet(0, seqnum_t(first_sn + n), 0);
+        }
+    }
+
+    // Passes packets through writer and returns time per packet, in
+    // nanoseconds.
+    double run(IPacketWriter& writer) {
+        const uint64_t start = core::timestamp_us();
+
+        for (size_t n = 0; n < NumPackets; n++) {
+            writer.write(packets[n]);
+        }
+
+        return double(core::timestamp_us() - start) * 1000 / NumPackets;
+    }
+};
+
+TEST(packet_queue_load, in_order) {
+    PacketQueue queue(ROC_CONFIG_MAX_SESSION_PACKETS);
+    QueueWriter queue_writer(queue);
+
+    const double ns = run(queue_writer);
+
+    roc_log(LOG_DEBUG, "packet queue load: in_order: %.1fns per packet", ns);
+}
+
+TEST(packet_queue_load, reordered) {
+    PacketQueue queue(ROC_CONFIG_MAX_SESSION_PACKETS);
+    QueueWriter queue_writer(queue);
+
+    LateWriter late_writer(queue_writer);
+
+    Interleaver interleaver(late_writer);
+
+    Spoiler spoiler(interleaver);
+    spoiler.set_random_loss(LossRate);
+
+    const double ns = run(spoiler);
+
+    interleaver.flush();
+
+    roc_log(LOG_DEBUG,
+            "packet queue load: reordered: %.1fns per packet"
+            " (loss=%u%% late=1/%u delay=%u interleaver=%u)",
+            ns, (unsigned)LossRate, (unsigned)LatePeriod, (unsigned)LateDelay,
+            (unsigned)interleaver.window_size());
+}
+
+} // namespace test
+} // namespace roc
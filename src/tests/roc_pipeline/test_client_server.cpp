@@ -25,6 +25,36 @@ namespace test {
 
 using namespace pipeline;
 
+namespace {
+
+// Datagram queue that loses datagram with given number.
+class LossyDatagramQueue : public datagram::DatagramQueue {
+public:
+    LossyDatagramQueue()
+        : lost_(0)
+        , lose_(false)
+        , n_written_(0) {
+    }
+
+    void lose(size_t n) {
+        lost_ = n;
+        lose_ = true;
+    }
+
+    virtual void write(const datagram::IDatagramPtr& dgm) {
+        if (!lose_ || n_written_++ != lost_) {
+            datagram::DatagramQueue::write(dgm);
+        }
+    }
+
+private:
+    size_t lost_;
+    bool lose_;
+    size_t n_written_;
+};
+
+} // namespace
+
 TEST_GROUP(client_server) {
     enum {
         // Sending port.
@@ -46,13 +76,17 @@ TEST_GROUP(client_server) {
         MaxBuffers = PktSamples * 100 / BufSamples,
 
         // Percentage of packets to be lost.
-        RandomLoss = 1
+        RandomLoss = 1,
+
+        // Number of datagrams per FEC block.
+        BlockDatagrams = ROC_CONFIG_DEFAULT_FEC_BLOCK_DATA_PACKETS
+            + ROC_CONFIG_DEFAULT_FEC_BLOCK_REDUNDANT_PACKETS
     };
 
     SampleQueue<MaxBuffers> input;
     SampleQueue<MaxBuffers> output;
 
-    datagram::DatagramQueue network;
+    LossyDatagramQueue network;
     TestDatagramComposer datagram_composer;
 
     rtp::Composer packet_composer;
@@ -70,12 +104,19 @@ TEST_GROUP(client_server) {
         LONGS_EQUAL(0, network.size());
     }
 
-    void init_client(int options, size_t random_loss = 0) {
+    void init_client(int options,
+                     size_t random_loss = 0,
+                     packet::FECScheme fec_scheme = packet::FEC_LDPC_Staircase,
+                     packet::SampleFormat sample_format = packet::Sample_L16) {
         ClientConfig config;
 
         config.options = options;
+        config.fec_scheme = fec_scheme;
         config.channels = ChannelMask;
-        config.samples_per_packet = PktSamples;
+        config.sample_format = sample_format;
+        // Wider samples need smaller packets to fit into datagram.
+        config.samples_per_packet =
+            (sample_format == packet::Sample_L16 ? PktSamples : PktSamples / 2);
         config.random_loss_rate = random_loss;
 
         client.reset(
@@ -139,12 +180,80 @@ TEST(client_server, bare) {
     flow_client_server();
 }
 
+TEST(client_server, static_pipeline) {
+    init_client(0);
+    init_server(EnableStaticPipeline);
+    flow_client_server();
+}
+
 TEST(client_server, interleaving) {
     init_client(EnableInterleaving);
     init_server(0);
     flow_client_server();
 }
 
+TEST(client_server, l24) {
+    init_client(0, 0, packet::FEC_LDPC_Staircase, packet::Sample_L24);
+    init_server(0);
+    flow_client_server();
+}
+
+TEST(client_server, float32) {
+    init_client(0, 0, packet::FEC_LDPC_Staircase, packet::Sample_Float32);
+    init_server(0);
+    flow_client_server();
+}
+
+TEST(client_server, rs_only_client) {
+    init_client(EnableFEC, 0, packet::FEC_ReedSolomon8);
+    init_server(0);
+    flow_client_server();
+}
+
+TEST(client_server, rs_only_server) {
+    init_client(0);
+    init_server(EnableFEC);
+    flow_client_server();
+}
+
+TEST(client_server, rs) {
+    init_client(EnableFEC, 0, packet::FEC_ReedSolomon8);
+    init_server(EnableFEC);
+    flow_client_server();
+}
+
+TEST(client_server, rs_static_pipeline) {
+    init_client(EnableFEC, 0, packet::FEC_ReedSolomon8);
+    init_server(EnableFEC | EnableStaticPipeline);
+    flow_client_server();
+}
+
+TEST(client_server, rs_interleaving) {
+    init_client(EnableFEC | EnableInterleaving, 0, packet::FEC_ReedSolomon8);
+    init_server(EnableFEC);
+    flow_client_server();
+}
+
+TEST(client_server, rs_float32) {
+    init_client(EnableFEC | EnableInterleaving, 0, packet::FEC_ReedSolomon8,
+                packet::Sample_Float32);
+    init_server(EnableFEC);
+    flow_client_server();
+}
+
+TEST(client_server, rs_loss) {
+    init_client(EnableFEC, 0, packet::FEC_ReedSolomon8);
+    init_server(EnableFEC);
+    network.lose(BlockDatagrams * 2 + 5);
+    flow_client_server();
+}
+
+IGNORE_TEST(client_server, rs_random_loss) {
+    init_client(EnableFEC, RandomLoss, packet::FEC_ReedSolomon8);
+    init_server(EnableFEC);
+    flow_client_server();
+}
+
 #ifdef ROC_TARGET_OPENFEC
 TEST(client_server, ldpc_only_client) {
     init_client(EnableFEC);
@@ -170,6 +279,13 @@ TEST(client_server, ldpc_interleaving) {
     flow_client_server();
 }
 
+TEST(client_server, ldpc_loss) {
+    init_client(EnableFEC);
+    init_server(EnableFEC);
+    network.lose(BlockDatagrams * 2 + 5);
+    flow_client_server();
+}
+
 IGNORE_TEST(client_server, ldpc_random_loss) {
     init_client(EnableFEC, RandomLoss);
     init_server(EnableFEC);
@@ -13,6 +13,7 @@
 #include <CppUTest/TestHarness.h>
 
 #include "roc_core/noncopyable.h"
+#include "roc_core/heap_pool.h"
 
 #include "roc_datagram/idatagram.h"
 #include "roc_datagram/idatagram_composer.h"
@@ -52,7 +53,7 @@ public:
 
 private:
     virtual void free() {
-        delete this;
+        core::HeapPool<TestDatagram>::instance().destroy(*this);
     }
 
     core::IByteBufferConstSlice buffer_;
@@ -65,7 +66,7 @@ class TestDatagramComposer : public datagram::IDatagramComposer,
                              public core::NonCopyable<> {
 public:
     virtual datagram::IDatagramPtr compose() {
-        return new TestDatagram;
+        return new (core::HeapPool<TestDatagram>::instance()) TestDatagram;
     }
 };
 
@@ -0,0 +1,164 @@
+/*
+ * Copyright (c) 2015 Mikhail Baranov
+ * Copyright (c) 2015 Victor Gaydov
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <CppUTest/TestHarness.h>
+
+#include "roc_config/config.h"
+#include "roc_core/log.h"
+#include "roc_rtp/parser.h"
+#include "roc_datagram/datagram_queue.h"
+#include "roc_pipeline/server.h"
+
+#include "test_packet_stream.h"
+
+namespace roc {
+namespace test {
+
+using namespace pipeline;
+
+namespace {
+
+class FirstAudioWriter : public audio::ISampleBufferWriter {
+public:
+    FirstAudioWriter()
+        : n_buffers_(0)
+        , first_audio_(0)
+        , has_audio_(false) {
+    }
+
+    virtual void write(const audio::ISampleBufferConstSlice& buffer) {
+        CHECK(buffer);
+
+        if (!has_audio_) {
+            for (size_t n = 0; n < buffer.size(); n++) {
+                if (buffer.data()[n] > 0 || buffer.data()[n] < 0) {
+                    has_audio_ = true;
+                    first_audio_ = n_buffers_;
+                    break;
+                }
+            }
+        }
+
+        n_buffers_++;
+    }
+
+    bool has_audio() const {
+        return has_audio_;
+    }
+
+    size_t first_audio() const {
+        return first_audio_;
+    }
+
+private:
+    size_t n_buffers_;
+    size_t first_audio_;
+    bool has_audio_;
+};
+
+struct FastStartResult {
+    size_t first_audio_ms;
+    size_t final_latency;
+    size_t missing_samples;
+};
+
+} // namespace
+
+TEST_GROUP(fast_start_load) {
+    enum {
+        // Number of samples in every channel per tick.
+        TickSamples = ROC_CONFIG_DEFAULT_SERVER_TICK_SAMPLES,
+
+        // Number of samples in every channel per packet.
+        PktSamples = ROC_CONFIG_DEFAULT_PACKET_SAMPLES,
+
+        // Session latency.
+        LatencySamples = ROC_CONFIG_DEFAULT_SESSION_LATENCY,
+
+        // Latency at which fast start begins playback.
+        FastStartSamples = ROC_CONFIG_DEFAULT_FAST_START_LATENCY,
+
+        // Number of ticks.
+        NumTicks = SampleRate * 60 / TickSamples
+    };
+
+    rtp::Parser parser;
+
+    // Sends packets to server at real rate, measures time from first packet
+    // to first non-zero output sample, and returns latency and number of
+    // missing samples at the end of stream.
+    FastStartResult run(int options) {
+        ServerConfig config;
+
+        config.options = EnableResampling | options;
+        config.channels = ChannelMask;
+        config.session_timeout = LatencySamples * 10;
+        config.session_latency = LatencySamples;
+        config.fast_start_latency = FastStartSamples;
+        config.output_latency = 0;
+        config.samples_per_tick = TickSamples;
+        config.resampler_type = ResamplerPolyphase;
+
+        datagram::DatagramQueue input;
+        FirstAudioWriter output;
+
+        Server server(input, output, config);
+        server.add_port(new_address(PacketStream::DstPort), parser);
+
+        PacketStream ps;
+
+        for (size_t tick = 0; tick < NumTicks; tick++) {
+            const packet::timestamp_t now = packet::timestamp_t(tick * TickSamples);
+
+            while (ps.ts <= now) {
+                ps.write(input, 1, PktSamples);
+            }
+
+            CHECK(server.tick());
+        }
+
+        CHECK(output.has_audio());
+        LONGS_EQUAL(1, server.num_sessions());
+
+        const SessionStats stats = server.session_stats(0);
+
+        FastStartResult result;
+        result.first_audio_ms = output.first_audio() * TickSamples * 1000 / SampleRate;
+        result.final_latency = stats.latency;
+        result.missing_samples = stats.num_missing_samples;
+
+        roc_log(LOG_DEBUG,
+                "fast start: fast_start=%d first_audio_ms=%u final_latency=%u"
+                " missing_samples=%u",
+                (int)!!(options & EnableFastStart), (unsigned)result.first_audio_ms,
+                (unsigned)result.final_latency, (unsigned)result.missing_samples);
+
+        return result;
+    }
+};
+
+TEST(fast_start_load, time_to_first_audio) {
+    const FastStartResult normal = run(0);
+    const FastStartResult fast = run(EnableFastStart);
+
+    // Fast start begins playback after fast_start_latency instead of
+    // session_latency.
+    CHECK(fast.first_audio_ms < normal.first_audio_ms);
+    CHECK(fast.first_audio_ms
+          <= (FastStartSamples + PktSamples + TickSamples) * 1000 / SampleRate);
+
+    // Latency is grown by slowing down playback, not by inserting silence.
+    LONGS_EQUAL(0, normal.missing_samples);
+    LONGS_EQUAL(0, fast.missing_samples);
+
+    CHECK(fast.final_latency > LatencySamples * 9 / 10);
+}
+
+} // namespace test
+} // namespace roc
@@ -0,0 +1,200 @@
+/*
+ * Copyright (c) 2015 Mikhail Baranov
+ * Copyright (c) 2015 Victor Gaydov
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <CppUTest/TestHarness.h>
+
+#include "roc_config/config.h"
+#include "roc_core/log.h"
+#include "roc_core/random.h"
+#include "roc_rtp/parser.h"
+#include "roc_datagram/datagram_queue.h"
+#include "roc_pipeline/server.h"
+
+#include "test_packet_stream.h"
+
+namespace roc {
+namespace test {
+
+using namespace pipeline;
+
+namespace {
+
+class NullWriter : public audio::ISampleBufferWriter {
+public:
+    virtual void write(const audio::ISampleBufferConstSlice& buffer) {
+        CHECK(buffer);
+    }
+};
+
+// Delay profile, same as in packet::Spoiler: given percentage of packets
+// is delayed by given number of milliseconds, and packets following
+// delayed one are delayed too until sender catches up.
+struct DelayProfile {
+    size_t rate;
+    size_t ms;
+};
+
+struct LatencyResult {
+    double avg_latency;
+    size_t missing_samples;
+};
+
+} // namespace
+
+TEST_GROUP(latency_tuning) {
+    enum {
+        // Number of samples in every channel per tick.
+        TickSamples = ROC_CONFIG_DEFAULT_SERVER_TICK_SAMPLES,
+
+        // Number of samples in every channel per packet.
+        PktSamples = ROC_CONFIG_DEFAULT_PACKET_SAMPLES,
+
+        // Initial latency.
+        LatencySamples = ROC_CONFIG_DEFAULT_SESSION_LATENCY,
+
+        // Number of ticks before measurement, during which latency converges.
+        WarmupTicks = SampleRate * 40 / TickSamples,
+
+        // Number of measured ticks.
+        NumTicks = SampleRate * 40 / TickSamples
+    };
+
+    rtp::Parser parser;
+
+    // Sends packets through simulated network with given delay profile
+    // to server and returns average latency and number of missing samples
+    // during measured ticks.
+    LatencyResult run(int options, const DelayProfile& profile) {
+        ServerConfig config;
+
+        config.options = EnableResampling | options;
+        config.channels = ChannelMask;
+        config.session_timeout = LatencySamples * 10;
+        config.session_latency = LatencySamples;
+        config.output_latency = 0;
+        config.samples_per_tick = TickSamples;
+        config.resampler_type = ResamplerPolyphase;
+
+        datagram::DatagramQueue input;
+        NullWriter output;
+
+        Server server(input, output, config);
+        server.add_port(new_address(PacketStream::DstPort), parser);
+
+        core::random_init(123456);
+
+        PacketStream ps;
+
+        packet::timestamp_t stall_until = 0;
+        packet::timestamp_t arrival = 0;
+        bool has_arrival = false;
+
+        LatencyResult result;
+        result.avg_latency = 0;
+        result.missing_samples = 0;
+
+        for (size_t tick = 0; tick < WarmupTicks + NumTicks; tick++) {
+            const packet::timestamp_t now = packet::timestamp_t(tick * TickSamples);
+
+            for (;;) {
+                if (!has_arrival) {
+                    arrival = ps.ts;
+                    if (arrival < stall_until) {
+                        arrival = stall_until;
+                    }
+                    if (core::random(100) < profile.rate) {
+                        stall_until = arrival += packet::timestamp_t(
+                            profile.ms * SampleRate / 1000);
+                    }
+                    has_arrival = true;
+                }
+                if (arrival > now) {
+                    break;
+                }
+                ps.write(input, 1, PktSamples);
+                has_arrival = false;
+            }
+
+            CHECK(server.tick());
+
+            if (tick < WarmupTicks) {
+                continue;
+            }
+
+            LONGS_EQUAL(1, server.num_sessions());
+
+            const SessionStats stats = server.session_stats(0);
+
+            if (tick == WarmupTicks) {
+                result.missing_samples = stats.num_missing_samples;
+            }
+            if (tick == WarmupTicks + NumTicks - 1) {
+                result.missing_samples =
+                    stats.num_missing_samples - result.missing_samples;
+            }
+
+            result.avg_latency += double(stats.latency) / NumTicks;
+        }
+
+        roc_log(LOG_DEBUG,
+                "latency tuning: delay_rate=%u delay_ms=%u tuning=%d"
+                " avg_latency=%.1lf missing_samples=%u",
+                (unsigned)profile.rate, (unsigned)profile.ms,
+                (int)!!(options & EnableLatencyTuning), result.avg_latency,
+                (unsigned)result.missing_samples);
+
+        return result;
+    }
+
+    // Delays are covered by fixed latency; tuned latency should be lower
+    // without additional losses.
+    void check_lower_latency(const DelayProfile& profile) {
+        const LatencyResult fixed = run(0, profile);
+        const LatencyResult tuned = run(EnableLatencyTuning, profile);
+
+        LONGS_EQUAL(0, fixed.missing_samples);
+        LONGS_EQUAL(0, tuned.missing_samples);
+
+        CHECK(tuned.avg_latency < fixed.avg_latency);
+    }
+
+    // Delays exceed fixed latency; tuned latency should grow and reduce
+    // losses.
+    void check_fewer_losses(const DelayProfile& profile) {
+        const LatencyResult fixed = run(0, profile);
+        const LatencyResult tuned = run(EnableLatencyTuning, profile);
+
+        CHECK(fixed.missing_samples != 0);
+
+        CHECK(tuned.missing_samples < fixed.missing_samples / 2);
+    }
+};
+
+TEST(latency_tuning, no_delays) {
+    DelayProfile profile = { 0, 0 };
+    check_lower_latency(profile);
+}
+
+TEST(latency_tuning, rare_short_delays) {
+    DelayProfile profile = { 2, 20 };
+    check_lower_latency(profile);
+}
+
+TEST(latency_tuning, frequent_short_delays) {
+    DelayProfile profile = { 5, 40 };
+    check_lower_latency(profile);
+}
+
+TEST(latency_tuning, frequent_long_delays) {
+    DelayProfile profile = { 10, 60 };
+    check_fewer_losses(profile);
+}
+
+} // namespace test
+} // namespace roc
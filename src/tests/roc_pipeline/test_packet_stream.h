@@ -130,7 +130,7 @@ public:
     }
 
     datagram::IDatagramPtr make(core::IByteBufferConstSlice buffer) const {
-        datagram::IDatagramPtr dgm = new TestDatagram;
+        datagram::IDatagramPtr dgm = TestDatagramComposer().compose();
 
         dgm->set_buffer(buffer);
         dgm->set_sender(new_address(src));
@@ -58,7 +58,10 @@ TEST_GROUP(server) {
 
     core::ScopedPtr<Server> server;
 
-    void setup() {
+    Server* new_server(datagram::IDatagramReader & reader,
+                       audio::ISampleBufferWriter & writer,
+                       size_t num_workers,
+                       size_t max_sessions = ROC_CONFIG_DEFAULT_MAX_SESSIONS) {
         ServerConfig config;
 
         config.options = ServerOptions;
@@ -67,8 +70,22 @@ TEST_GROUP(server) {
         config.session_latency = LatencySamples;
         config.output_latency = 0;
         config.samples_per_tick = TickSamples;
+        config.num_workers = num_workers;
+        config.max_sessions = max_sessions;
+
+        return new Server(reader, writer, config);
+    }
+
+    void setup() {
+        server.reset(new_server(input, output, 0));
+    }
+
+    void enable_workers(size_t num_workers) {
+        server.reset(new_server(input, output, num_workers));
+    }
 
-        server.reset(new Server(input, output, config));
+    void limit_sessions(size_t max_sessions) {
+        server.reset(new_server(input, output, 0, max_sessions));
     }
 
     void teardown() {
@@ -351,8 +368,9 @@ TEST(server, two_sessions_1sendaddr_1recvaddr_2source) {
 }
 
 TEST(server, drop_above_max_sessions) {
-    enum { MaxSessions = ROC_CONFIG_MAX_SESSIONS };
+    enum { MaxSessions = 10 };
 
+    limit_sessions(MaxSessions);
     add_port(PacketStream::DstPort);
 
     for (datagram::port_t n = 0; n < MaxSessions; n++) {
@@ -702,5 +720,82 @@ TEST(server, corrupted_packet_ignore_in_existing_session) {
     ss.read(output, EnoughPackets * 2 * PktSamples);
 }
 
+TEST(server, workers_one_session) {
+    enable_workers(2);
+
+    add_port(PacketStream::DstPort);
+
+    PacketStream ps;
+    ps.write(input, EnoughPackets, PktSamples);
+
+    render(EnoughPackets * PktSamples);
+    expect_num_sessions(1);
+
+    SampleStream ss;
+    ss.read(output, EnoughPackets * PktSamples);
+}
+
+TEST(server, workers_more_than_sessions) {
+    enable_workers(ROC_CONFIG_MAX_SERVER_WORKERS);
+
+    add_port(PacketStream::DstPort);
+
+    PacketStream ps1;
+    PacketStream ps2;
+
+    ps1.src += 1;
+    ps2.src += 2;
+
+    ps1.write(input, EnoughPackets, PktSamples);
+    ps2.write(input, EnoughPackets, PktSamples);
+
+    render(EnoughPackets * PktSamples);
+    expect_num_sessions(2);
+
+    SampleStream ss;
+    ss.set_sessions(2);
+    ss.read(output, EnoughPackets * PktSamples);
+}
+
+TEST(server, workers_same_output_as_serial) {
+    enum { NumSessions = 5, NumWorkers = 3, NumTicks = EnoughPackets * 3 };
+
+    datagram::DatagramQueue serial_input;
+    SampleQueue<NumTicks> serial_output;
+
+    core::ScopedPtr<Server> serial_server(new_server(serial_input, serial_output, 0));
+    serial_server->add_port(new_address(PacketStream::DstPort), parser);
+
+    enable_workers(NumWorkers);
+    add_port(PacketStream::DstPort);
+
+    for (datagram::port_t n = 0; n < NumSessions; n++) {
+        PacketStream ps;
+        ps.src += n;
+        ps.value += n * 100;
+        ps.sn += n;
+
+        PacketStream serial_ps = ps;
+
+        // Sessions have different length and terminate at different ticks.
+        ps.write(input, EnoughPackets + n, PktSamples);
+        serial_ps.write(serial_input, EnoughPackets + n, PktSamples);
+    }
+
+    for (size_t n = 0; n < NumTicks; n++) {
+        CHECK(server->tick());
+        CHECK(serial_server->tick());
+
+        audio::ISampleBufferConstSlice expected = serial_output.read();
+        audio::ISampleBufferConstSlice actual = output.read();
+
+        LONGS_EQUAL(expected.size(), actual.size());
+
+        for (size_t i = 0; i < expected.size(); i++) {
+            DOUBLES_EQUAL(expected.data()[i], actual.data()[i], 0);
+        }
+    }
+}
+
 } // namespace test
 } // namespace roc
@@ -0,0 +1,148 @@
+/*
+ * Copyright (c) 2015 Mikhail Baranov
+ * Copyright (c) 2015 Victor Gaydov
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <CppUTest/TestHarness.h>
+
+#include "roc_config/config.h"
+#include "roc_core/log.h"
+#include "roc_core/helpers.h"
+#include "roc_core/array.h"
+#include "roc_core/time.h"
+#include "roc_rtp/parser.h"
+#include "roc_datagram/datagram_queue.h"
+#include "roc_pipeline/server.h"
+
+#include "test_packet_stream.h"
+
+namespace roc {
+namespace test {
+
+using namespace pipeline;
+
+namespace {
+
+class NullWriter : public audio::ISampleBufferWriter {
+public:
+    NullWriter()
+        : n_buffers_(0) {
+    }
+
+    virtual void write(const audio::ISampleBufferConstSlice& buffer) {
+        CHECK(buffer);
+        n_buffers_++;
+    }
+
+    size_t num_buffers() const {
+        return n_buffers_;
+    }
+
+private:
+    size_t n_buffers_;
+};
+
+} // namespace
+
+TEST_GROUP(server_load) {
+    enum {
+        // Number of samples in every channel per tick.
+        TickSamples = 64,
+
+        // Number of samples in every channel per packet.
+        PktSamples = TickSamples * 5,
+
+        // Latency.
+        LatencySamples = PktSamples * 4,
+
+        // Number of packets enought to start rendering.
+        EnoughPackets = LatencySamples / PktSamples + 1,
+
+        // Number of measured ticks.
+        NumTicks = PktSamples / TickSamples * 20
+    };
+
+    rtp::Parser parser;
+
+    // Runs server with given number of senders and returns time spent
+    // per tick, in microseconds.
+    double run(size_t num_senders, size_t num_workers) {
+        ServerConfig config;
+
+        config.channels = ChannelMask;
+        config.session_timeout = LatencySamples * 10;
+        config.session_latency = LatencySamples;
+        config.output_latency = 0;
+        config.samples_per_tick = TickSamples;
+        config.max_sessions = num_senders;
+        config.num_workers = num_workers;
+
+        datagram::DatagramQueue input;
+        NullWriter output;
+
+        Server server(input, output, config);
+        server.add_port(new_address(PacketStream::DstPort), parser);
+
+        core::Array<PacketStream, ROC_CONFIG_MAX_SESSIONS> senders(num_senders);
+
+        for (size_t n = 0; n < num_senders; n++) {
+            senders[n].src = datagram::port_t(PacketStream::SrcPort + n);
+            senders[n].write(input, EnoughPackets, PktSamples);
+        }
+
+        CHECK(server.tick());
+        LONGS_EQUAL(num_senders, server.num_sessions());
+
+        const uint64_t start = core::timestamp_ms();
+
+        for (size_t t = 0; t < NumTicks; t++) {
+            if (t % (PktSamples / TickSamples) == 0) {
+                for (size_t n = 0; n < num_senders; n++) {
+                    senders[n].write(input, 1, PktSamples);
+                }
+            }
+
+            CHECK(server.tick());
+        }
+
+        const uint64_t elapsed = core::timestamp_ms() - start;
+
+        LONGS_EQUAL(num_senders, server.num_sessions());
+        LONGS_EQUAL(NumTicks + 1, output.num_buffers());
+
+        return double(elapsed) * 1000 / NumTicks;
+    }
+};
+
+TEST(server_load, senders) {
+    const size_t num_senders[] = { 1, 10, 100, 1000 };
+
+    for (size_t n = 0; n < ROC_ARRAY_SIZE(num_senders); n++) {
+        const double tick_us = run(num_senders[n], 0);
+
+        roc_log(LOG_DEBUG, "server load: senders=%u tick_samples=%u time_per_tick=%.1fus",
+                (unsigned)num_senders[n], (unsigned)TickSamples, tick_us);
+    }
+}
+
+TEST(server_load, senders_with_workers) {
+    enum { NumWorkers = 3 };
+
+    const size_t num_senders[] = { 1, 10, 100, 1000 };
+
+    for (size_t n = 0; n < ROC_ARRAY_SIZE(num_senders); n++) {
+        const double tick_us = run(num_senders[n], NumWorkers);
+
+        roc_log(LOG_DEBUG,
+                "server load: senders=%u workers=%u tick_samples=%u time_per_tick=%.1fus",
+                (unsigned)num_senders[n], (unsigned)NumWorkers, (unsigned)TickSamples,
+                tick_us);
+    }
+}
+
+} // namespace test
+} // namespace roc
@@ -0,0 +1,130 @@
+/*
+ * Copyright (c) 2015 Mikhail Baranov
+ * Copyright (c) 2015 Victor Gaydov
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <CppUTest/TestHarness.h>
+
+#include "roc_config/config.h"
+#include "roc_core/log.h"
+#include "roc_core/helpers.h"
+#include "roc_core/array.h"
+#include "roc_core/time.h"
+#include "roc_rtp/parser.h"
+#include "roc_datagram/datagram_queue.h"
+#include "roc_pipeline/server.h"
+
+#include "test_packet_stream.h"
+
+namespace roc {
+namespace test {
+
+using namespace pipeline;
+
+namespace {
+
+class NullWriter : public audio::ISampleBufferWriter {
+public:
+    virtual void write(const audio::ISampleBufferConstSlice& buffer) {
+        CHECK(buffer);
+    }
+};
+
+} // namespace
+
+TEST_GROUP(static_pipeline_load) {
+    enum {
+        // Number of samples in every channel per tick.
+        TickSamples = 64,
+
+        // Number of samples in every channel per packet.
+        PktSamples = TickSamples * 5,
+
+        // Latency.
+        LatencySamples = PktSamples * 4,
+
+        // Number of packets enought to start rendering.
+        EnoughPackets = LatencySamples / PktSamples + 1,
+
+        // Number of senders.
+        NumSenders = 100,
+
+        // Number of measured ticks.
+        NumTicks = PktSamples / TickSamples * 20
+    };
+
+    rtp::Parser parser;
+
+    // Runs server with given options and returns time spent per tick,
+    // in microseconds.
+    double run(int options) {
+        ServerConfig config;
+
+        config.options = options;
+        config.channels = ChannelMask;
+        config.session_timeout = LatencySamples * 10;
+        config.session_latency = LatencySamples;
+        config.output_latency = 0;
+        config.samples_per_tick = TickSamples;
+        config.max_sessions = NumSenders;
+        config.resampler_type = ResamplerPolyphase;
+
+        datagram::DatagramQueue input;
+        NullWriter output;
+
+        Server server(input, output, config);
+        server.add_port(new_address(PacketStream::DstPort), parser);
+
+        core::Array<PacketStream, NumSenders> senders(NumSenders);
+
+        for (size_t n = 0; n < NumSenders; n++) {
+            senders[n].src = datagram::port_t(PacketStream::SrcPort + n);
+            senders[n].write(input, EnoughPackets, PktSamples);
+        }
+
+        CHECK(server.tick());
+        LONGS_EQUAL(NumSenders, server.num_sessions());
+
+        const uint64_t start = core::timestamp_us();
+
+        for (size_t t = 0; t < NumTicks; t++) {
+            if (t % (PktSamples / TickSamples) == 0) {
+                for (size_t n = 0; n < NumSenders; n++) {
+                    senders[n].write(input, 1, PktSamples);
+                }
+            }
+
+            CHECK(server.tick());
+        }
+
+        const uint64_t elapsed = core::timestamp_us() - start;
+
+        LONGS_EQUAL(NumSenders, server.num_sessions());
+
+        return double(elapsed) / NumTicks;
+    }
+};
+
+TEST(static_pipeline_load, variants) {
+    const int variants[] = { 0, EnableResampling, EnableFEC,
+                             EnableFEC | EnableResampling };
+
+    for (size_t n = 0; n < ROC_ARRAY_SIZE(variants); n++) {
+        const double dynamic_us = run(variants[n]);
+        const double static_us = run(variants[n] | EnableStaticPipeline);
+
+        roc_log(LOG_DEBUG,
+                "static pipeline load: resampling=%d fec=%d senders=%u"
+                " tick_samples=%u dynamic_time_per_tick=%.1fus"
+                " static_time_per_tick=%.1fus",
+                (int)!!(variants[n] & EnableResampling), (int)!!(variants[n] & EnableFEC),
+                (unsigned)NumSenders, (unsigned)TickSamples, dynamic_us, static_us);
+    }
+}
+
+} // namespace test
+} // namespace roc
@@ -0,0 +1,208 @@
+/*
+ * Copyright (c) 2015 Mikhail Baranov
+ * Copyright (c) 2015 Victor Gaydov
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <CppUTest/TestHarness.h>
+
+#include <new>
+#include <stdlib.h>
+
+#include "roc_config/config.h"
+#include "roc_core/scoped_ptr.h"
+#include "roc_rtp/composer.h"
+#include "roc_rtp/parser.h"
+#include "roc_datagram/datagram_queue.h"
+#include "roc_pipeline/client.h"
+#include "roc_pipeline/server.h"
+
+#include "test_sample_stream.h"
+#include "test_sample_queue.h"
+#include "test_datagram.h"
+
+namespace {
+
+// Allocation tracking harness. Counts heap allocations made by any code
+// in test binary while tracking is enabled. Tracked code should not run
+// in other threads.
+bool alloc_tracking = false;
+size_t alloc_count = 0;
+
+void* tracked_alloc(size_t size) {
+    if (alloc_tracking) {
+        alloc_count++;
+    }
+    return malloc(size != 0 ? size : 1);
+}
+
+} // namespace
+
+void* operator new(size_t size) throw(std::bad_alloc) {
+    void* ptr = tracked_alloc(size);
+    if (ptr == NULL) {
+        abort();
+    }
+    return ptr;
+}
+
+void* operator new[](size_t size) throw(std::bad_alloc) {
+    void* ptr = tracked_alloc(size);
+    if (ptr == NULL) {
+        abort();
+    }
+    return ptr;
+}
+
+void* operator new(size_t size, const std::nothrow_t&) throw() {
+    return tracked_alloc(size);
+}
+
+void* operator new[](size_t size, const std::nothrow_t&) throw() {
+    return tracked_alloc(size);
+}
+
+void operator delete(void* ptr) throw() {
+    free(ptr);
+}
+
+void operator delete[](void* ptr) throw() {
+    free(ptr);
+}
+
+void operator delete(void* ptr, const std::nothrow_t&) throw() {
+    free(ptr);
+}
+
+void operator delete[](void* ptr, const std::nothrow_t&) throw() {
+    free(ptr);
+}
+
+namespace roc {
+namespace test {
+
+using namespace pipeline;
+
+namespace {
+
+class NullWriter : public audio::ISampleBufferWriter {
+public:
+    virtual void write(const audio::ISampleBufferConstSlice& buffer) {
+        CHECK(buffer);
+    }
+};
+
+} // namespace
+
+TEST_GROUP(zero_alloc) {
+    enum {
+        // Sending port.
+        ClientPort = 501,
+
+        // Receiving port.
+        ServerPort = 502,
+
+        // Number of samples in every channel per packet.
+        PktSamples = ROC_CONFIG_DEFAULT_PACKET_SAMPLES,
+
+        // Number of samples in input/output buffers.
+        BufSamples = SampleStream::ReadBufsz * 8,
+
+        // Number of ticks before tracking, during which pools are filled.
+        WarmupTicks = PktSamples * 50 / BufSamples,
+
+        // Number of tracked ticks.
+        NumTicks = PktSamples * 100 / BufSamples,
+
+        // Maximum number of sample buffers.
+        MaxBuffers = WarmupTicks + NumTicks
+    };
+
+    SampleQueue<MaxBuffers> input;
+    NullWriter output;
+
+    datagram::DatagramQueue network;
+    TestDatagramComposer datagram_composer;
+
+    rtp::Composer packet_composer;
+    rtp::Parser packet_parser;
+
+    // Runs client and server with given options and returns number of heap
+    // allocations made by them after warmup.
+    size_t run(int options) {
+        ClientConfig client_config;
+
+        client_config.options = options & ~EnableResampling;
+        client_config.fec_scheme = packet::FEC_ReedSolomon8;
+        client_config.channels = ChannelMask;
+        client_config.samples_per_packet = PktSamples;
+
+        Client client(input, network, datagram_composer, packet_composer,
+                      client_config);
+
+        client.set_sender(new_address(ClientPort));
+        client.set_receiver(new_address(ServerPort));
+
+        ServerConfig server_config;
+
+        server_config.options = options;
+        server_config.channels = ChannelMask;
+        server_config.session_timeout = MaxBuffers * BufSamples;
+        server_config.session_latency = PktSamples * 4;
+        server_config.output_latency = 0;
+        server_config.samples_per_tick = BufSamples;
+        server_config.resampler_type = ResamplerPolyphase;
+
+        Server server(network, output, server_config);
+        server.add_port(new_address(ServerPort), packet_parser);
+
+        SampleStream si;
+        for (size_t n = 0; n < MaxBuffers; n++) {
+            si.write(input, BufSamples);
+        }
+
+        bool ok = true;
+
+        for (size_t n = 0; n < MaxBuffers; n++) {
+            if (n == WarmupTicks) {
+                alloc_count = 0;
+                alloc_tracking = true;
+            }
+
+            ok = ok && client.tick() && server.tick();
+        }
+
+        alloc_tracking = false;
+
+        CHECK(ok);
+        LONGS_EQUAL(1, server.num_sessions());
+
+        return alloc_count;
+    }
+};
+
+TEST(zero_alloc, bare) {
+    LONGS_EQUAL(0, run(0));
+}
+
+TEST(zero_alloc, resampling) {
+    LONGS_EQUAL(0, run(EnableResampling));
+}
+
+TEST(zero_alloc, fec) {
+    LONGS_EQUAL(0, run(EnableFEC));
+}
+
+TEST(zero_alloc, fec_resampling) {
+    LONGS_EQUAL(0, run(EnableFEC | EnableResampling));
+}
+
+TEST(zero_alloc, fec_resampling_static_pipeline) {
+    LONGS_EQUAL(0, run(EnableFEC | EnableResampling | EnableStaticPipeline));
+}
+
+} // namespace test
+} // namespace roc
@@ -353,5 +353,61 @@ TEST(audio_packet, write_offset_and_length) {
     }
 }
 
+TEST(audio_packet, formats) {
+    // Float32 stereo packet should fit into datagram buffer.
+    enum { FormatSamples = 150 };
+
+    const SampleFormat formats[] = { Sample_L16, Sample_L24, Sample_Float32 };
+    const double epsilons[] = { 1.0 / (1 << 15), 1.0 / (1 << 23), 0 };
+    const size_t rates[] = { 44100, 48000 };
+
+    for (size_t nf = 0; nf < sizeof(formats) / sizeof(formats[0]); nf++) {
+        for (size_t nr = 0; nr < sizeof(rates) / sizeof(rates[0]); nr++) {
+            for (size_t num_ch = 1; num_ch <= MaxCh; num_ch++) {
+                const channel_mask_t ch_mask = (1 << num_ch) - 1;
+
+                IAudioPacketPtr p1 = compose();
+                p1->set_size(ch_mask, FormatSamples, rates[nr], formats[nf]);
+
+                CHECK(p1->sample_format() == formats[nf]);
+
+                sample_t samples[FormatSamples * MaxCh] = {};
+                for (size_t ns = 0; ns < FormatSamples * num_ch; ns++) {
+                    samples[ns] = make_sample(ns) - 0.1f;
+                }
+                p1->write_samples(ch_mask, 0, samples, FormatSamples);
+
+                IAudioPacketConstPtr p2 = parse(p1->raw_data());
+
+                CHECK(p2->sample_format() == formats[nf]);
+                LONGS_EQUAL(ch_mask, p2->channels());
+                LONGS_EQUAL(FormatSamples, p2->num_samples());
+                LONGS_EQUAL(rates[nr], p2->rate());
+
+                {
+                    sample_t decoded[FormatSamples * MaxCh] = {};
+                    LONGS_EQUAL(FormatSamples,
+                                p2->read_samples(ch_mask, 0, decoded, FormatSamples));
+
+                    for (size_t ns = 0; ns < FormatSamples * num_ch; ns++) {
+                        DOUBLES_EQUAL(samples[ns], decoded[ns], epsilons[nf]);
+                    }
+                }
+
+                for (size_t ch = 0; ch < num_ch; ch++) {
+                    sample_t decoded[FormatSamples] = {};
+                    LONGS_EQUAL(FormatSamples,
+                                p2->read_samples((1 << ch), 0, decoded, FormatSamples));
+
+                    for (size_t ns = 0; ns < FormatSamples; ns++) {
+                        DOUBLES_EQUAL(samples[ns * num_ch + ch], decoded[ns],
+                                      epsilons[nf]);
+                    }
+                }
+            }
+        }
+    }
+}
+
 } // namespace test
 } // namespace roc
@@ -0,0 +1,120 @@
+/*
+ * Copyright (c) 2015 Mikhail Baranov
+ * Copyright (c) 2015 Victor Gaydov
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <CppUTest/TestHarness.h>
+
+#include "roc_core/log.h"
+#include "roc_core/time.h"
+
+#include "roc_rtp/parser.h"
+#include "roc_rtp/composer.h"
+#include "roc_rtp/default_pcm_kernel.h"
+#include "roc_datagram/default_buffer_composer.h"
+
+#include "test_blobs/rtp_l16_2ch_320s.h"
+#include "test_blobs/rtp_l16_1ch_10s_12ext.h"
+
+namespace roc {
+namespace test {
+
+using namespace packet;
+
+namespace {
+
+enum { MaxSize = 2000, NumIterations = 20000 };
+
+} // namespace
+
+TEST_GROUP(audio_packet_load) {
+    IAudioPacketConstPtr parse(const RTP_PacketTest& test) {
+        core::IByteBufferPtr buffer =
+            core::ByteBufferTraits::default_composer<MaxSize>().compose();
+
+        CHECK(buffer);
+
+        buffer->set_size(test.packet_size);
+        memcpy(buffer->data(), test.raw_data, buffer->size());
+
+        rtp::Parser parser;
+        IPacketConstPtr packet = parser.parse(*buffer);
+        CHECK(packet);
+        CHECK(packet->type() == IAudioPacket::Type);
+        return static_cast<const IAudioPacket*>(packet.get());
+    }
+
+    // Reads all samples from packet NumIterations times.
+    void read(const char* name, const RTP_PacketTest& test, channel_mask_t ch_mask) {
+        IAudioPacketConstPtr packet = parse(test);
+
+        sample_t samples[RTP_PacketTest::MaxSamples * RTP_PacketTest::MaxCh];
+
+        const uint64_t start = core::timestamp_us();
+
+        for (size_t n = 0; n < NumIterations; n++) {
+            LONGS_EQUAL(test.num_samples,
+                        packet->read_samples(ch_mask, 0, samples, test.num_samples));
+        }
+
+        report(name, test, core::timestamp_us() - start);
+    }
+
+    // Writes all samples to packet NumIterations times.
+    void write(const char* name, const RTP_PacketTest& test, channel_mask_t ch_mask) {
+        rtp::Composer composer;
+        IPacketPtr pp = composer.compose(IAudioPacket::Type);
+        CHECK(pp);
+
+        IAudioPacketPtr packet = static_cast<IAudioPacket*>(pp.get());
+        packet->set_size((channel_mask_t(1) << test.num_channels) - 1, test.num_samples,
+                         test.samplerate);
+
+        sample_t samples[RTP_PacketTest::MaxSamples * RTP_PacketTest::MaxCh] = {};
+
+        const uint64_t start = core::timestamp_us();
+
+        for (size_t n = 0; n < NumIterations; n++) {
+            packet->write_samples(ch_mask, 0, samples, test.num_samples);
+        }
+
+        report(name, test, core::timestamp_us() - start);
+    }
+
+    void report(const char* name, const RTP_PacketTest& test, uint64_t elapsed_us) {
+        const uint64_t n_samples = (uint64_t)NumIterations * test.num_samples;
+
+        roc_log(LOG_DEBUG, "%s: kernel=%s %u samples in %u us, %u samples/ms", name,
+                rtp::default_pcm_kernel().name(), //
+                (unsigned)n_samples,              //
+                (unsigned)elapsed_us,             //
+                (unsigned)(elapsed_us ? n_samples * 1000 / elapsed_us : 0));
+    }
+};
+
+TEST(audio_packet_load, read_stereo) {
+    read("read stereo", rtp_l16_2ch_320s, 0x3);
+}
+
+TEST(audio_packet_load, read_stereo_sparse) {
+    read("read stereo sparse", rtp_l16_2ch_320s, 0x5);
+}
+
+TEST(audio_packet_load, read_mono) {
+    read("read mono", rtp_l16_1ch_10s_12ext, 0x1);
+}
+
+TEST(audio_packet_load, write_stereo) {
+    write("write stereo", rtp_l16_2ch_320s, 0x3);
+}
+
+TEST(audio_packet_load, write_stereo_sparse) {
+    write("write stereo sparse", rtp_l16_2ch_320s, 0x5);
+}
+
+} // namespace test
+} // namespace roc
@@ -65,9 +65,14 @@ TEST(fec_packet, compose_empty) {
 
     CHECK(!p->marker());
 
+    CHECK(p->scheme() == FEC_LDPC_Staircase);
+
     LONGS_EQUAL(0, p->data_blknum());
     LONGS_EQUAL(0, p->fec_blknum());
 
+    LONGS_EQUAL(0, p->data_blksz());
+    LONGS_EQUAL(0, p->fec_blksz());
+
     p->set_payload(NULL, 0);
     CHECK(!p->payload());
 }
@@ -82,6 +87,9 @@ TEST(fec_packet, compose_full) {
     p->set_data_blknum(54321);
     p->set_fec_blknum(44444);
 
+    p->set_data_blksz(40);
+    p->set_fec_blksz(8);
+
     LONGS_EQUAL(0, p->timestamp());
     LONGS_EQUAL(0, p->rate());
 
@@ -92,8 +100,14 @@ TEST(fec_packet, compose_full) {
     LONGS_EQUAL(54321, p->data_blknum());
     LONGS_EQUAL(44444, p->fec_blknum());
 
+    LONGS_EQUAL(40, p->data_blksz());
+    LONGS_EQUAL(8, p->fec_blksz());
+
     set_payload(p);
     check_payload(p);
+
+    LONGS_EQUAL(40, p->data_blksz());
+    LONGS_EQUAL(8, p->fec_blksz());
 }
 
 TEST(fec_packet, compose_parse) {
@@ -106,6 +120,9 @@ TEST(fec_packet, compose_parse) {
     p1->set_data_blknum(54321);
     p1->set_fec_blknum(44444);
 
+    p1->set_data_blksz(40);
+    p1->set_fec_blksz(8);
+
     set_payload(p1);
 
     IFECPacketConstPtr p2 = parse(p1->raw_data());
@@ -120,6 +137,74 @@ TEST(fec_packet, compose_parse) {
     LONGS_EQUAL(54321, p2->data_blknum());
     LONGS_EQUAL(44444, p2->fec_blknum());
 
+    LONGS_EQUAL(40, p2->data_blksz());
+    LONGS_EQUAL(8, p2->fec_blksz());
+
+    check_payload(p2);
+}
+
+TEST(fec_packet, blksz_after_payload) {
+    IFECPacketPtr p1 = compose();
+
+    set_payload(p1);
+
+    p1->set_data_blksz(100);
+    p1->set_fec_blksz(25);
+
+    check_payload(p1);
+
+    IFECPacketConstPtr p2 = parse(p1->raw_data());
+
+    LONGS_EQUAL(100, p2->data_blksz());
+    LONGS_EQUAL(25, p2->fec_blksz());
+
+    check_payload(p2);
+}
+
+TEST(fec_packet, scheme) {
+    IFECPacketPtr p1 = compose();
+
+    p1->set_scheme(FEC_ReedSolomon8);
+    CHECK(p1->scheme() == FEC_ReedSolomon8);
+
+    set_payload(p1);
+
+    IFECPacketConstPtr p2 = parse(p1->raw_data());
+    CHECK(p2->scheme() == FEC_ReedSolomon8);
+
+    p1->set_scheme(FEC_LDPC_Staircase);
+    CHECK(p1->scheme() == FEC_LDPC_Staircase);
+
+    IFECPacketConstPtr p3 = parse(p1->raw_data());
+    CHECK(p3->scheme() == FEC_LDPC_Staircase);
+
+    check_payload(p3);
+}
+
+TEST(fec_packet, alloc_payload) {
+    IFECPacketPtr p1 = compose();
+
+    p1->set_seqnum(12345);
+    p1->set_data_blksz(40);
+    p1->set_fec_blksz(8);
+
+    core::IByteBufferSlice buff = p1->alloc_payload(PayloadSz);
+    CHECK(buff);
+    LONGS_EQUAL(PayloadSz, buff.size());
+
+    for (size_t n = 0; n < PayloadSz; n++) {
+        buff.data()[n] = (uint8_t)n;
+    }
+
+    CHECK(buff.data() == p1->payload().data());
+    check_payload(p1);
+
+    IFECPacketConstPtr p2 = parse(p1->raw_data());
+
+    LONGS_EQUAL(12345, p2->seqnum());
+    LONGS_EQUAL(40, p2->data_blksz());
+    LONGS_EQUAL(8, p2->fec_blksz());
+
     check_payload(p2);
 }
 
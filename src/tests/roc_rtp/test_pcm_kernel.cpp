@@ -0,0 +1,117 @@
+/*
+ * Copyright (c) 2015 Mikhail Baranov
+ * Copyright (c) 2015 Victor Gaydov
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <CppUTest/TestHarness.h>
+
+#include "roc_core/random.h"
+#include "roc_core/byte_order.h"
+
+#include "roc_rtp/generic_pcm_kernel.h"
+#include "roc_rtp/default_pcm_kernel.h"
+
+namespace roc {
+namespace test {
+
+using namespace rtp;
+
+using packet::sample_t;
+
+namespace {
+
+// Not multiple of vector width, to cover tail loops.
+enum { NumSamples = 259 };
+
+} // namespace
+
+TEST_GROUP(pcm_kernel) {
+    int16_t pcm[NumSamples];
+    sample_t samples[NumSamples];
+
+    void setup() {
+        for (size_t n = 0; n < NumSamples; n++) {
+            pcm[n] = (int16_t)ROC_HTON_16(uint16_t(core::random(0, 0xffff)));
+            samples[n] = (sample_t)core::random(0, 40000) / 10000.0f - 2.0f;
+        }
+
+        // Boundary values.
+        samples[0] = 1;
+        samples[1] = -1;
+        samples[2] = 0;
+        samples[3] = 32767.0f / (1 << 15);
+    }
+
+    void check_decode(IPCMKernel & kernel) {
+        sample_t out[NumSamples] = {};
+
+        kernel.decode_l16(out, pcm, NumSamples);
+
+        for (size_t n = 0; n < NumSamples; n++) {
+            const int16_t hs = (int16_t)ROC_NTOH_16(uint16_t(pcm[n]));
+            DOUBLES_EQUAL((double)hs / (1 << 15), out[n], 0);
+        }
+    }
+
+    void check_encode(IPCMKernel & kernel) {
+        int16_t out[NumSamples] = {};
+
+        kernel.encode_l16(out, samples, NumSamples);
+
+        for (size_t n = 0; n < NumSamples; n++) {
+            long expected = (long)(samples[n] * (1 << 15));
+            if (expected > 32767) {
+                expected = 32767;
+            } else if (expected < -32768) {
+                expected = -32768;
+            }
+            LONGS_EQUAL(expected, (int16_t)ROC_NTOH_16(uint16_t(out[n])));
+        }
+    }
+
+    void check_roundtrip(IPCMKernel & kernel) {
+        sample_t decoded[NumSamples] = {};
+        int16_t encoded[NumSamples] = {};
+
+        kernel.decode_l16(decoded, pcm, NumSamples);
+        kernel.encode_l16(encoded, decoded, NumSamples);
+
+        for (size_t n = 0; n < NumSamples; n++) {
+            LONGS_EQUAL(pcm[n], encoded[n]);
+        }
+    }
+};
+
+TEST(pcm_kernel, generic_decode_l16) {
+    GenericPCMKernel kernel;
+    check_decode(kernel);
+}
+
+TEST(pcm_kernel, generic_encode_l16) {
+    GenericPCMKernel kernel;
+    check_encode(kernel);
+}
+
+TEST(pcm_kernel, generic_roundtrip_l16) {
+    GenericPCMKernel kernel;
+    check_roundtrip(kernel);
+}
+
+TEST(pcm_kernel, default_decode_l16) {
+    check_decode(default_pcm_kernel());
+}
+
+TEST(pcm_kernel, default_encode_l16) {
+    check_encode(default_pcm_kernel());
+}
+
+TEST(pcm_kernel, default_roundtrip_l16) {
+    check_roundtrip(default_pcm_kernel());
+}
+
+} // namespace test
+} // namespace roc
@@ -118,6 +118,18 @@ TEST_GROUP(rtp_packet) {
                 DOUBLES_EQUAL(s, samples[ns], Epsilon);
             }
         }
+
+        sample_t samples[MaxSamples * RTP_PacketTest::MaxCh] = {};
+        LONGS_EQUAL(test.num_samples,
+                    packet->read_samples(packet->channels(), 0, samples,
+                                         test.num_samples));
+
+        for (size_t ns = 0; ns < test.num_samples; ns++) {
+            for (size_t ch = 0; ch < test.num_channels; ch++) {
+                double s = (double)test.samples[ch][ns] / (1 << (test.samplebits - 1));
+                DOUBLES_EQUAL(s, samples[ns * test.num_channels + ch], Epsilon);
+            }
+        }
     }
 
     void test_packet(const RTP_PacketTest& test) {
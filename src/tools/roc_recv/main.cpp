@@ -10,7 +10,9 @@
 #include "roc_core/log.h"
 #include "roc_datagram/address_to_str.h"
 #include "roc_datagram/datagram_queue.h"
+#include "roc_datagram/datagram_ring.h"
 #include "roc_audio/sample_buffer_queue.h"
+#include "roc_audio/polyphase_bank.h"
 #include "roc_pipeline/server.h"
 #include "roc_rtp/parser.h"
 #include "roc_sndio/writer.h"
@@ -71,6 +73,18 @@ int main(int argc, char** argv) {
     if (args.beep_flag) {
         config.options |= pipeline::EnableBeep;
     }
+    if (args.clipping_arg == clipping_arg_yes) {
+        config.options |= pipeline::EnableClipping;
+    }
+    if (args.latency_tuning_arg == latency_tuning_arg_yes) {
+        config.options |= pipeline::EnableLatencyTuning;
+    }
+    if (args.fast_start_arg == fast_start_arg_yes) {
+        config.options |= pipeline::EnableFastStart;
+    }
+    if (args.static_pipeline_arg == static_pipeline_arg_yes) {
+        config.options |= pipeline::EnableStaticPipeline;
+    }
     if (args.rate_given) {
         if (!check_ge("rate", args.rate_arg, 1)) {
             return 1;
@@ -89,6 +103,29 @@ int main(int argc, char** argv) {
         }
         config.session_latency = (size_t)args.session_latency_arg;
     }
+    if (args.min_session_latency_given) {
+        if (!check_ge("min-session-latency", args.min_session_latency_arg, 0)) {
+            return 1;
+        }
+        config.min_session_latency = (size_t)args.min_session_latency_arg;
+    }
+    if (args.max_session_latency_given) {
+        if (!check_ge("max-session-latency", args.max_session_latency_arg, 0)) {
+            return 1;
+        }
+        config.max_session_latency = (size_t)args.max_session_latency_arg;
+    }
+    if (config.min_session_latency > config.max_session_latency) {
+        roc_log(LOG_ERROR,
+                "invalid `--min-session-latency': should not exceed max session latency");
+        return 1;
+    }
+    if (args.fast_start_latency_given) {
+        if (!check_ge("fast-start-latency", args.fast_start_latency_arg, 0)) {
+            return 1;
+        }
+        config.fast_start_latency = (size_t)args.fast_start_latency_arg;
+    }
     if (args.output_latency_given) {
         if (!check_ge("output-latency", args.output_latency_arg, 0)) {
             return 1;
@@ -107,19 +144,85 @@ int main(int argc, char** argv) {
         }
         config.samples_per_resampler_frame = (size_t)args.resampler_frame_arg;
     }
+    if (args.resampler_arg == resampler_arg_polyphase) {
+        config.resampler_type = pipeline::ResamplerPolyphase;
+    }
+    if (args.resampler_phases_given) {
+        if (!audio::PolyphaseBank::valid_num_phases(
+                (size_t)args.resampler_phases_arg)) {
+            roc_log(LOG_ERROR,
+                    "invalid `--resampler-phases=%d': should be power of two"
+                    " in range [%u; %u]",
+                    args.resampler_phases_arg, (unsigned)audio::PolyphaseBank::MinPhases,
+                    (unsigned)audio::PolyphaseBank::MaxPhases);
+            return 1;
+        }
+        config.resampler_phases = (size_t)args.resampler_phases_arg;
+    }
+    if (args.max_sessions_given) {
+        if (!check_ge("max-sessions", args.max_sessions_arg, 1)) {
+            return 1;
+        }
+        if (args.max_sessions_arg > ROC_CONFIG_MAX_SESSIONS) {
+            roc_log(LOG_ERROR, "invalid `--max-sessions=%d': should be <= %d",
+                    args.max_sessions_arg, ROC_CONFIG_MAX_SESSIONS);
+            return 1;
+        }
+        config.max_sessions = (size_t)args.max_sessions_arg;
+    }
+    if (args.workers_given) {
+        if (!check_ge("workers", args.workers_arg, 0)) {
+            return 1;
+        }
+        if (args.workers_arg > ROC_CONFIG_MAX_SERVER_WORKERS) {
+            roc_log(LOG_ERROR, "invalid `--workers=%d': should be <= %d",
+                    args.workers_arg, ROC_CONFIG_MAX_SERVER_WORKERS);
+            return 1;
+        }
+        config.num_workers = (size_t)args.workers_arg;
+    }
+
+    netio::UDPReceiverConfig recv_config;
+    if (args.recv_batch_given) {
+        if (!check_ge("recv-batch", args.recv_batch_arg, 1)) {
+            return 1;
+        }
+        if (args.recv_batch_arg > ROC_CONFIG_MAX_UDP_BATCH) {
+            roc_log(LOG_ERROR, "invalid `--recv-batch=%d': should be <= %d",
+                    args.recv_batch_arg, ROC_CONFIG_MAX_UDP_BATCH);
+            return 1;
+        }
+        recv_config.batch_size = (size_t)args.recv_batch_arg;
+    }
+    if (args.recv_buffer_given) {
+        if (!check_ge("recv-buffer", args.recv_buffer_arg, 0)) {
+            return 1;
+        }
+        recv_config.socket_buffer_size = (size_t)args.recv_buffer_arg;
+    }
 
     datagram::DatagramQueue dgm_queue;
+    datagram::DatagramRing dgm_ring;
+
+    datagram::IDatagramReader* dgm_reader = &dgm_queue;
+    datagram::IDatagramWriter* dgm_writer = &dgm_queue;
+
+    if (args.recv_queue_arg == recv_queue_arg_ring) {
+        dgm_reader = &dgm_ring;
+        dgm_writer = &dgm_ring;
+    }
+
     audio::SampleBufferQueue sample_queue;
     rtp::Parser rtp_parser;
 
     netio::Transceiver trx;
-    if (!trx.add_udp_receiver(addr, dgm_queue)) {
+    if (!trx.add_udp_receiver(addr, *dgm_writer, recv_config)) {
         roc_log(LOG_ERROR, "can't register udp receiver: %s",
                 datagram::address_to_str(addr).c_str());
         return 1;
     }
 
-    pipeline::Server server(dgm_queue, sample_queue, config);
+    pipeline::Server server(*dgm_reader, sample_queue, config);
     server.add_port(addr, rtp_parser);
 
     sndio::Writer writer(sample_queue, config.channels, config.sample_rate);
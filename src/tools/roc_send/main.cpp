@@ -13,6 +13,8 @@
 #include "roc_audio/sample_buffer_queue.h"
 #include "roc_pipeline/client.h"
 #include "roc_rtp/composer.h"
+#include "roc_rtp/rtp_audio_format.h"
+#include "roc_rtp/rtp_header.h"
 #include "roc_sndio/reader.h"
 #include "roc_netio/transceiver.h"
 #include "roc_netio/inet_address.h"
@@ -76,6 +78,23 @@ int main(int argc, char** argv) {
     if (args.fec_arg == fec_arg_yes) {
         config.options |= pipeline::EnableFEC;
     }
+    if (args.fec_scheme_arg == fec_scheme_arg_rs) {
+        config.fec_scheme = packet::FEC_ReedSolomon8;
+    }
+    if (args.fec_data_given) {
+        if (!check_range("fec-data", args.fec_data_arg, 1,
+                         ROC_CONFIG_MAX_FEC_BLOCK_DATA_PACKETS)) {
+            return 1;
+        }
+        config.fec_block_data_packets = (size_t)args.fec_data_arg;
+    }
+    if (args.fec_redundant_given) {
+        if (!check_range("fec-redundant", args.fec_redundant_arg, 1,
+                         ROC_CONFIG_MAX_FEC_BLOCK_REDUNDANT_PACKETS)) {
+            return 1;
+        }
+        config.fec_block_redundant_packets = (size_t)args.fec_redundant_arg;
+    }
     if (args.interleaving_arg == interleaving_arg_yes) {
         config.options |= pipeline::EnableInterleaving;
     }
@@ -88,6 +107,31 @@ int main(int argc, char** argv) {
         }
         config.sample_rate = (size_t)args.rate_arg;
     }
+    if (args.format_arg != format_arg_l16) {
+        config.sample_format = (args.format_arg == format_arg_l24 ? packet::Sample_L24
+                                                                  : packet::Sample_Float32);
+        // Keep packets of wider samples within UDP buffer size.
+        config.samples_per_packet /= 2;
+    }
+    const rtp::RTP_AudioFormat* format = rtp::get_audio_format_cr(
+        config.channels, config.sample_rate, config.sample_format);
+    if (!format) {
+        roc_log(LOG_ERROR, "unsupported combination of sample rate and format");
+        return 1;
+    }
+    if ((config.options & pipeline::EnableFEC)
+        && config.fec_scheme == packet::FEC_LDPC_Staircase) {
+        // LDPC codec uses fixed symbol size.
+        const size_t packet_size =
+            sizeof(rtp::RTP_Header) + format->size(config.samples_per_packet);
+        if (packet_size != ROC_CONFIG_DEFAULT_PACKET_SIZE) {
+            roc_log(LOG_ERROR, "ldpc fec scheme requires packet size %lu, got %lu;"
+                               " use --fec-scheme=rs or --fec=no with this format",
+                    (unsigned long)ROC_CONFIG_DEFAULT_PACKET_SIZE,
+                    (unsigned long)packet_size);
+            return 1;
+        }
+    }
     if (args.loss_rate_given) {
         if (!check_range("loss-rate", args.loss_rate_arg, 0, 100)) {
             return 1;